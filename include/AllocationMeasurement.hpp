@@ -0,0 +1,61 @@
+/// @file AllocationMeasurement.hpp
+///
+/// @brief Definition of the class counting the memory allocations.
+/// @details Provides methods which start and stop counting the allocations
+/// done with operator new and return the counted allocations.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#ifndef ALLOCATION_MEASUREMENT_HPP
+#define ALLOCATION_MEASUREMENT_HPP
+
+#include <cstdint>
+#include <string>
+
+namespace xq
+{
+	/// @class AllocationMeasurement
+	/// @brief Methods to count the memory allocations of operations.
+	/// @details The global operator new, including its aligned version, is replaced to count all the allocations
+	/// of the program. The replacement makes every allocation update shared counters, so it is compiled only when
+	/// XQ_MEASURE_ALLOCATIONS is defined by the CMake option MEASURE_ALLOCATIONS, which is off by default. Without
+	/// it nothing is counted and the other measurements are not slowed down. The measurement takes the difference
+	/// of the counters between its start and its stop, so the allocations of all the threads running meanwhile are counted.
+	class AllocationMeasurement
+	{
+	public:
+		/// @brief Check if the allocations are counted in this build.
+		/// @returns True if the global operator new is replaced, false elsewhen.
+		static bool isEnabled();
+
+		/// @brief Start counting the allocations.
+		/// @details Saves the current values of the global counters.
+		void startMeasurement();
+
+		/// @brief Stop counting the allocations.
+		/// @details Takes the difference of the global counters since the start.
+		void stopMeasurement();
+
+		/// @brief Get the number of allocations between the start and the stop.
+		/// @returns The number of calls of operator new.
+		uint64_t getNumberOfAllocations() const;
+
+		/// @brief Get the number of allocated bytes between the start and the stop.
+		/// @returns The sum of the sizes passed to operator new.
+		uint64_t getNumberOfAllocatedBytes() const;
+
+		/// @brief Print the counted allocations.
+		/// @param[in] f_operationName The name of the measured operation.
+		void printAllocations(const std::string& f_operationName) const;
+
+	private:
+		uint64_t m_startAllocations{ 0 }; ///< The number of allocations of the program at the start.
+		uint64_t m_startAllocatedBytes{ 0 }; ///< The number of allocated bytes of the program at the start.
+		uint64_t m_numberOfAllocations{ 0 }; ///< The number of allocations between the start and the stop.
+		uint64_t m_numberOfAllocatedBytes{ 0 }; ///< The number of allocated bytes between the start and the stop.
+	};
+} /// namespace xq
+#endif // !ALLOCATION_MEASUREMENT_HPP
@@ -0,0 +1,140 @@
+/// @file ConcurrentInMemoryDb.hpp
+///
+/// @brief Definition of the in-memory database class ConcurrentInMemoryDb.
+/// @details Gives several threads concurrent access to an in-memory database,
+/// where the readers never block and never see a partly applied mutation.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#ifndef CONCURRENT_IN_MEMORY_DB_HPP
+#define CONCURRENT_IN_MEMORY_DB_HPP
+
+#include "InMemoryDb.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+namespace xq
+{
+    /// @class ConcurrentInMemoryDb
+    /// @brief In-memory database shared by reading and writing threads.
+    /// @details Keeps two copies of the database. The readers use one copy without any lock, while the writer changes
+    /// the other one. Then the writer switches the readers to the changed copy, waits until the readers still using
+    /// the old copy are done and applies the same mutation to it. So the readers only increment and decrement a counter,
+    /// never wait and always see the database either before or after a whole mutation. The writers are serialized and
+    /// wait for the readers instead. The price is the double memory and applying every mutation twice.
+    /// The records found by a reader, including the pointers to them, are valid only until the reading function returns.
+    class ConcurrentInMemoryDb
+    {
+    public:
+        /// @brief Class constructor with arguments.
+        /// @details Constructs both copies of the database from the records.
+        /// @param[in] f_records The records to be stored in the database.
+        /// @param[in] f_storageLayout The storage layout used by the searches.
+        ConcurrentInMemoryDb(const DbTestRecordCollection& f_records, DbStorageLayout f_storageLayout = DbStorageLayout::Row);
+
+        ConcurrentInMemoryDb(const ConcurrentInMemoryDb&) = delete;
+        ConcurrentInMemoryDb& operator=(const ConcurrentInMemoryDb&) = delete;
+
+        /// @brief Read the database without blocking.
+        /// @details Can be called by any number of threads at the same time, also while a mutation is written.
+        /// @param[in] f_reader Function called with the current copy of the database. The references and pointers to
+        /// the records are valid only inside the function, so it has to copy whatever it returns.
+        /// @returns The result of the reading function.
+        template<typename TReader>
+        auto read(TReader&& f_reader) const
+        {
+            // Registered readers keep the writer from changing the copy they use
+            DbReadGuard guard{ m_readIndicators[m_versionIndex.load()] };
+            return f_reader(static_cast<const InMemoryDb&>(m_instances[m_readInstanceIndex.load()]));
+        }
+
+        /// @brief Apply a mutation to the database.
+        /// @details The writers are serialized. The readers see the mutation once the function returns.
+        /// @param[in] f_mutation Function called with each of the two copies of the database. It has to change
+        /// both of them the same way. A write-ahead log enabled this way would log every mutation twice.
+        void write(const DbMutationFunction& f_mutation);
+
+        /// @brief Add a new record to the database.
+        /// @param[in] f_newRecord The new record to be added.
+        void addRecord(const DbTableTest& f_newRecord);
+
+        /// @brief Add several new records to the database as one mutation.
+        /// @param[in] f_newRecords The new records to be added.
+        void addRecords(const DbTestRecordCollection& f_newRecords);
+
+        /// @brief Delete a record from the database with the given id.
+        /// @param[in] f_id The id of the record to be deleted.
+        void deleteRecordByID(uint32_t f_id);
+
+        /// @brief Delete several records from the database with the given ids as one mutation.
+        /// @param[in] f_ids The ids of the records to be deleted.
+        void deleteRecordsByIds(const DbRecordIdsCollection& f_ids);
+
+        /// @brief Find a record with the given id.
+        /// @param[in] f_id The id of the record to look for.
+        /// @param[out] f_record The copy of the found record.
+        /// @returns True if the record was found, false elsewhen.
+        bool findById(uint64_t f_id, DbTableTest& f_record) const;
+
+        /// @brief Searches the records for a given string in a given column.
+        /// @param[in] f_columnName The name of the column to search in.
+        /// @param[in] f_matchString The string to search for.
+        /// @param[out] f_output Contains copies of the records which match the search criteria.
+        void findMatchingRecords(const std::string& f_columnName, const std::string& f_matchString,
+            DbTestRecordCollection& f_output) const;
+
+        /// @brief Get the number of records in the database.
+        /// @returns The number of available records, which are not considered deleted.
+        uint64_t getNumberOfRecords() const;
+
+    private:
+        /// @struct DbReadIndicator
+        /// @brief Number of readers registered with a version, alone in its cache line.
+        struct alignas(64) DbReadIndicator
+        {
+            std::atomic<uint64_t> numberOfReaders{ 0 }; ///< The number of the registered readers.
+        };
+
+        /// @struct DbReadGuard
+        /// @brief Registers a reader for its lifetime.
+        struct DbReadGuard
+        {
+            /// @brief Register the reader.
+            /// @param[in] f_readIndicator The read indicator of the current version.
+            explicit DbReadGuard(DbReadIndicator& f_readIndicator)
+                :
+                readIndicator{ f_readIndicator }
+            {
+                readIndicator.numberOfReaders.fetch_add(1);
+            }
+
+            /// @brief Unregister the reader.
+            ~DbReadGuard()
+            {
+                readIndicator.numberOfReaders.fetch_sub(1);
+            }
+
+            DbReadGuard(const DbReadGuard&) = delete;
+            DbReadGuard& operator=(const DbReadGuard&) = delete;
+
+            DbReadIndicator& readIndicator; ///< The read indicator, where the reader is registered.
+        };
+
+        /// @brief Wait until no reader is registered with a version.
+        /// @param[in] f_versionIndex The index of the version.
+        void waitForReaders(uint32_t f_versionIndex) const;
+
+        std::array<InMemoryDb, 2> m_instances; ///< The two copies of the database.
+        std::atomic<uint32_t> m_readInstanceIndex; ///< The index of the copy used by the new readers.
+        std::atomic<uint32_t> m_versionIndex; ///< The index of the read indicator, where the new readers register.
+        mutable std::array<DbReadIndicator, 2> m_readIndicators; ///< The readers registered with each version.
+        std::mutex m_writeMutex; ///< Serializes the writers.
+    };
+} /// namespace xq
+#endif /// !CONCURRENT_IN_MEMORY_DB_HPP
@@ -0,0 +1,66 @@
+/// @file DbAggregate.hpp
+///
+/// @brief Definition of the aggregate of the values of an integer column.
+/// @details Keeps COUNT, SUM, MIN and MAX of the aggregated values together,
+/// so that all of them and AVG are computed by a single pass over the records.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#ifndef DB_AGGREGATE_HPP
+#define DB_AGGREGATE_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <unordered_map>
+
+namespace xq
+{
+    /// @struct DbAggregate
+    /// @brief COUNT, SUM, MIN and MAX of a set of integer values.
+    /// @details The values are aggregated as signed 64-bit integers. Partial aggregates of separate
+    /// parts of the records are combined with merge, which gives the same result as a single pass.
+    /// The minimum and the maximum of an empty aggregate are the largest and the smallest value.
+    struct DbAggregate
+    {
+        uint64_t count{ 0 }; ///< The number of aggregated values.
+        int64_t sum{ 0 }; ///< The sum of the values.
+        int64_t minimum{ std::numeric_limits<int64_t>::max() }; ///< The smallest value.
+        int64_t maximum{ std::numeric_limits<int64_t>::min() }; ///< The largest value.
+
+        /// @brief Add a value to the aggregate.
+        /// @param[in] f_value The value to be added.
+        void addValue(int64_t f_value)
+        {
+            ++count;
+            sum += f_value;
+            minimum = std::min(minimum, f_value);
+            maximum = std::max(maximum, f_value);
+        }
+
+        /// @brief Add all the values of another aggregate.
+        /// @param[in] f_other The aggregate to be added.
+        void merge(const DbAggregate& f_other)
+        {
+            count += f_other.count;
+            sum += f_other.sum;
+            minimum = std::min(minimum, f_other.minimum);
+            maximum = std::max(maximum, f_other.maximum);
+        }
+
+        /// @brief Get the average of the values.
+        /// @returns The sum divided by the count, 0 if there are no values.
+        double getAverage() const
+        {
+            return count == 0 ? 0.0 : static_cast<double>(sum) / static_cast<double>(count);
+        }
+    };
+
+    // Definition for the Aggregate Groups Collection, mapping the value of the grouping column to the aggregate of the group
+    typedef std::unordered_map<std::string, DbAggregate> DbAggregateGroupsCollection;
+} /// namespace xq
+#endif /// !DB_AGGREGATE_HPP
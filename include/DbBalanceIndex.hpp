@@ -0,0 +1,154 @@
+/// @file DbBalanceIndex.hpp
+///
+/// @brief Definition of the ordered secondary index for the balance column.
+/// @details Keeps the balances of the records sorted, so that range searches
+/// only need to look at the records in the range.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#ifndef DB_BALANCE_INDEX_HPP
+#define DB_BALANCE_INDEX_HPP
+
+#include "DbScanKernels.hpp"
+
+namespace xq
+{
+    /// @struct DbBalanceIndexEntry
+    /// @brief Entry of the balance index.
+    /// @details The entries are ordered by balance and then by the position of the record.
+    struct DbBalanceIndexEntry
+    {
+        int32_t balance; ///< Balance of the record.
+        size_t index; ///< Position of the record.
+
+        /// @brief Compare two entries by balance and then by position.
+        /// @param[in] f_other The entry to compare with.
+        /// @returns True if this entry is ordered before the other one, false elsewhen.
+        bool operator<(const DbBalanceIndexEntry& f_other) const
+        {
+            return balance < f_other.balance || (balance == f_other.balance && index < f_other.index);
+        }
+
+        /// @brief Check if two entries are the same.
+        /// @param[in] f_other The entry to compare with.
+        /// @returns True if both the balance and the position are equal, false elsewhen.
+        bool operator==(const DbBalanceIndexEntry& f_other) const
+        {
+            return balance == f_other.balance && index == f_other.index;
+        }
+    };
+
+    // Definition for the Balance Index Entries Collection
+    typedef std::vector<DbBalanceIndexEntry> DbBalanceIndexEntriesCollection;
+
+    /// @class DbBalanceIndex
+    /// @brief Ordered secondary index of the balance column.
+    /// @details Stores the entries in a sorted array, which is compact and cache-friendly to search with
+    /// binary search. Adding or removing an entry in the middle of a large sorted array would require shifting
+    /// the rest of it, so the changes are first collected in two small sorted delta buffers - one for the added and
+    /// one for the removed entries. Once the buffers grow over a threshold, they are merged into the sorted array.
+    /// A range search finds the first entry with binary search in the array and in the buffer of added entries
+    /// and merges both, skipping the removed entries, so it takes O(log N + k) for k found entries.
+    class DbBalanceIndex
+    {
+    public:
+        /// @brief Replace the content of the index.
+        /// @param[in] f_entries The entries to be stored in the index, in any order.
+        void build(DbBalanceIndexEntriesCollection f_entries);
+
+        /// @brief Add the balance of a record to the index.
+        /// @param[in] f_balance The balance of the record.
+        /// @param[in] f_index The position of the record.
+        void addEntry(int32_t f_balance, size_t f_index);
+
+        /// @brief Remove the balance of a record from the index.
+        /// @param[in] f_balance The balance of the record, as it was added to the index.
+        /// @param[in] f_index The position of the record.
+        void removeEntry(int32_t f_balance, size_t f_index);
+
+        /// @brief Remove all the entries from the index.
+        void clear();
+
+        /// @brief Find the records with a balance in a given range.
+        /// @param[in] f_lowerBound The lowest balance to be found.
+        /// @param[in] f_upperBound The highest balance to be found.
+        /// @param[out] f_output Contains the positions of the found records, ordered by balance and then by position.
+        void findRange(int32_t f_lowerBound, int32_t f_upperBound, DbRecordIndexesCollection& f_output) const;
+
+        /// @brief Get the number of entries in the index.
+        /// @returns The number of indexed records.
+        size_t getNumberOfEntries() const;
+
+        /// @brief Call a function for the entries in the order of the index until it asks to stop.
+        /// @details Takes O(1) per visited entry, so walking only the first entries doesn't depend on the size of the index.
+        /// @param[in] f_isDescending If true, the entries are visited from the largest balance and the last position.
+        /// @param[in] f_visitor Function called with each entry. Returns false to stop the walk.
+        template<typename TVisitor>
+        void forEachEntry(bool f_isDescending, TVisitor f_visitor) const
+        {
+            if (f_isDescending)
+            {
+                visitMergedEntries(m_entries.rbegin(), m_entries.rend(), m_addedEntries.rbegin(), m_addedEntries.rend(),
+                    m_removedEntries.rbegin(), m_removedEntries.rend(),
+                    [](const DbBalanceIndexEntry& f_first, const DbBalanceIndexEntry& f_second) { return f_second < f_first; },
+                    f_visitor);
+            }
+            else
+            {
+                visitMergedEntries(m_entries.begin(), m_entries.end(), m_addedEntries.begin(), m_addedEntries.end(),
+                    m_removedEntries.begin(), m_removedEntries.end(),
+                    [](const DbBalanceIndexEntry& f_first, const DbBalanceIndexEntry& f_second) { return f_first < f_second; },
+                    f_visitor);
+            }
+        }
+
+    private:
+        /// @brief Merge the sorted array and the added entries, skipping the removed ones, in a given direction.
+        /// @param[in] f_entriesIter The first entry of the sorted array.
+        /// @param[in] f_entriesEnd The end of the sorted array.
+        /// @param[in] f_addedIter The first added entry.
+        /// @param[in] f_addedEnd The end of the added entries.
+        /// @param[in] f_removedIter The first removed entry.
+        /// @param[in] f_removedEnd The end of the removed entries.
+        /// @param[in] f_isBefore Comparison of the entries in the direction of the walk.
+        /// @param[in] f_visitor Function called with each entry. Returns false to stop the walk.
+        template<typename TIterator, typename TIsBefore, typename TVisitor>
+        static void visitMergedEntries(TIterator f_entriesIter, TIterator f_entriesEnd, TIterator f_addedIter, TIterator f_addedEnd,
+            TIterator f_removedIter, TIterator f_removedEnd, TIsBefore f_isBefore, TVisitor& f_visitor)
+        {
+            while (f_entriesIter != f_entriesEnd || f_addedIter != f_addedEnd)
+            {
+                if (f_addedIter != f_addedEnd && (f_entriesIter == f_entriesEnd || f_isBefore(*f_addedIter, *f_entriesIter)))
+                {
+                    if (!f_visitor(*f_addedIter))
+                    {
+                        return;
+                    }
+                    ++f_addedIter;
+                    continue;
+                }
+
+                while (f_removedIter != f_removedEnd && f_isBefore(*f_removedIter, *f_entriesIter))
+                {
+                    ++f_removedIter;
+                }
+                if ((f_removedIter == f_removedEnd || !(*f_removedIter == *f_entriesIter)) && !f_visitor(*f_entriesIter))
+                {
+                    return;
+                }
+                ++f_entriesIter;
+            }
+        }
+
+        /// @brief Merge the delta buffers into the sorted array if they grew over the threshold.
+        void mergeIfNeeded();
+
+        DbBalanceIndexEntriesCollection m_entries; ///< All the entries, sorted, without the changes in the delta buffers.
+        DbBalanceIndexEntriesCollection m_addedEntries; ///< Sorted entries added after the last merge.
+        DbBalanceIndexEntriesCollection m_removedEntries; ///< Sorted entries of m_entries removed after the last merge.
+    };
+} /// namespace xq
+#endif /// !DB_BALANCE_INDEX_HPP
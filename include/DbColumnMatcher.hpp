@@ -0,0 +1,246 @@
+/// @file DbColumnMatcher.hpp
+///
+/// @brief Definition of the compile-time column descriptors and matchers.
+/// @details Describes the columns of a table at compile time, so that the
+/// generic searches can match a string against any column of any table
+/// without calling a function through a pointer for each record.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#ifndef DB_COLUMN_MATCHER_HPP
+#define DB_COLUMN_MATCHER_HPP
+
+#include "DbSubstringSearcher.hpp"
+
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <variant>
+
+namespace xq
+{
+    /// @struct DbColumn
+    /// @brief Compile-time descriptor of a table column.
+    /// @details Describes a column by the member of the table struct holding its values.
+    /// @tparam TTable The struct of the table records.
+    /// @tparam TValue The type of the column values.
+    /// @tparam TMember Pointer to the member holding the column values.
+    template <typename TTable, typename TValue, TValue TTable::* TMember>
+    struct DbColumn
+    {
+        typedef TTable TableType; ///< The struct of the table records.
+        typedef TValue ValueType; ///< The type of the column values.
+
+        /// @brief Get the value of the column from a record.
+        /// @param[in] f_record The table record.
+        /// @returns The value of the column.
+        static const TValue& getValue(const TTable& f_record)
+        {
+            return f_record.*TMember;
+        }
+    };
+
+    /// @brief Convert a string to a value of an integer column.
+    /// @details Parses the string as a 64-bit integer, the same way as std::stoll and std::stoull, and checks that
+    /// the value fits in the type of the column instead of truncating it. A negative value of an unsigned column
+    /// is out of range, while std::stoull would wrap it.
+    /// @tparam TValue The type of the column values.
+    /// @param[in] f_string The string representation of the value.
+    /// @returns The value. Throws std::invalid_argument if the string is not a number and std::out_of_range
+    /// if the value doesn't fit in the type of the column.
+    template <typename TValue>
+    TValue parseColumnValue(const std::string& f_string)
+    {
+        static_assert(std::is_integral<TValue>::value, "Only integer columns have a numeric value");
+
+        if constexpr (std::is_signed<TValue>::value)
+        {
+            long long value = std::stoll(f_string);
+            if (value < std::numeric_limits<TValue>::min() || value > std::numeric_limits<TValue>::max())
+            {
+                throw std::out_of_range{ "parseColumnValue" };
+            }
+            return static_cast<TValue>(value);
+        }
+        else
+        {
+            auto firstCharacter = f_string.find_first_not_of(" \t\n\v\f\r");
+            if (firstCharacter != std::string::npos && f_string[firstCharacter] == '-' && std::stoll(f_string) != 0)
+            {
+                throw std::out_of_range{ "parseColumnValue" };
+            }
+            unsigned long long value = std::stoull(f_string);
+            if (value > std::numeric_limits<TValue>::max())
+            {
+                throw std::out_of_range{ "parseColumnValue" };
+            }
+            return static_cast<TValue>(value);
+        }
+    }
+
+    /// @class DbColumnMatcher
+    /// @brief Matcher of a string against an integer column.
+    /// @details Converts the string to the type of the column once and compares each record with it.
+    /// The column is known at compile time, so the comparison is inlined in the loop over the records.
+    /// @tparam TColumn The DbColumn descriptor of the matched column.
+    /// @tparam TValue The type of the column values.
+    template <typename TColumn, typename TValue = typename TColumn::ValueType>
+    class DbColumnMatcher
+    {
+        static_assert(std::is_integral<TValue>::value, "Only integer and string columns can be matched");
+
+    public:
+        static constexpr uint32_t cEvaluationCost{ 1 }; ///< Relative cost of matching one record.
+
+        /// @brief Default class constructor.
+        DbColumnMatcher() = default;
+
+        /// @brief Class constructor with arguments.
+        /// @param[in] f_stringToMatch The string representation of the value to be searched for.
+        /// Throws std::out_of_range if the value doesn't fit in the type of the column.
+        explicit DbColumnMatcher(const std::string& f_stringToMatch) :
+            m_valueToMatch{ parseColumnValue<TValue>(f_stringToMatch) }
+        {
+        }
+
+        /// @brief Check if a given record matches the searched value.
+        /// @param[in] f_record The table record to check.
+        /// @returns True if the value of the column is equal to the searched one, false elsewhen.
+        bool operator()(const typename TColumn::TableType& f_record) const
+        {
+            return TColumn::getValue(f_record) == m_valueToMatch;
+        }
+
+    private:
+        TValue m_valueToMatch{}; ///< The value to match against the column.
+    };
+
+    /// @class DbColumnMatcher
+    /// @brief Matcher of a string against a string column.
+    /// @details Checks if the searched string is contained in the value of the column.
+    /// @tparam TColumn The DbColumn descriptor of the matched column.
+    template <typename TColumn>
+    class DbColumnMatcher<TColumn, std::string>
+    {
+    public:
+        static constexpr uint32_t cEvaluationCost{ 16 }; ///< Relative cost of matching one record, higher than comparing integers.
+
+        /// @brief Default class constructor.
+        DbColumnMatcher() = default;
+
+        /// @brief Class constructor with arguments.
+        /// @param[in] f_stringToMatch The string to be searched for.
+        explicit DbColumnMatcher(const std::string& f_stringToMatch) :
+            m_substringSearcher{ f_stringToMatch }
+        {
+        }
+
+        /// @brief Check if a given record matches the searched string.
+        /// @param[in] f_record The table record to check.
+        /// @returns True if the value of the column contains the searched string, false elsewhen.
+        bool operator()(const typename TColumn::TableType& f_record) const
+        {
+            return m_substringSearcher.isFoundIn(TColumn::getValue(f_record));
+        }
+
+    private:
+        DbSubstringSearcher m_substringSearcher; ///< The searcher for the string to match against the column.
+    };
+
+    /// @struct DbTableColumns
+    /// @brief Compile-time list of the columns of a table.
+    /// @details The columns are named by their position - "column0", "column1" and so on.
+    /// @tparam TColumn The DbColumn descriptor of the first column.
+    /// @tparam TColumns The DbColumn descriptors of the rest of the columns, in order.
+    template <typename TColumn, typename... TColumns>
+    struct DbTableColumns
+    {
+        typedef typename TColumn::TableType TableType; ///< The struct of the table records.
+
+        static constexpr size_t cNumberOfColumns{ sizeof...(TColumns) + 1 }; ///< The number of columns in the table.
+
+        /// @brief Call a function with the descriptor of a column selected by name.
+        /// @details Unknown column names select the last column. The function is instantiated
+        /// for each column, so the code it executes is specialized for the type of the column.
+        /// @param[in] f_columnName The name of the column.
+        /// @param[in] f_visitor Function called with a default-constructed object of the column descriptor.
+        template <typename TVisitor>
+        static void visitColumn(const std::string& f_columnName, TVisitor&& f_visitor)
+        {
+            auto columnIndex = getColumnIndex(f_columnName);
+            size_t currentIndex{ 0 };
+            (void)((currentIndex++ == columnIndex && (f_visitor(TColumn{}), true)) ||
+                ... || (currentIndex++ == columnIndex && (f_visitor(TColumns{}), true)));
+        }
+
+        /// @brief Get the position of a column by name.
+        /// @param[in] f_columnName The name of the column.
+        /// @returns The position of the column, or of the last column if the name is not known.
+        static size_t getColumnIndex(const std::string& f_columnName)
+        {
+            for (size_t index = 0; index < cNumberOfColumns; ++index)
+            {
+                if (f_columnName == "column" + std::to_string(index))
+                {
+                    return index;
+                }
+            }
+            return cNumberOfColumns - 1;
+        }
+    };
+
+    template <typename TColumns>
+    class DbTableStringMatcher;
+
+    /// @class DbTableStringMatcher
+    /// @brief String matcher for any column of a table, selected at runtime.
+    /// @details Holds the matcher of the selected column in a variant, so that the records
+    /// can be matched without allocating or calling a function through a pointer.
+    /// Searches over many records should rather use DbTableColumns::visitColumn to
+    /// specialize the whole loop for the selected column.
+    /// @tparam TColumn The DbColumn descriptor of the first column.
+    /// @tparam TColumns The DbColumn descriptors of the rest of the columns, in order.
+    template <typename TColumn, typename... TColumns>
+    class DbTableStringMatcher<DbTableColumns<TColumn, TColumns...>>
+    {
+    public:
+        /// @brief Class constructor with arguments.
+        /// @details Selects the matcher of the column and converts the string to the type of the column.
+        /// @param[in] f_columnName The name of the column which will be searched.
+        /// @param[in] f_stringToMatch The string to be searched for.
+        DbTableStringMatcher(const std::string& f_columnName, const std::string& f_stringToMatch)
+        {
+            DbTableColumns<TColumn, TColumns...>::visitColumn(f_columnName, [&](auto f_column) {
+                m_matcher.template emplace<DbColumnMatcher<decltype(f_column)>>(f_stringToMatch);
+            });
+        }
+
+        /// @brief Check if a given record matches the provided string.
+        /// @param[in] f_record The table record to check for matching strings.
+        /// @returns True if the selected column of the record matches the given string, false elsewhen.
+        bool checkMatching(const typename TColumn::TableType& f_record) const
+        {
+            return std::visit([&](const auto& f_matcher) {
+                return f_matcher(f_record);
+            }, m_matcher);
+        }
+
+        /// @brief Get the relative cost of matching one record.
+        /// @details Used to check the cheap predicates first when several predicates are combined.
+        /// @returns The cost of the matcher of the selected column.
+        uint32_t getEvaluationCost() const
+        {
+            return std::visit([](const auto& f_matcher) {
+                return std::decay_t<decltype(f_matcher)>::cEvaluationCost;
+            }, m_matcher);
+        }
+
+    private:
+        std::variant<DbColumnMatcher<TColumn>, DbColumnMatcher<TColumns>...> m_matcher; ///< The matcher of the selected column.
+    };
+} /// namespace xq
+#endif /// !DB_COLUMN_MATCHER_HPP
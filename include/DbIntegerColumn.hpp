@@ -0,0 +1,718 @@
+/// @file DbIntegerColumn.hpp
+///
+/// @brief Definition of the integer columns of the column-oriented storage.
+/// @details Keeps the integer values either in a plain array or compressed with
+/// frame of reference and bit-packing, and scans both forms without decompressing.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#ifndef DB_INTEGER_COLUMN_HPP
+#define DB_INTEGER_COLUMN_HPP
+
+#include "DbScanKernels.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace xq
+{
+    /// @class DbPackedIntegerColumn
+    /// @brief Integer column compressed with frame of reference and bit-packing.
+    /// @details The values are split in blocks of up to 1024. Each block keeps its smallest value as a reference
+    /// and stores every value as the offset from the reference, using only as many bits as the largest offset
+    /// needs. Dense ascending ids need 10 bits per value instead of 64, because the offsets inside a block
+    /// are the deltas from its first id. Small balances need 7 bits instead of 32.
+    /// Equality and range scans translate the searched values into offsets once per block and compare
+    /// the packed offsets directly. Blocks, which cannot contain the searched values, are skipped.
+    /// A cleared position, like the one of a deleted record, is marked in a bitmap of its block instead of
+    /// storing 0, which would widen the offsets of the whole block. Erasing a value repacks only its block,
+    /// which then holds one value less, so the blocks after it keep their packed values.
+    /// @tparam TValue The type of the values.
+    template<typename TValue>
+    class DbPackedIntegerColumn
+    {
+        static_assert(std::is_integral<TValue>::value && sizeof(TValue) <= sizeof(uint64_t),
+            "The packed column supports only integer values up to 64 bits");
+
+    public:
+        // The maximum number of values in each block
+        static constexpr size_t const cValuesPerBlock{ 1024 };
+        // The largest bit width, whose offsets always fit in 8 bytes starting at their first byte
+        static constexpr uint8_t const cMaximumBitWidthForByteLoad{ 56 };
+
+        /// @brief Store a value at the end of the column.
+        /// @param[in] f_value The value to be stored.
+        void appendValue(TValue f_value)
+        {
+            if (m_blocks.empty() || m_blocks.back().numberOfValues == cValuesPerBlock)
+            {
+                m_blockBegins.emplace_back(m_numberOfValues);
+                m_blocks.push_back({ f_value, 0, 0, DbPackedWordsCollection{}, DbPackedWordsCollection{} });
+            }
+            ++m_numberOfValues;
+            ++m_blocks.back().numberOfValues;
+            storeValue(m_blocks.back(), m_blocks.back().numberOfValues - 1, f_value);
+        }
+
+        /// @brief Store several values at the end of the column.
+        /// @details Packs every full block only once.
+        /// @param[in] f_values Pointer to the first value to be stored.
+        /// @param[in] f_numberOfValues The number of values to be stored.
+        /// @param[in] f_clearedIndexes The ascending positions among the stored values, which are cleared instead.
+        void appendValues(const TValue* f_values, size_t f_numberOfValues,
+            const DbRecordIndexesCollection& f_clearedIndexes = DbRecordIndexesCollection{})
+        {
+            size_t index = 0;
+            auto clearedIter = f_clearedIndexes.begin();
+            // Fill the last block one by one, so that the next ones start with an empty block
+            while (index < f_numberOfValues && !m_blocks.empty() && m_blocks.back().numberOfValues < cValuesPerBlock)
+            {
+                appendValue(f_values[index]);
+                if (clearedIter != f_clearedIndexes.end() && *clearedIter == index)
+                {
+                    clearValue(m_numberOfValues - 1);
+                    ++clearedIter;
+                }
+                ++index;
+            }
+            while (index < f_numberOfValues)
+            {
+                size_t numberOfValues = std::min(cValuesPerBlock, f_numberOfValues - index);
+                DbPackedWordsCollection clearedWords{};
+                for (; clearedIter != f_clearedIndexes.end() && *clearedIter < index + numberOfValues; ++clearedIter)
+                {
+                    setClearedBit(clearedWords, *clearedIter - index);
+                }
+                m_blockBegins.emplace_back(m_numberOfValues);
+                m_blocks.emplace_back();
+                m_numberOfValues += numberOfValues;
+                packBlock(m_blocks.back(), f_values + index, numberOfValues, std::move(clearedWords));
+                index += numberOfValues;
+            }
+        }
+
+        /// @brief Replace the value at a given position.
+        /// @details A cleared position gets the value again.
+        /// @param[in] f_index The position of the value to be replaced.
+        /// @param[in] f_value The value to be stored.
+        void setValue(size_t f_index, TValue f_value)
+        {
+            size_t blockIndex = findBlock(f_index);
+            storeValue(m_blocks[blockIndex], f_index - m_blockBegins[blockIndex], f_value);
+        }
+
+        /// @brief Clear the value at a given position.
+        /// @details The position reads as 0 afterwards, but its block is not packed again.
+        /// @param[in] f_index The position of the value to be cleared.
+        void clearValue(size_t f_index)
+        {
+            size_t blockIndex = findBlock(f_index);
+            setClearedBit(m_blocks[blockIndex].clearedWords, f_index - m_blockBegins[blockIndex]);
+        }
+
+        /// @brief Remove the value at a given position.
+        /// @details All the aftercomming values are shifted. Only the block of the position is packed again,
+        /// the positions of the blocks after it are moved by one.
+        /// @param[in] f_index The position of the value to be removed.
+        void eraseValue(size_t f_index)
+        {
+            size_t blockIndex = findBlock(f_index);
+            auto& block = m_blocks[blockIndex];
+            size_t erasedIndex = f_index - m_blockBegins[blockIndex];
+            --m_numberOfValues;
+            if (blockIndex + 1 != m_blocks.size())
+            {
+                m_hasFullBlocks = false;
+            }
+            for (size_t nextBlock = blockIndex + 1; nextBlock < m_blockBegins.size(); ++nextBlock)
+            {
+                --m_blockBegins[nextBlock];
+            }
+            if (block.numberOfValues == 1)
+            {
+                m_blocks.erase(m_blocks.begin() + static_cast<std::ptrdiff_t>(blockIndex));
+                m_blockBegins.erase(m_blockBegins.begin() + static_cast<std::ptrdiff_t>(blockIndex));
+                return;
+            }
+
+            std::vector<TValue> values{};
+            DbPackedWordsCollection clearedWords{};
+            values.reserve(block.numberOfValues - 1);
+            for (size_t index = 0; index < block.numberOfValues; ++index)
+            {
+                if (index == erasedIndex)
+                {
+                    continue;
+                }
+                if (isCleared(block, index))
+                {
+                    setClearedBit(clearedWords, values.size());
+                }
+                values.emplace_back(fromOffset(readOffset(block, index), block.reference));
+            }
+            packBlock(block, values.data(), values.size(), std::move(clearedWords));
+        }
+
+        /// @brief Get the value at a given position.
+        /// @param[in] f_index The position of the value.
+        /// @returns The value, 0 if the position is cleared.
+        TValue getValue(size_t f_index) const
+        {
+            size_t blockIndex = findBlock(f_index);
+            const auto& block = m_blocks[blockIndex];
+            size_t indexInBlock = f_index - m_blockBegins[blockIndex];
+            return isCleared(block, indexInBlock) ? TValue{ 0 } : fromOffset(readOffset(block, indexInBlock), block.reference);
+        }
+
+        /// @brief Get the number of values in the column.
+        /// @returns The number of values.
+        size_t size() const
+        {
+            return m_numberOfValues;
+        }
+
+        /// @brief Remove all the values.
+        void clear()
+        {
+            m_blocks.clear();
+            m_blockBegins.clear();
+            m_numberOfValues = 0;
+            m_hasFullBlocks = true;
+        }
+
+        /// @brief Find all the values equal to a given one in a range of positions.
+        /// @param[in] f_matchValue The value to search for.
+        /// @param[in] f_begin The first position to check.
+        /// @param[in] f_end The position after the last one to check.
+        /// @param[out] f_output Contains the positions of the matching values.
+        void findEqual(TValue f_matchValue, size_t f_begin, size_t f_end, DbRecordIndexesCollection& f_output) const
+        {
+            findInRange(f_matchValue, f_matchValue, f_begin, f_end, f_output);
+        }
+
+        /// @brief Find all the values between two bounds in a range of positions.
+        /// @details The cleared positions are found as 0.
+        /// @param[in] f_lowerBound The smallest value to be found.
+        /// @param[in] f_upperBound The largest value to be found.
+        /// @param[in] f_begin The first position to check.
+        /// @param[in] f_end The position after the last one to check.
+        /// @param[out] f_output Contains the positions of the matching values.
+        void findInRange(TValue f_lowerBound, TValue f_upperBound, size_t f_begin, size_t f_end,
+            DbRecordIndexesCollection& f_output) const
+        {
+            f_end = std::min(f_end, m_numberOfValues);
+            if (f_begin >= f_end)
+            {
+                return;
+            }
+            for (size_t blockIndex = findBlock(f_begin); blockIndex < m_blocks.size() && m_blockBegins[blockIndex] < f_end; ++blockIndex)
+            {
+                const auto& block = m_blocks[blockIndex];
+                size_t blockBegin = m_blockBegins[blockIndex];
+                size_t first = std::max(f_begin, blockBegin) - blockBegin;
+                size_t last = std::min(f_end, blockBegin + block.numberOfValues) - blockBegin;
+                if (!block.clearedWords.empty())
+                {
+                    // The cleared positions are outside of the frame of the block, so every value is checked
+                    bool isZeroInRange = f_lowerBound <= TValue{ 0 } && TValue{ 0 } <= f_upperBound;
+                    for (size_t index = first; index < last; ++index)
+                    {
+                        TValue value = fromOffset(readOffset(block, index), block.reference);
+                        if (isCleared(block, index) ? isZeroInRange : value >= f_lowerBound && value <= f_upperBound)
+                        {
+                            f_output.emplace_back(blockBegin + index);
+                        }
+                    }
+                    continue;
+                }
+
+                // Skip the block if all its offsets are outside of the searched range
+                uint64_t maximumOffset = getMask(block.bitWidth);
+                if (f_upperBound < block.reference || f_lowerBound > f_upperBound ||
+                    (f_lowerBound > block.reference && toOffset(f_lowerBound, block.reference) > maximumOffset))
+                {
+                    continue;
+                }
+                uint64_t lowerOffset = f_lowerBound > block.reference ? toOffset(f_lowerBound, block.reference) : 0;
+                uint64_t upperOffset = std::min(toOffset(f_upperBound, block.reference), maximumOffset);
+
+                if (block.bitWidth == 0 || block.bitWidth > cMaximumBitWidthForByteLoad)
+                {
+                    for (size_t index = first; index < last; ++index)
+                    {
+                        // Comparing the difference as unsigned checks both bounds at once
+                        if (readOffset(block, index) - lowerOffset <= upperOffset - lowerOffset)
+                        {
+                            f_output.emplace_back(blockBegin + index);
+                        }
+                    }
+                    continue;
+                }
+
+                // Load the 8 bytes starting at the byte of each offset, so that no offset needs two loads.
+                // The words are little-endian on all the supported processors.
+                const auto* bytes = reinterpret_cast<const unsigned char*>(block.words.data());
+                uint64_t mask = getMask(block.bitWidth);
+                for (size_t index = first; index < last; ++index)
+                {
+                    size_t bitPosition = index * block.bitWidth;
+                    uint64_t word{ 0 };
+                    std::memcpy(&word, bytes + bitPosition / 8, sizeof(word));
+                    if (((word >> (bitPosition % 8)) & mask) - lowerOffset <= upperOffset - lowerOffset)
+                    {
+                        f_output.emplace_back(blockBegin + index);
+                    }
+                }
+            }
+        }
+
+        /// @brief Get the memory taken by the packed values.
+        /// @returns The number of bytes of the blocks.
+        size_t getNumberOfBytes() const
+        {
+            size_t numberOfBytes = m_blocks.capacity() * sizeof(DbPackedBlock) + m_blockBegins.capacity() * sizeof(size_t);
+            for (const auto& block : m_blocks)
+            {
+                numberOfBytes += (block.words.capacity() + block.clearedWords.capacity()) * sizeof(uint64_t);
+            }
+            return numberOfBytes;
+        }
+
+    private:
+        // Definition for the Packed Words Collection
+        typedef std::vector<uint64_t> DbPackedWordsCollection;
+
+        /// @struct DbPackedBlock
+        /// @brief Block of packed values.
+        struct DbPackedBlock
+        {
+            TValue reference; ///< The smallest value in the block, which is not cleared.
+            uint8_t bitWidth; ///< The number of bits of every offset.
+            uint32_t numberOfValues; ///< The number of values in the block.
+            DbPackedWordsCollection words; ///< The packed offsets.
+            DbPackedWordsCollection clearedWords; ///< One bit for every cleared position. Empty if none is cleared.
+        };
+
+        /// @brief Get the block containing a given position.
+        /// @param[in] f_index The position.
+        /// @returns The index of the block.
+        size_t findBlock(size_t f_index) const
+        {
+            if (m_hasFullBlocks)
+            {
+                return f_index / cValuesPerBlock;
+            }
+            return static_cast<size_t>(std::upper_bound(m_blockBegins.begin(), m_blockBegins.end(), f_index) -
+                m_blockBegins.begin()) - 1;
+        }
+
+        /// @brief Check if a position of a block is cleared.
+        /// @param[in] f_block The block.
+        /// @param[in] f_index The position in the block.
+        /// @returns True if the position is cleared, false elsewhen.
+        static bool isCleared(const DbPackedBlock& f_block, size_t f_index)
+        {
+            return !f_block.clearedWords.empty() && ((f_block.clearedWords[f_index / 64] >> (f_index % 64)) & 1) != 0;
+        }
+
+        /// @brief Mark a position of a block as cleared.
+        /// @param[in,out] f_clearedWords The bitmap of the cleared positions of the block.
+        /// @param[in] f_index The position in the block.
+        static void setClearedBit(DbPackedWordsCollection& f_clearedWords, size_t f_index)
+        {
+            if (f_clearedWords.empty())
+            {
+                f_clearedWords.assign(cValuesPerBlock / 64, 0);
+            }
+            f_clearedWords[f_index / 64] |= uint64_t{ 1 } << (f_index % 64);
+        }
+
+        /// @brief Get the mask of the lowest bits of a word.
+        /// @param[in] f_bitWidth The number of bits.
+        /// @returns The mask.
+        static uint64_t getMask(uint8_t f_bitWidth)
+        {
+            return f_bitWidth >= 64 ? ~uint64_t{ 0 } : (uint64_t{ 1 } << f_bitWidth) - 1;
+        }
+
+        /// @brief Get the offset of a value from a reference. The value shall not be less than the reference.
+        /// @param[in] f_value The value.
+        /// @param[in] f_reference The reference.
+        /// @returns The offset.
+        static uint64_t toOffset(TValue f_value, TValue f_reference)
+        {
+            // The conversion to unsigned wraps the signed values, so the difference is still correct
+            return static_cast<uint64_t>(f_value) - static_cast<uint64_t>(f_reference);
+        }
+
+        /// @brief Get the value with a given offset from a reference.
+        /// @param[in] f_offset The offset.
+        /// @param[in] f_reference The reference.
+        /// @returns The value.
+        static TValue fromOffset(uint64_t f_offset, TValue f_reference)
+        {
+            return static_cast<TValue>(static_cast<uint64_t>(f_reference) + f_offset);
+        }
+
+        /// @brief Read the offset at a given position in a block.
+        /// @param[in] f_block The block.
+        /// @param[in] f_index The position in the block.
+        /// @returns The offset.
+        static uint64_t readOffset(const DbPackedBlock& f_block, size_t f_index)
+        {
+            if (f_block.bitWidth == 0)
+            {
+                return 0;
+            }
+            size_t bitPosition = f_index * f_block.bitWidth;
+            size_t wordIndex = bitPosition / 64;
+            size_t shift = bitPosition % 64;
+            uint64_t offset = f_block.words[wordIndex] >> shift;
+            // The offset continues in the next word
+            if (shift + f_block.bitWidth > 64)
+            {
+                offset |= f_block.words[wordIndex + 1] << (64 - shift);
+            }
+            return offset & getMask(f_block.bitWidth);
+        }
+
+        /// @brief Write the offset at a given position in a block. The offset shall fit in the bit width of the block.
+        /// @param[in,out] f_block The block.
+        /// @param[in] f_index The position in the block.
+        /// @param[in] f_offset The offset.
+        static void writeOffset(DbPackedBlock& f_block, size_t f_index, uint64_t f_offset)
+        {
+            if (f_block.bitWidth == 0)
+            {
+                return;
+            }
+            uint64_t mask = getMask(f_block.bitWidth);
+            size_t bitPosition = f_index * f_block.bitWidth;
+            size_t wordIndex = bitPosition / 64;
+            size_t shift = bitPosition % 64;
+            f_block.words[wordIndex] = (f_block.words[wordIndex] & ~(mask << shift)) | (f_offset << shift);
+            if (shift + f_block.bitWidth > 64)
+            {
+                f_block.words[wordIndex + 1] = (f_block.words[wordIndex + 1] & ~(mask >> (64 - shift))) |
+                    (f_offset >> (64 - shift));
+            }
+        }
+
+        /// @brief Store a value at a position of a block, packing the block again if the value does not fit in it.
+        /// @param[in,out] f_block The block.
+        /// @param[in] f_index The position in the block.
+        /// @param[in] f_value The value.
+        static void storeValue(DbPackedBlock& f_block, size_t f_index, TValue f_value)
+        {
+            if (isCleared(f_block, f_index))
+            {
+                f_block.clearedWords[f_index / 64] &= ~(uint64_t{ 1 } << (f_index % 64));
+                if (std::all_of(f_block.clearedWords.begin(), f_block.clearedWords.end(), [](uint64_t f_word) { return f_word == 0; }))
+                {
+                    f_block.clearedWords = DbPackedWordsCollection{};
+                }
+            }
+            if (f_value >= f_block.reference && toOffset(f_value, f_block.reference) <= getMask(f_block.bitWidth))
+            {
+                writeOffset(f_block, f_index, toOffset(f_value, f_block.reference));
+                return;
+            }
+
+            std::vector<TValue> values(f_block.numberOfValues);
+            for (size_t index = 0; index < values.size(); ++index)
+            {
+                values[index] = index == f_index ? f_value : fromOffset(readOffset(f_block, index), f_block.reference);
+            }
+            DbPackedWordsCollection clearedWords = std::move(f_block.clearedWords);
+            packBlock(f_block, values.data(), values.size(), std::move(clearedWords));
+        }
+
+        /// @brief Pack values into a block, choosing the reference and the bit width from the values, which are not cleared.
+        /// @param[out] f_block The block.
+        /// @param[in] f_values Pointer to the first value.
+        /// @param[in] f_numberOfValues The number of values. Shall be between 1 and the number of values per block.
+        /// @param[in] f_clearedWords The bitmap of the cleared positions. Empty if none is cleared.
+        static void packBlock(DbPackedBlock& f_block, const TValue* f_values, size_t f_numberOfValues,
+            DbPackedWordsCollection&& f_clearedWords)
+        {
+            f_block.numberOfValues = static_cast<uint32_t>(f_numberOfValues);
+            f_block.clearedWords = std::move(f_clearedWords);
+            bool hasValue{ false };
+            TValue minimum{ 0 };
+            TValue maximum{ 0 };
+            for (size_t index = 0; index < f_numberOfValues; ++index)
+            {
+                if (!isCleared(f_block, index))
+                {
+                    minimum = hasValue ? std::min(minimum, f_values[index]) : f_values[index];
+                    maximum = hasValue ? std::max(maximum, f_values[index]) : f_values[index];
+                    hasValue = true;
+                }
+            }
+            uint64_t maximumOffset = toOffset(maximum, minimum);
+            uint8_t bitWidth{ 0 };
+            while (bitWidth < 64 && (maximumOffset >> bitWidth) != 0)
+            {
+                ++bitWidth;
+            }
+
+            // One more word lets the scans read any offset with a single unaligned load
+            f_block.reference = minimum;
+            f_block.bitWidth = bitWidth;
+            f_block.words.assign(bitWidth == 0 ? 0 : cValuesPerBlock * bitWidth / 64 + 1, 0);
+            for (size_t index = 0; index < f_numberOfValues; ++index)
+            {
+                if (!isCleared(f_block, index))
+                {
+                    writeOffset(f_block, index, toOffset(f_values[index], f_block.reference));
+                }
+            }
+        }
+
+        std::vector<DbPackedBlock> m_blocks; ///< The blocks with the packed values.
+        std::vector<size_t> m_blockBegins; ///< The position of the first value of every block.
+        size_t m_numberOfValues{ 0 }; ///< The number of values in the column.
+        bool m_hasFullBlocks{ true }; ///< True if all the blocks but the last one are full, so no search for a block is needed.
+    };
+
+    /// @class DbIntegerColumn
+    /// @brief Integer column of the column-oriented storage.
+    /// @details Keeps the values in a plain array, which is scanned by the vectorized scan kernels.
+    /// After the compression is enabled, the values are kept in a DbPackedIntegerColumn instead.
+    /// The plain values can also be an array owned by someone else, like a mapped snapshot file,
+    /// which is used in place until the first modification copies it.
+    /// @tparam TValue The type of the values.
+    template<typename TValue>
+    class DbIntegerColumn
+    {
+    public:
+        // Definition for the Plain Values Collection
+        typedef std::vector<TValue> DbPlainValuesCollection;
+
+        /// @brief Store a value at the end of the column.
+        /// @param[in] f_value The value to be stored.
+        void appendValue(TValue f_value)
+        {
+            if (m_isCompressed)
+            {
+                m_packedValues.appendValue(f_value);
+                return;
+            }
+            copyMappedValues();
+            m_plainValues.emplace_back(f_value);
+        }
+
+        /// @brief Replace all the values with an array, which is used in place.
+        /// @details A compressed column packs the values instead.
+        /// @param[in] f_values Pointer to the first value. Shall stay valid until the column is modified or cleared.
+        /// @param[in] f_numberOfValues The number of values.
+        void mapValues(const TValue* f_values, size_t f_numberOfValues)
+        {
+            clear();
+            if (m_isCompressed)
+            {
+                m_packedValues.appendValues(f_values, f_numberOfValues);
+                return;
+            }
+            m_plainValues = DbPlainValuesCollection{};
+            m_mappedValues = f_values;
+            m_numberOfMappedValues = f_numberOfValues;
+        }
+
+        /// @brief Replace the value at a given position.
+        /// @param[in] f_index The position of the value to be replaced.
+        /// @param[in] f_value The value to be stored.
+        void setValue(size_t f_index, TValue f_value)
+        {
+            if (m_isCompressed)
+            {
+                m_packedValues.setValue(f_index, f_value);
+                return;
+            }
+            copyMappedValues();
+            m_plainValues[f_index] = f_value;
+        }
+
+        /// @brief Clear the value at a given position, so that it reads as 0.
+        /// @details A compressed column marks the position instead of packing 0 into its block.
+        /// @param[in] f_index The position of the value to be cleared.
+        void clearValue(size_t f_index)
+        {
+            if (m_isCompressed)
+            {
+                m_packedValues.clearValue(f_index);
+                return;
+            }
+            copyMappedValues();
+            m_plainValues[f_index] = TValue{ 0 };
+        }
+
+        /// @brief Remove the value at a given position.
+        /// @details All the aftercomming values are shifted.
+        /// @param[in] f_index The position of the value to be removed.
+        void eraseValue(size_t f_index)
+        {
+            if (m_isCompressed)
+            {
+                m_packedValues.eraseValue(f_index);
+                return;
+            }
+            copyMappedValues();
+            m_plainValues.erase(m_plainValues.begin() + static_cast<std::ptrdiff_t>(f_index));
+        }
+
+        /// @brief Get the value at a given position.
+        /// @param[in] f_index The position of the value.
+        /// @returns The value.
+        TValue getValue(size_t f_index) const
+        {
+            return m_isCompressed ? m_packedValues.getValue(f_index) : getPlainValues()[f_index];
+        }
+
+        /// @brief Reserve memory for a given number of values.
+        /// @details Has no effect on a compressed column.
+        /// @param[in] f_numberOfValues The number of values to reserve memory for.
+        void reserve(size_t f_numberOfValues)
+        {
+            if (!m_isCompressed)
+            {
+                copyMappedValues();
+                m_plainValues.reserve(f_numberOfValues);
+            }
+        }
+
+        /// @brief Remove all the values. The compression is kept.
+        void clear()
+        {
+            m_plainValues.clear();
+            m_mappedValues = nullptr;
+            m_numberOfMappedValues = 0;
+            m_packedValues.clear();
+        }
+
+        /// @brief Get the number of values in the column.
+        /// @returns The number of values.
+        size_t size() const
+        {
+            if (m_isCompressed)
+            {
+                return m_packedValues.size();
+            }
+            return m_mappedValues != nullptr ? m_numberOfMappedValues : m_plainValues.size();
+        }
+
+        /// @brief Compress the current and the future values of the column.
+        /// @param[in] f_clearedIndexes The ascending positions, which are cleared instead of packed.
+        void enableCompression(const DbRecordIndexesCollection& f_clearedIndexes = DbRecordIndexesCollection{})
+        {
+            if (m_isCompressed)
+            {
+                return;
+            }
+            m_packedValues.appendValues(getPlainValues(), size(), f_clearedIndexes);
+            m_plainValues = DbPlainValuesCollection{};
+            m_mappedValues = nullptr;
+            m_numberOfMappedValues = 0;
+            m_isCompressed = true;
+        }
+
+        /// @brief Check if the column is compressed.
+        /// @returns True if the values are packed, false elsewhen.
+        bool isCompressed() const
+        {
+            return m_isCompressed;
+        }
+
+        /// @brief Get the plain values for the scans combining several columns.
+        /// @returns Pointer to the first value, nullptr if the column is compressed.
+        const TValue* getPlainValues() const
+        {
+            if (m_isCompressed)
+            {
+                return nullptr;
+            }
+            return m_mappedValues != nullptr ? m_mappedValues : m_plainValues.data();
+        }
+
+        /// @brief Find all the values equal to a given one in a range of positions.
+        /// @param[in] f_scanKernels The scan kernels for the plain values.
+        /// @param[in] f_matchValue The value to search for.
+        /// @param[in] f_begin The first position to check.
+        /// @param[in] f_end The position after the last one to check.
+        /// @param[out] f_output Contains the positions of the matching values.
+        void findEqual(const DbScanKernels& f_scanKernels, TValue f_matchValue, size_t f_begin, size_t f_end,
+            DbRecordIndexesCollection& f_output) const
+        {
+            if (m_isCompressed)
+            {
+                m_packedValues.findEqual(f_matchValue, f_begin, f_end, f_output);
+                return;
+            }
+
+            // The kernels return the positions relative to the first checked value
+            size_t firstFound = f_output.size();
+            f_scanKernels.findEqual(getPlainValues() + f_begin, f_end - f_begin, f_matchValue, f_output);
+            for (size_t index = firstFound; index < f_output.size(); ++index)
+            {
+                f_output[index] += f_begin;
+            }
+        }
+
+        /// @brief Find all the values between two bounds in a range of positions.
+        /// @param[in] f_lowerBound The smallest value to be found.
+        /// @param[in] f_upperBound The largest value to be found.
+        /// @param[in] f_begin The first position to check.
+        /// @param[in] f_end The position after the last one to check.
+        /// @param[out] f_output Contains the positions of the matching values.
+        void findInRange(TValue f_lowerBound, TValue f_upperBound, size_t f_begin, size_t f_end,
+            DbRecordIndexesCollection& f_output) const
+        {
+            if (m_isCompressed)
+            {
+                m_packedValues.findInRange(f_lowerBound, f_upperBound, f_begin, f_end, f_output);
+                return;
+            }
+            const TValue* values = getPlainValues();
+            for (size_t index = f_begin; index < f_end; ++index)
+            {
+                if (values[index] >= f_lowerBound && values[index] <= f_upperBound)
+                {
+                    f_output.emplace_back(index);
+                }
+            }
+        }
+
+        /// @brief Get the memory taken by the values.
+        /// @returns The number of bytes of the plain or the packed values. 0 for the values used in place.
+        size_t getNumberOfBytes() const
+        {
+            return m_isCompressed ? m_packedValues.getNumberOfBytes() : m_plainValues.capacity() * sizeof(TValue);
+        }
+
+    private:
+        /// @brief Copy the values used in place into the own array before they are modified.
+        void copyMappedValues()
+        {
+            if (m_mappedValues != nullptr)
+            {
+                m_plainValues.assign(m_mappedValues, m_mappedValues + m_numberOfMappedValues);
+                m_mappedValues = nullptr;
+                m_numberOfMappedValues = 0;
+            }
+        }
+
+        bool m_isCompressed{ false }; ///< If true, the values are packed.
+        DbPlainValuesCollection m_plainValues; ///< The values when the column is not compressed.
+        const TValue* m_mappedValues{ nullptr }; ///< The values used in place, nullptr if the own array is used.
+        size_t m_numberOfMappedValues{ 0 }; ///< The number of values used in place.
+        DbPackedIntegerColumn<TValue> m_packedValues; ///< The values when the column is compressed.
+    };
+} /// namespace xq
+#endif /// !DB_INTEGER_COLUMN_HPP
@@ -0,0 +1,64 @@
+/// @file DbMappedFile.hpp
+///
+/// @brief Definition of the read-only memory mapping of a file.
+/// @details Maps the whole content of a file into the address space of the process,
+/// so that it can be read in place without copying it into buffers.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#ifndef DB_MAPPED_FILE_HPP
+#define DB_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <string>
+
+namespace xq
+{
+    /// @class DbMappedFile
+    /// @brief Read-only memory mapping of a whole file.
+    /// @details The pages of the file are loaded by the operating system when they are first read,
+    /// so opening even a large file takes only a few system calls. Uses mmap on POSIX systems
+    /// and a file mapping object on Windows. The mapping is released by the destructor.
+    class DbMappedFile
+    {
+    public:
+        /// @brief Default class constructor.
+        DbMappedFile() = default;
+
+        /// @brief Class destructor.
+        /// @details Releases the mapping, if any.
+        ~DbMappedFile();
+
+        DbMappedFile(const DbMappedFile&) = delete;
+        DbMappedFile& operator=(const DbMappedFile&) = delete;
+
+        /// @brief Map a file.
+        /// @details Releases the previous mapping, if any.
+        /// @param[in] f_path The path of the file.
+        /// @returns True if the file was mapped, false if it could not be opened or is empty.
+        bool open(const std::string& f_path);
+
+        /// @brief Release the mapping.
+        void close();
+
+        /// @brief Get the content of the mapped file.
+        /// @returns Pointer to the first byte, or nullptr if no file is mapped.
+        const unsigned char* getData() const;
+
+        /// @brief Get the size of the mapped file.
+        /// @returns The number of bytes.
+        size_t getSize() const;
+
+    private:
+        const unsigned char* m_data{ nullptr }; ///< The first byte of the mapping.
+        size_t m_size{ 0 }; ///< The number of mapped bytes.
+#if defined(_WIN32)
+        void* m_fileHandle{ nullptr }; ///< The handle of the opened file.
+        void* m_mappingHandle{ nullptr }; ///< The handle of the file mapping object.
+#endif
+    };
+} /// namespace xq
+#endif /// !DB_MAPPED_FILE_HPP
@@ -0,0 +1,54 @@
+/// @file DbQuery.hpp
+///
+/// @brief Definition of the query combining several search predicates.
+/// @details A query holds several column predicates, which all have to match
+/// for a record to be found.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#ifndef DB_QUERY_HPP
+#define DB_QUERY_HPP
+
+#include <string>
+#include <vector>
+
+namespace xq
+{
+    /// @struct DbQueryPredicate
+    /// @brief Search for a given string in a given column.
+    /// @details Has the same meaning as the arguments of InMemoryDb::findMatchingRecords.
+    struct DbQueryPredicate
+    {
+        std::string columnName; ///< The name of the column to search in.
+        std::string matchString; ///< The string to search for.
+    };
+
+    // Definition for the Query Predicates Collection
+    typedef std::vector<DbQueryPredicate> DbQueryPredicatesCollection;
+
+    /// @class DbQuery
+    /// @brief Conjunction of several search predicates.
+    /// @details A record matches the query if it matches all of its predicates. The database decides
+    /// in which order to check the predicates, so the order in which they are added doesn't matter.
+    /// A query without predicates matches all the records.
+    class DbQuery
+    {
+    public:
+        /// @brief Add a predicate to the query.
+        /// @param[in] f_columnName The name of the column to search in.
+        /// @param[in] f_matchString The string to search for.
+        /// @returns The query itself, so that several predicates can be added in one statement.
+        DbQuery& addPredicate(const std::string& f_columnName, const std::string& f_matchString);
+
+        /// @brief Get all the predicates of the query.
+        /// @returns The predicates in the order they were added.
+        const DbQueryPredicatesCollection& getPredicates() const;
+
+    private:
+        DbQueryPredicatesCollection m_predicates; ///< The predicates, which all have to match.
+    };
+} /// namespace xq
+#endif /// !DB_QUERY_HPP
@@ -0,0 +1,111 @@
+/// @file DbQueryCache.hpp
+///
+/// @brief Definition of the cache of the search results.
+/// @details Keeps the positions of the records found by recent searches, so that a repeated
+/// search between two modifications of the records doesn't scan the records again.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#ifndef DB_QUERY_CACHE_HPP
+#define DB_QUERY_CACHE_HPP
+
+#include "DbScanKernels.hpp"
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace xq
+{
+    // Definition for the Cached Result, shared by the cache and the searches reading it
+    typedef std::shared_ptr<const DbRecordIndexesCollection> DbCachedResult;
+
+    /// @class DbQueryCache
+    /// @brief Bounded least-recently-used cache of the search results.
+    /// @details Maps a normalized search to the positions of the found records. The size of an entry is the number
+    /// of its positions plus one, so that the empty results are bounded too. When the total size is over the limit,
+    /// the least recently used entries are dropped. Every result is stored with the version of the records, which
+    /// the database changes with every modification of the records. The first access with a newer version drops all
+    /// the entries, so a modification costs nothing until the next search. The cache is guarded by a mutex, as the
+    /// searches of a database might run in parallel. The results are shared, so the mutex is held only to find them.
+    class DbQueryCache
+    {
+    public:
+        /// @brief Class constructor with arguments.
+        /// @param[in] f_maximumSize The maximum total size of the entries.
+        explicit DbQueryCache(size_t f_maximumSize);
+
+        DbQueryCache(const DbQueryCache&) = delete;
+        DbQueryCache& operator=(const DbQueryCache&) = delete;
+
+        /// @brief Find the result of a search.
+        /// @details Counts a hit or a miss and marks the found entry as the most recently used one.
+        /// @param[in] f_key The normalized search.
+        /// @param[in] f_version The current version of the records.
+        /// @param[out] f_result The positions of the found records.
+        /// @returns True if the result was found, false elsewhen.
+        bool findResult(const std::string& f_key, uint64_t f_version, DbCachedResult& f_result);
+
+        /// @brief Store the result of a search.
+        /// @details A result larger than the whole cache or of an older version is not stored.
+        /// @param[in] f_key The normalized search.
+        /// @param[in] f_version The version of the records, which were searched.
+        /// @param[in] f_result The positions of the found records.
+        void storeResult(const std::string& f_key, uint64_t f_version, DbCachedResult f_result);
+
+        /// @brief Get the number of searches answered by the cache.
+        /// @returns The number of hits.
+        uint64_t getNumberOfHits() const;
+
+        /// @brief Get the number of searches not answered by the cache.
+        /// @returns The number of misses.
+        uint64_t getNumberOfMisses() const;
+
+        /// @brief Get the number of cached results.
+        /// @returns The number of entries.
+        size_t getNumberOfEntries() const;
+
+    private:
+        /// @struct DbCacheEntry
+        /// @brief A cached result with its key.
+        struct DbCacheEntry
+        {
+            std::string key; ///< The normalized search.
+            DbCachedResult result; ///< The positions of the found records.
+        };
+
+        // Definitions for the Cache Entries Collections. The lookup refers to the keys of the entries in the list.
+        typedef std::list<DbCacheEntry> DbCacheEntriesCollection;
+        typedef std::unordered_map<std::string_view, DbCacheEntriesCollection::iterator> DbCacheLookupCollection;
+
+        /// @brief Drop all the entries, if the records changed since they were stored.
+        /// @param[in] f_version The current version of the records.
+        void dropOutdatedEntries(uint64_t f_version);
+
+        /// @brief Drop an entry.
+        /// @param[in] f_entry The entry to be dropped.
+        void dropEntry(DbCacheEntriesCollection::iterator f_entry);
+
+        /// @brief Get the size of an entry counted against the limit.
+        /// @param[in] f_result The result of the entry.
+        /// @returns The number of positions plus one.
+        static size_t getEntrySize(const DbCachedResult& f_result);
+
+        mutable std::mutex m_mutex; ///< Guards all the other members.
+        size_t m_maximumSize; ///< The maximum total size of the entries.
+        size_t m_size{ 0 }; ///< The total size of the entries.
+        uint64_t m_version{ 0 }; ///< The version of the records of the cached results.
+        uint64_t m_numberOfHits{ 0 }; ///< The number of searches answered by the cache.
+        uint64_t m_numberOfMisses{ 0 }; ///< The number of searches not answered by the cache.
+        DbCacheEntriesCollection m_entries; ///< The entries, the most recently used first.
+        DbCacheLookupCollection m_lookup; ///< The entries by their key.
+    };
+} /// namespace xq
+#endif /// !DB_QUERY_CACHE_HPP
@@ -0,0 +1,80 @@
+/// @file DbRecordCursor.hpp
+///
+/// @brief Definition of the cursor over the records found by a query.
+/// @details Finds the matching records while the caller pulls them, instead of
+/// searching all the records before the caller sees the first one.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#ifndef DB_RECORD_CURSOR_HPP
+#define DB_RECORD_CURSOR_HPP
+
+#include "DbScanKernels.hpp"
+#include "DbTableTest.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace xq
+{
+    // Definition for the Cursor Matchers Collection
+    typedef std::vector<DbTableTestStringMatcher> DbTableTestMatchersCollection;
+
+    /// @class DbRecordCursor
+    /// @brief Pull-based iterator over the records matching a query.
+    /// @details Keeps the position of the scan and checks the next records only when more of them are requested,
+    /// so the first record is returned as soon as it is found and a limited query stops at its last record.
+    /// If the query was answered by an index, the cursor walks the candidates of the index instead of all the records.
+    /// The cursor reads the records of the database directly, so it is valid only until the database is modified.
+    class DbRecordCursor
+    {
+    public:
+        // Limit of a cursor returning all the matching records
+        static constexpr size_t const cNoLimit{ std::numeric_limits<size_t>::max() };
+
+        /// @brief Class constructor with arguments.
+        /// @details Created by InMemoryDb::openCursor.
+        /// @param[in] f_records The records of the database.
+        /// @param[in] f_matchers The matchers, which all have to match a record.
+        /// @param[in] f_candidateIndexes The positions of the records found by an index.
+        /// @param[in] f_hasCandidates If true, only the candidates are checked, elsewhen all the records.
+        /// @param[in] f_limit The maximum number of records returned by the cursor.
+        DbRecordCursor(const DbTestRecordCollection& f_records, DbTableTestMatchersCollection&& f_matchers,
+            DbRecordIndexesCollection&& f_candidateIndexes, bool f_hasCandidates, size_t f_limit);
+
+        /// @brief Get the next matching record.
+        /// @returns Pointer to the record or nullptr if there are no more records or the limit is reached.
+        const DbTableTest* next();
+
+        /// @brief Get the next batch of matching records.
+        /// @details Replaces the content of the batch, so that the same collection can be reused for every batch
+        /// without allocating memory again.
+        /// @param[out] f_batch Contains the next records, at most f_maximumBatchSize of them.
+        /// @param[in] f_maximumBatchSize The maximum number of records in the batch.
+        /// @returns The number of records in the batch. 0 if there are no more records.
+        size_t fetch(DbTestRecordPointersCollection& f_batch, size_t f_maximumBatchSize);
+
+        /// @brief Check if all the matching records were returned.
+        /// @details Might be false, although no more records match, until the rest of the records is checked.
+        /// @returns True if the cursor reached the end of the records or the limit, false elsewhen.
+        bool isExhausted() const;
+
+    private:
+        /// @brief Find the position of the next matching record.
+        /// @param[out] f_index The position of the record.
+        /// @returns True if a record was found, false if the end of the records or the limit is reached.
+        bool findNext(size_t& f_index);
+
+        const DbTestRecordCollection* m_records; ///< The records of the database.
+        DbTableTestMatchersCollection m_matchers; ///< The matchers of the predicates not answered by an index.
+        DbRecordIndexesCollection m_candidateIndexes; ///< The positions of the records found by an index.
+        bool m_hasCandidates; ///< If true, only the candidates are checked.
+        size_t m_position{ 0 }; ///< The next record or candidate to be checked.
+        size_t m_remainingLimit; ///< The number of records, which can still be returned.
+    };
+} /// namespace xq
+#endif /// !DB_RECORD_CURSOR_HPP
@@ -0,0 +1,131 @@
+/// @file DbResultSet.hpp
+///
+/// @brief Definition of the result set of the searches.
+/// @details Stores the positions of the found records in a bitmap with one bit
+/// per record, so that the results of several searches can be combined cheaply.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#ifndef DB_RESULT_SET_HPP
+#define DB_RESULT_SET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace xq
+{
+    // Definition for the Result Set Words Collection
+    typedef std::vector<uint64_t> DbResultSetWordsCollection;
+
+    /// @class DbResultSet
+    /// @brief Bitmap of the records found by a search.
+    /// @details Bit i is set if the record at position i was found. For 1000000 records the bitmap takes
+    /// 125KB independent of the number of found records, while a vector of pointers to all the records takes 8MB.
+    /// The positions stay valid when new records are added, unlike the pointers to the records.
+    /// The bitmap can be reused between searches without allocating again.
+    class DbResultSet
+    {
+    public:
+        /// @class ConstIterator
+        /// @brief Iterator over the positions of the found records in ascending order.
+        class ConstIterator
+        {
+        public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef size_t value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const size_t* pointer;
+            typedef size_t reference;
+
+            /// @brief Class constructor with arguments.
+            /// @param[in] f_words The words of the bitmap.
+            /// @param[in] f_wordIndex The word to start searching for a set bit from.
+            ConstIterator(const DbResultSetWordsCollection* f_words, size_t f_wordIndex);
+
+            /// @brief Get the position of the current record.
+            /// @returns The position of the record.
+            size_t operator*() const;
+
+            /// @brief Advance to the next found record.
+            /// @returns The iterator itself.
+            ConstIterator& operator++();
+
+            /// @brief Check if two iterators point to the same record.
+            /// @param[in] f_other The iterator to compare with.
+            /// @returns True if both iterators point to the same record, false elsewhen.
+            bool operator==(const ConstIterator& f_other) const;
+
+            /// @brief Check if two iterators point to different records.
+            /// @param[in] f_other The iterator to compare with.
+            /// @returns True if the iterators point to different records, false elsewhen.
+            bool operator!=(const ConstIterator& f_other) const;
+
+        private:
+            /// @brief Skip the words without set bits.
+            void skipEmptyWords();
+
+            const DbResultSetWordsCollection* m_words; ///< The words of the iterated bitmap.
+            size_t m_wordIndex; ///< The index of the current word.
+            uint64_t m_remainingBits; ///< The bits of the current word, which are not iterated yet.
+        };
+
+        /// @brief Default class constructor.
+        DbResultSet() = default;
+
+        /// @brief Class constructor with arguments.
+        /// @param[in] f_numberOfRecords The number of records, which might be found.
+        explicit DbResultSet(size_t f_numberOfRecords);
+
+        /// @brief Remove all the found records and set the number of records, which might be found.
+        /// @details Keeps the allocated memory, so that the result set can be reused for another search.
+        /// @param[in] f_numberOfRecords The number of records, which might be found.
+        void reset(size_t f_numberOfRecords);
+
+        /// @brief Add a found record.
+        /// @param[in] f_index The position of the record. Has to be less than the number of records.
+        void addRecord(size_t f_index);
+
+        /// @brief Check if a record was found.
+        /// @param[in] f_index The position of the record.
+        /// @returns True if the record was found, false elsewhen.
+        bool containsRecord(size_t f_index) const;
+
+        /// @brief Get the number of found records.
+        /// @returns The number of set bits.
+        size_t count() const;
+
+        /// @brief Check if no record was found.
+        /// @returns True if no bit is set, false elsewhen.
+        bool empty() const;
+
+        /// @brief Keep only the records found in both result sets.
+        /// @param[in] f_other The result set to intersect with.
+        void intersectWith(const DbResultSet& f_other);
+
+        /// @brief Add the records found in another result set.
+        /// @param[in] f_other The result set to unite with.
+        void uniteWith(const DbResultSet& f_other);
+
+        /// @brief Get the number of records, which might be found.
+        /// @returns The number of bits in the bitmap.
+        size_t getNumberOfRecords() const;
+
+        /// @brief Get an iterator to the first found record.
+        /// @returns The iterator.
+        ConstIterator begin() const;
+
+        /// @brief Get an iterator after the last found record.
+        /// @returns The iterator.
+        ConstIterator end() const;
+
+    private:
+        DbResultSetWordsCollection m_words; ///< The words of the bitmap.
+        size_t m_numberOfRecords{ 0 }; ///< The number of records, which might be found.
+    };
+} /// namespace xq
+#endif /// !DB_RESULT_SET_HPP
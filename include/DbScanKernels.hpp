@@ -0,0 +1,100 @@
+/// @file DbScanKernels.hpp
+///
+/// @brief Definition of the vectorized scan kernels for the integer columns.
+/// @details Provides equality scans and aggregations over contiguous integer columns, which process
+/// several values per instruction using AVX2 or SSE4.2 when the processor supports them.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#ifndef DB_SCAN_KERNELS_HPP
+#define DB_SCAN_KERNELS_HPP
+
+#include "DbAggregate.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace xq
+{
+    // Definition for the collection of positions of the records found by a scan
+    typedef std::vector<size_t> DbRecordIndexesCollection;
+
+    /// @enum DbScanKernelType
+    /// @brief Different implementations of the scan kernels.
+    /// @var DbScanKernelType::Scalar
+    /// Compares one value at a time. Available on every processor.
+    /// @var DbScanKernelType::Sse42
+    /// Compares 16 values per loop iteration using 128-bit SSE4.2 instructions.
+    /// @var DbScanKernelType::Avx2
+    /// Compares 16 values per loop iteration using 256-bit AVX2 instructions.
+    enum class DbScanKernelType : uint8_t
+    {
+        Scalar,
+        Sse42,
+        Avx2
+    };
+
+    /// @class DbScanKernels
+    /// @brief Equality scans over contiguous integer columns.
+    /// @details Compares the values of a column against a given value and stores the positions
+    /// of the matching values. The vectorized kernels produce a bitmask of the matches for a whole
+    /// block of values, which is then compacted into positions. The implementation is selected
+    /// once when the object is constructed, depending on the instructions supported by the processor.
+    class DbScanKernels
+    {
+    public:
+        /// @brief Class constructor.
+        /// @details Selects the fastest implementation supported by the processor.
+        DbScanKernels();
+
+        /// @brief Class constructor with arguments.
+        /// @details Selects the requested implementation. If it is not supported by the processor,
+        /// selects the fastest one which is supported.
+        /// @param[in] f_kernelType The requested implementation.
+        explicit DbScanKernels(DbScanKernelType f_kernelType);
+
+        /// @brief Find all the values equal to a given one in an id column.
+        /// @param[in] f_values Pointer to the first value of the column.
+        /// @param[in] f_numberOfValues The number of values in the column.
+        /// @param[in] f_matchValue The value to search for.
+        /// @param[out] f_output Contains the positions of the matching values.
+        void findEqual(const uint64_t* f_values, size_t f_numberOfValues, uint64_t f_matchValue,
+            DbRecordIndexesCollection& f_output) const;
+
+        /// @brief Find all the values equal to a given one in a balance column.
+        /// @param[in] f_values Pointer to the first value of the column.
+        /// @param[in] f_numberOfValues The number of values in the column.
+        /// @param[in] f_matchValue The value to search for.
+        /// @param[out] f_output Contains the positions of the matching values.
+        void findEqual(const int32_t* f_values, size_t f_numberOfValues, int32_t f_matchValue,
+            DbRecordIndexesCollection& f_output) const;
+
+        /// @brief Aggregate the values of a balance column, skipping the deleted records.
+        /// @details The vectorized kernels widen the values to 64 bits and keep one partial sum, count,
+        /// minimum and maximum per lane, which are combined once at the end. The deleted records are
+        /// masked out with the id column, as a deleted record has ID 0.
+        /// @param[in] f_values Pointer to the first value of the column.
+        /// @param[in] f_ids Pointer to the id of the first record.
+        /// @param[in] f_numberOfValues The number of values in the column.
+        /// @param[in,out] f_aggregate The aggregate, to which the values are added.
+        void aggregate(const int32_t* f_values, const uint64_t* f_ids, size_t f_numberOfValues,
+            DbAggregate& f_aggregate) const;
+
+        /// @brief Get the selected implementation.
+        /// @returns The implementation used by the scans.
+        DbScanKernelType getKernelType() const;
+
+        /// @brief Check if an implementation is supported by the processor.
+        /// @param[in] f_kernelType The implementation to check.
+        /// @returns True if the implementation can be used, false elsewhen.
+        static bool isKernelSupported(DbScanKernelType f_kernelType);
+
+    private:
+        DbScanKernelType m_kernelType; ///< The implementation used by the scans.
+    };
+} /// namespace xq
+#endif /// !DB_SCAN_KERNELS_HPP
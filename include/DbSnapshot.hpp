@@ -0,0 +1,113 @@
+/// @file DbSnapshot.hpp
+///
+/// @brief Definition of the binary snapshot of the test table.
+/// @details Writes the records into a column-oriented file and reads the columns
+/// of such a file in place from a memory mapping.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#ifndef DB_SNAPSHOT_HPP
+#define DB_SNAPSHOT_HPP
+
+#include "DbMappedFile.hpp"
+#include "DbTableTest.hpp"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace xq
+{
+    /// @class DbSnapshot
+    /// @brief Column-oriented binary snapshot of the Test table.
+    /// @details The file starts with a header of 40 bytes: the magic "XQDBSNAP", the format version,
+    /// the number of records and the total lengths of the names and the addresses. Then follow the id array,
+    /// the balance array, the offset arrays of the names and the addresses (one more entry than records)
+    /// and the characters of all the names and all the addresses. Every array starts at a multiple of 8 bytes.
+    /// The values are stored in the byte order of the machine, which wrote the file.
+    /// An opened snapshot keeps the file mapped and returns the values directly from the mapping,
+    /// so opening takes the same time independent of the size of the file.
+    class DbSnapshot
+    {
+    public:
+        /// @brief Write the records, which are not deleted, into a snapshot file.
+        /// @details The file is synced to the storage device before returning.
+        /// @param[in] f_path The path of the file. An existing file is replaced.
+        /// @param[in] f_records The records to be written.
+        /// @returns True if the file was written, false elsewhen.
+        static bool write(const std::string& f_path, const DbTestRecordCollection& f_records);
+
+        /// @brief Move a written snapshot file into place.
+        /// @details Renames the file and syncs the directory, so that the new snapshot is found after a power loss.
+        /// The temporary file is removed if it cannot be renamed.
+        /// @param[in] f_temporaryPath The path of the written file.
+        /// @param[in] f_path The path of the snapshot. An existing file is replaced.
+        /// @returns True if the file was renamed and the rename is stored on the storage device, false elsewhen.
+        static bool replace(const std::string& f_temporaryPath, const std::string& f_path);
+
+        /// @brief Open a snapshot file.
+        /// @details Checks that the header and the sizes of the arrays match the size of the file.
+        /// @param[in] f_path The path of the file.
+        /// @returns True if the file is a valid snapshot, false elsewhen.
+        bool open(const std::string& f_path);
+
+        /// @brief Get the number of records in the snapshot.
+        /// @returns The number of records.
+        uint64_t getNumberOfRecords() const;
+
+        /// @brief Get the id array.
+        /// @returns Pointer to the id of the first record.
+        const uint64_t* getIds() const;
+
+        /// @brief Get the balance array.
+        /// @returns Pointer to the balance of the first record.
+        const int32_t* getBalances() const;
+
+        /// @brief Get the offsets of the names.
+        /// @returns Pointer to the offset of the first name in the name characters. Has one more entry than records.
+        const uint64_t* getNameOffsets() const;
+
+        /// @brief Get the characters of all the names.
+        /// @returns Pointer to the first character.
+        const char* getNameCharacters() const;
+
+        /// @brief Get the offsets of the addresses.
+        /// @returns Pointer to the offset of the first address in the address characters. Has one more entry than records.
+        const uint64_t* getAddressOffsets() const;
+
+        /// @brief Get the characters of all the addresses.
+        /// @returns Pointer to the first character.
+        const char* getAddressCharacters() const;
+
+        /// @brief Get the name of a record.
+        /// @details The offsets of the strings are checked only by readRecords.
+        /// @param[in] f_index The position of the record.
+        /// @returns The characters of the name in the mapped file.
+        std::string_view getName(size_t f_index) const;
+
+        /// @brief Get the address of a record.
+        /// @param[in] f_index The position of the record.
+        /// @returns The characters of the address in the mapped file.
+        std::string_view getAddress(size_t f_index) const;
+
+        /// @brief Get the records of the snapshot.
+        /// @details Reads every column sequentially and constructs each record in place in the collection.
+        /// @param[out] f_records Contains the records of the snapshot.
+        /// @returns True if the records were read, false if the offsets of the strings are corrupted.
+        bool readRecords(DbTestRecordCollection& f_records) const;
+
+    private:
+        DbMappedFile m_file; ///< The mapped snapshot file.
+        uint64_t m_numberOfRecords{ 0 }; ///< The number of records.
+        const uint64_t* m_ids{ nullptr }; ///< The id array in the mapping.
+        const int32_t* m_balances{ nullptr }; ///< The balance array in the mapping.
+        const uint64_t* m_nameOffsets{ nullptr }; ///< The offsets of the names in the name characters.
+        const uint64_t* m_addressOffsets{ nullptr }; ///< The offsets of the addresses in the address characters.
+        const char* m_names{ nullptr }; ///< The characters of all the names.
+        const char* m_addresses{ nullptr }; ///< The characters of all the addresses.
+    };
+} /// namespace xq
+#endif /// !DB_SNAPSHOT_HPP
@@ -0,0 +1,181 @@
+/// @file DbStringArena.hpp
+///
+/// @brief Definition of the arena storing the strings of the string columns.
+/// @details Copies the strings one after another into large contiguous slabs,
+/// so that the columns only keep the position and length of every string.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#ifndef DB_STRING_ARENA_HPP
+#define DB_STRING_ARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace xq
+{
+    /// @struct DbStringArenaView
+    /// @brief Position of a string stored in the arena.
+    /// @details Takes 12 bytes, while a std::string takes 32 bytes and an own heap allocation
+    /// for every string longer than the small string buffer.
+    struct DbStringArenaView
+    {
+        uint32_t slab; ///< The index of the slab containing the string.
+        uint32_t offset; ///< The offset of the first character in the slab.
+        uint32_t length; ///< The number of characters.
+    };
+
+    // Definitions for the Slabs and Views Collections
+    typedef std::vector<std::unique_ptr<char[]>> DbStringArenaSlabsCollection;
+    typedef std::vector<DbStringArenaView> DbStringArenaViewsCollection;
+
+    // Definitions for the Dictionary Codes Collections
+    typedef std::vector<uint32_t> DbStringCodesCollection;
+    typedef std::unordered_map<std::string_view, uint32_t> DbStringDictionaryCollection;
+
+    /// @class DbStringArena
+    /// @brief Append-only storage for strings in contiguous slabs.
+    /// @details Strings are never moved or freed one by one. Consecutively added strings are next to each other
+    /// in memory, so scanning them reads contiguous bytes. Clearing the arena frees one block per slab
+    /// instead of one block per string.
+    class DbStringArena
+    {
+    public:
+        /// @brief Copy a string into the arena.
+        /// @param[in] f_string The string to be stored.
+        /// @returns The position of the stored string.
+        DbStringArenaView addString(std::string_view f_string);
+
+        /// @brief Get a stored string.
+        /// @param[in] f_view The position of the string returned when it was added.
+        /// @returns The characters of the string. Valid until the arena is cleared.
+        std::string_view getString(const DbStringArenaView& f_view) const;
+
+        /// @brief Free all the slabs.
+        void clear();
+
+        /// @brief Get the number of allocated slabs.
+        /// @returns The number of slabs.
+        size_t getNumberOfSlabs() const;
+
+        /// @brief Get the number of bytes taken by the stored strings.
+        /// @returns The number of used bytes in all the slabs.
+        size_t getNumberOfUsedBytes() const;
+
+    private:
+        DbStringArenaSlabsCollection m_slabs; ///< The slabs with the characters of the strings.
+        size_t m_currentSlabSize{ 0 }; ///< The size of the last slab, where the strings are added.
+        size_t m_currentSlabUsedBytes{ 0 }; ///< The number of used bytes in the last slab.
+        size_t m_numberOfUsedBytes{ 0 }; ///< The number of used bytes in all the slabs.
+    };
+
+    /// @class DbStringColumn
+    /// @brief Column of strings stored in an own arena.
+    /// @details Every position of the column keeps only the view of its string, the characters are in the arena.
+    /// Replaced and removed strings stay in the arena as unused bytes, until they are more than the used ones.
+    /// Then the remaining strings are copied into a new arena, so the memory stays bounded.
+    /// With dictionary encoding every distinct string is stored once and each position keeps a 32-bit code
+    /// of its string instead of a view. The distinct strings are never removed from the dictionary.
+    /// The strings can also be the offsets and the characters owned by someone else, like a mapped snapshot file,
+    /// which are used in place until the first modification copies them into the arena.
+    class DbStringColumn
+    {
+    public:
+        /// @brief Store a string at the end of the column.
+        /// @param[in] f_string The string to be stored.
+        void appendString(const std::string& f_string);
+
+        /// @brief Replace the string at a given position.
+        /// @param[in] f_index The position of the string to be replaced.
+        /// @param[in] f_string The string to be stored.
+        void setString(size_t f_index, const std::string& f_string);
+
+        /// @brief Replace all the strings with arrays of offsets and characters, which are used in place.
+        /// @details A dictionary encoded column encodes the strings instead. The offsets are not checked.
+        /// @param[in] f_offsets The offset of every string in the characters and the end of the last one.
+        /// Shall stay valid until the column is modified or cleared, the same as the characters.
+        /// @param[in] f_characters The characters of all the strings.
+        /// @param[in] f_numberOfStrings The number of strings.
+        void mapStrings(const uint64_t* f_offsets, const char* f_characters, size_t f_numberOfStrings);
+
+        /// @brief Remove the string at a given position.
+        /// @details All the aftercomming strings are shifted.
+        /// @param[in] f_index The position of the string to be removed.
+        void eraseString(size_t f_index);
+
+        /// @brief Get the string at a given position.
+        /// @param[in] f_index The position of the string.
+        /// @returns The characters of the string. Valid until the column is modified.
+        std::string_view getString(size_t f_index) const;
+
+        /// @brief Reserve memory for the views of a given number of strings.
+        /// @param[in] f_numberOfStrings The number of strings to reserve memory for.
+        void reserve(size_t f_numberOfStrings);
+
+        /// @brief Remove all the strings and free the arena.
+        void clear();
+
+        /// @brief Get the number of strings in the column.
+        /// @returns The number of strings.
+        size_t size() const;
+
+        /// @brief Get the arena with the characters of the strings.
+        /// @returns The arena. Empty while the strings are used in place.
+        const DbStringArena& getArena() const;
+
+        /// @brief Store every distinct string once and keep only its code at each position.
+        /// @details Converts the current strings. Suits columns with few distinct values.
+        void enableDictionaryEncoding();
+
+        /// @brief Check if the column uses dictionary encoding.
+        /// @returns True if the positions keep codes of the distinct strings, false elsewhen.
+        bool isDictionaryEncoded() const;
+
+        /// @brief Get the codes of the strings in the order of the column.
+        /// @returns The codes. Empty if dictionary encoding is not used.
+        const DbStringCodesCollection& getCodes() const;
+
+        /// @brief Get the number of distinct strings in the dictionary.
+        /// @returns The number of distinct strings. The codes are less than it.
+        size_t getDictionarySize() const;
+
+        /// @brief Get the distinct string with a given code.
+        /// @param[in] f_code The code of the string.
+        /// @returns The characters of the string.
+        std::string_view getDictionaryString(uint32_t f_code) const;
+
+    private:
+        /// @brief Copy the strings used in place into the arena before they are modified.
+        void copyMappedStrings();
+
+        /// @brief Get the code of a string, adding it to the dictionary if it is not there.
+        /// @param[in] f_string The string.
+        /// @returns The code of the string.
+        uint32_t encodeString(std::string_view f_string);
+
+        /// @brief Mark the bytes of a string, which is no longer in the column, as unused.
+        /// @details Copies the remaining strings into a new arena if the unused bytes are too many.
+        /// @param[in] f_length The length of the string.
+        void releaseString(uint32_t f_length);
+
+        DbStringArena m_arena; ///< The arena with the characters of the strings.
+        DbStringArenaViewsCollection m_views; ///< The views of the strings in the order of the column.
+        const uint64_t* m_mappedOffsets{ nullptr }; ///< The offsets of the strings used in place, nullptr if none.
+        const char* m_mappedCharacters{ nullptr }; ///< The characters of the strings used in place.
+        size_t m_numberOfMappedStrings{ 0 }; ///< The number of strings used in place.
+        size_t m_numberOfUnusedBytes{ 0 }; ///< The number of bytes in the arena, which belong to no string.
+        bool m_isDictionaryEncoded{ false }; ///< If true, the positions keep codes instead of views.
+        DbStringCodesCollection m_codes; ///< The codes of the strings in the order of the column.
+        DbStringArenaViewsCollection m_dictionaryViews; ///< The views of the distinct strings by their code.
+        DbStringDictionaryCollection m_dictionary; ///< The codes of the distinct strings.
+    };
+} /// namespace xq
+#endif /// !DB_STRING_ARENA_HPP
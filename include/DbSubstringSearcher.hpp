@@ -0,0 +1,72 @@
+/// @file DbSubstringSearcher.hpp
+///
+/// @brief Definition of the precompiled substring searcher for the string columns.
+/// @details Prepares the searched string once per query, so that checking each
+/// record only has to scan the text of the record.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#ifndef DB_SUBSTRING_SEARCHER_HPP
+#define DB_SUBSTRING_SEARCHER_HPP
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace xq
+{
+    /// @class DbSubstringSearcher
+    /// @brief Substring search prepared once for a given pattern.
+    /// @details Short patterns are searched by looking for the first character of the pattern with memchr,
+    /// which is vectorized by the standard library, and checking the last character before comparing the rest.
+    /// Long patterns are searched with the Boyer-Moore-Horspool algorithm, whose shift table is built
+    /// in the constructor, so it can skip up to the whole length of the pattern at once.
+    class DbSubstringSearcher
+    {
+    public:
+        /// @brief Class constructor.
+        /// @details Constructs a searcher for an empty pattern, which is found in every text.
+        DbSubstringSearcher();
+
+        /// @brief Class constructor with arguments.
+        /// @details Selects the search algorithm depending on the length of the pattern and prepares it.
+        /// @param[in] f_pattern The string to be searched for.
+        explicit DbSubstringSearcher(const std::string& f_pattern);
+
+        /// @brief Check if the pattern is found in a given text.
+        /// @param[in] f_text The text to search in.
+        /// @returns True if the text contains the pattern, false elsewhen.
+        bool isFoundIn(const std::string& f_text) const;
+
+        /// @brief Check if the pattern is found in a given text.
+        /// @param[in] f_text Pointer to the first character of the text to search in.
+        /// @param[in] f_textLength The number of characters in the text.
+        /// @returns True if the text contains the pattern, false elsewhen.
+        bool isFoundIn(const char* f_text, size_t f_textLength) const;
+
+        /// @brief Get the searched pattern.
+        /// @returns The string to be searched for.
+        const std::string& getPattern() const;
+
+    private:
+        /// @brief Search for the pattern by its first and last character.
+        /// @param[in] f_text Pointer to the first character of the text to search in.
+        /// @param[in] f_textLength The number of characters in the text. Not less than the length of the pattern.
+        /// @returns True if the text contains the pattern, false elsewhen.
+        bool findByFirstAndLastCharacter(const char* f_text, size_t f_textLength) const;
+
+        /// @brief Search for the pattern with the Boyer-Moore-Horspool algorithm.
+        /// @param[in] f_text Pointer to the first character of the text to search in.
+        /// @param[in] f_textLength The number of characters in the text. Not less than the length of the pattern.
+        /// @returns True if the text contains the pattern, false elsewhen.
+        bool findByHorspool(const char* f_text, size_t f_textLength) const;
+
+        std::string m_pattern; ///< The string to be searched for.
+        bool m_useHorspool; ///< If true, the Boyer-Moore-Horspool algorithm is used for the search.
+        std::array<uint32_t, 256> m_shiftTable; ///< Shift for each character, filled only for the Boyer-Moore-Horspool algorithm.
+    };
+} /// namespace xq
+#endif /// !DB_SUBSTRING_SEARCHER_HPP
@@ -0,0 +1,116 @@
+/// @file DbTableTestColumnStore.hpp
+///
+/// @brief Definition of the column-oriented storage for the test table.
+/// @details Keeps every column of the test table in its own contiguous array,
+/// so that scanning a single column touches only the data of that column.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#ifndef DB_TABLE_TEST_COLUMN_STORE_HPP
+#define DB_TABLE_TEST_COLUMN_STORE_HPP
+
+#include "DbIntegerColumn.hpp"
+#include "DbSnapshot.hpp"
+#include "DbStringArena.hpp"
+#include "DbTableTest.hpp"
+
+namespace xq
+{
+    // Definitions for the Columns Collections
+    typedef DbIntegerColumn<uint64_t> DbIdColumn;
+    typedef DbIntegerColumn<int32_t> DbBalanceColumn;
+
+    /// @class DbTableTestColumnStore
+    /// @brief Column-oriented storage for the Test table.
+    /// @details Stores the id, name, balance and address of the records in separate contiguous arrays
+    /// (structure of arrays). The value of each column for a given record is found at the same position
+    /// in every array, which is also the position of the record in the row-oriented collection.
+    /// The characters of the names and the addresses are kept in one arena per column instead of a std::string
+    /// per record, so scanning a string column reads contiguous bytes.
+    class DbTableTestColumnStore
+    {
+    public:
+        /// @brief Fill the columns from a collection of records.
+        /// @details Replaces the current content of the columns with the content of the given records.
+        /// @param[in] f_records The records to be stored in the columns.
+        void build(const DbTestRecordCollection& f_records);
+
+        /// @brief Use the arrays of an opened snapshot as the columns in place.
+        /// @details Replaces the current content of the columns without copying the values. A column is copied
+        /// at its first modification. The compressed and dictionary encoded columns are converted instead.
+        /// @param[in] f_snapshot The snapshot. Shall stay opened while the columns are not modified.
+        void mapSnapshot(const DbSnapshot& f_snapshot);
+
+        /// @brief Store a record at the end of the columns.
+        /// @param[in] f_record The record to be stored.
+        void appendRecord(const DbTableTest& f_record);
+
+        /// @brief Reserve memory for a given number of records in every column.
+        /// @param[in] f_numberOfRecords The number of records to reserve memory for.
+        void reserve(size_t f_numberOfRecords);
+
+        /// @brief Replace the record at a given position.
+        /// @param[in] f_index The position of the record to be replaced.
+        /// @param[in] f_record The record to be stored.
+        void setRecord(size_t f_index, const DbTableTest& f_record);
+
+        /// @brief Clear the record at a given position, when the record is deleted.
+        /// @details The integer columns read 0 and the string columns are empty at the position afterwards.
+        /// The compressed columns mark the position without packing its block again.
+        /// @param[in] f_index The position of the deleted record.
+        void deleteRecord(size_t f_index);
+
+        /// @brief Remove the record at a given position.
+        /// @details All the aftercomming records are shifted, the same way as in the row-oriented collection.
+        /// @param[in] f_index The position of the record to be removed.
+        void eraseRecord(size_t f_index);
+
+        /// @brief Compress the id column.
+        /// @details The positions of the deleted records are cleared instead of packed.
+        void enableIdCompression();
+
+        /// @brief Compress the balance column.
+        /// @details The positions of the deleted records are cleared instead of packed.
+        void enableBalanceCompression();
+
+        /// @brief Use dictionary encoding for the name column.
+        void enableNameDictionaryEncoding();
+
+        /// @brief Use dictionary encoding for the address column.
+        void enableAddressDictionaryEncoding();
+
+        /// @brief Get the number of records in the columns.
+        /// @returns The number of records, including the deleted ones.
+        size_t getNumberOfRecords() const;
+
+        /// @brief Get the column with the ids of the records.
+        /// @returns The id column.
+        const DbIdColumn& getIds() const;
+
+        /// @brief Get the column with the names of the records.
+        /// @returns The name column.
+        const DbStringColumn& getNames() const;
+
+        /// @brief Get the column with the balances of the records.
+        /// @returns The balance column.
+        const DbBalanceColumn& getBalances() const;
+
+        /// @brief Get the column with the addresses of the records.
+        /// @returns The address column.
+        const DbStringColumn& getAddresses() const;
+
+    private:
+        /// @brief Get the positions of the deleted records.
+        /// @returns The ascending positions, whose id is 0.
+        DbRecordIndexesCollection getDeletedIndexes() const;
+
+        DbIdColumn m_ids; ///< The id column.
+        DbStringColumn m_names; ///< The name column.
+        DbBalanceColumn m_balances; ///< The balance column.
+        DbStringColumn m_addresses; ///< The address column.
+    };
+} /// namespace xq
+#endif /// !DB_TABLE_TEST_COLUMN_STORE_HPP
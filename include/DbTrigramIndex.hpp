@@ -0,0 +1,103 @@
+/// @file DbTrigramIndex.hpp
+///
+/// @brief Definition of the trigram index for the string columns.
+/// @details Maps every sequence of three characters found in a string column
+/// to the positions of the records containing it, so that substring searches
+/// only need to check the records containing all the trigrams of the searched string.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#ifndef DB_TRIGRAM_INDEX_HPP
+#define DB_TRIGRAM_INDEX_HPP
+
+#include "DbScanKernels.hpp"
+
+#include <string>
+#include <unordered_map>
+
+namespace xq
+{
+    /// @struct DbPostingList
+    /// @brief Sorted positions of the records containing a trigram.
+    /// @details Positions are added and removed in the middle of the list when the slots of deleted records are
+    /// reused or the records are compacted. Instead of moving the whole sorted array every time, such changes are
+    /// kept in small sorted delta buffers, which are merged into the array once they grow too large.
+    struct DbPostingList
+    {
+        DbRecordIndexesCollection positions; ///< Sorted positions as of the last merge.
+        DbRecordIndexesCollection addedPositions; ///< Sorted positions added after the last merge, not in positions.
+        DbRecordIndexesCollection removedPositions; ///< Sorted positions of positions removed after the last merge.
+
+        /// @brief Get the number of the positions in the list.
+        /// @returns The number of the positions, including the changes after the last merge.
+        size_t getNumberOfPositions() const
+        {
+            return positions.size() + addedPositions.size() - removedPositions.size();
+        }
+    };
+
+    // Definition for the Posting Lists Collection
+    typedef std::unordered_map<uint32_t, DbPostingList> DbPostingListsCollection;
+
+    /// @class DbTrigramIndex
+    /// @brief Inverted index of the trigrams of a string column.
+    /// @details Keeps for every trigram a posting list with the positions of the records containing it,
+    /// sorted in ascending order. Records added at the end are appended to the lists directly. A substring search intersects the posting lists of all the trigrams of the
+    /// searched string, starting with the shortest one, to get the candidate records. The candidates still have
+    /// to be checked with a real substring search, since the trigrams might be found in a different order.
+    class DbTrigramIndex
+    {
+    public:
+        /// @brief Add a string of a record to the index.
+        /// @param[in] f_index The position of the record.
+        /// @param[in] f_string The value of the indexed column of the record.
+        void addString(size_t f_index, const std::string& f_string);
+
+        /// @brief Remove a string of a record from the index.
+        /// @param[in] f_index The position of the record.
+        /// @param[in] f_string The value of the indexed column of the record, as it was added to the index.
+        void removeString(size_t f_index, const std::string& f_string);
+
+        /// @brief Remove all the strings from the index.
+        void clear();
+
+        /// @brief Find the records which might contain a given string.
+        /// @details Intersects the posting lists of all the trigrams of the searched string.
+        /// @param[in] f_matchString The string to search for.
+        /// @param[out] f_output Contains the positions of the candidate records in ascending order.
+        /// @returns False if the searched string is shorter than a trigram and the index cannot be used, true elsewhen.
+        bool findCandidates(const std::string& f_matchString, DbRecordIndexesCollection& f_output) const;
+
+        /// @brief Get the number of different trigrams in the index.
+        /// @returns The number of posting lists.
+        size_t getNumberOfTrigrams() const;
+
+    private:
+        /// @brief Get all the different trigrams of a string.
+        /// @param[in] f_string The string to split into trigrams.
+        /// @returns The trigrams, each one stored in the lowest three bytes of an integer.
+        static std::vector<uint32_t> getTrigrams(const std::string& f_string);
+
+        /// @brief Get all the positions of a posting list, including the changes after the last merge.
+        /// @param[in] f_postingList The posting list.
+        /// @param[out] f_output Contains the positions in ascending order.
+        static void getPositions(const DbPostingList& f_postingList, DbRecordIndexesCollection& f_output);
+
+        /// @brief Keep only the candidates found in a posting list.
+        /// @param[in] f_candidates The sorted positions of the candidate records.
+        /// @param[in] f_postingList The posting list.
+        /// @param[out] f_output Contains the found candidates in ascending order.
+        static void intersectPositions(const DbRecordIndexesCollection& f_candidates, const DbPostingList& f_postingList,
+            DbRecordIndexesCollection& f_output);
+
+        /// @brief Merge the delta buffers of a posting list into its sorted positions, if they are too large.
+        /// @param[in,out] f_postingList The posting list.
+        static void mergeIfNeeded(DbPostingList& f_postingList);
+
+        DbPostingListsCollection m_postingLists; ///< Posting list for each trigram.
+    };
+} /// namespace xq
+#endif /// !DB_TRIGRAM_INDEX_HPP
@@ -0,0 +1,149 @@
+/// @file DbWriteAheadLog.hpp
+///
+/// @brief Definition of the write-ahead log of the database mutations.
+/// @details Appends every added and deleted record to a binary log file before the database
+/// is changed, so that the mutations can be replayed after a restart.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#ifndef DB_WRITE_AHEAD_LOG_HPP
+#define DB_WRITE_AHEAD_LOG_HPP
+
+#include "DbTableTest.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace xq
+{
+    /// @enum DbWalSyncPolicy
+    /// @brief When the written log entries are forced to the storage device.
+    /// @var DbWalSyncPolicy::EveryCommit
+    /// Every mutation is written and synced before it is applied. Nothing is lost, but every mutation waits for the device.
+    /// @var DbWalSyncPolicy::GroupCommit
+    /// The mutations are collected and written and synced together once per group. Up to one group of mutations
+    /// is lost when the process or the machine stops.
+    /// @var DbWalSyncPolicy::NoSync
+    /// Every mutation is written to the operating system, which decides when to store it. Nothing is lost when
+    /// the process stops, but the mutations not yet stored by the operating system are lost when the machine stops.
+    enum class DbWalSyncPolicy : uint8_t
+    {
+        EveryCommit,
+        GroupCommit,
+        NoSync
+    };
+
+    /// @enum DbWalEntryType
+    /// @brief The mutation described by a log entry.
+    enum class DbWalEntryType : uint8_t
+    {
+        Add = 1,
+        Delete = 2
+    };
+
+    /// @struct DbWalEntry
+    /// @brief Mutation read from the log.
+    struct DbWalEntry
+    {
+        DbWalEntryType type; ///< The mutation.
+        DbTableTest record; ///< The added record. Only the id is set for a deletion.
+    };
+
+    // Definitions for the Entries and Buffer Collections
+    typedef std::vector<DbWalEntry> DbWalEntriesCollection;
+    typedef std::vector<unsigned char> DbWalBufferCollection;
+
+    /// @class DbWriteAheadLog
+    /// @brief Append-only binary log of the added and deleted records.
+    /// @details Every entry is the length and the CRC-32 of its payload, followed by the payload: the type of the
+    /// mutation, the id and for an addition the balance, the lengths of the strings and their characters.
+    /// The values are stored in the byte order of the machine, which wrote the file. The entries are collected
+    /// in a buffer and a commit writes them depending on the sync policy, so that one sync covers a whole group.
+    /// An entry, which was only partly written when the machine stopped, fails its checksum. Reading stops there
+    /// and opening the log cuts it off, so that the new entries follow the last complete one.
+    class DbWriteAheadLog
+    {
+    public:
+        /// @brief Default class constructor.
+        DbWriteAheadLog() = default;
+
+        /// @brief Class destructor.
+        /// @details Writes and syncs the pending entries and closes the file.
+        ~DbWriteAheadLog();
+
+        DbWriteAheadLog(const DbWriteAheadLog&) = delete;
+        DbWriteAheadLog& operator=(const DbWriteAheadLog&) = delete;
+
+        /// @brief Open a log file for appending.
+        /// @details Creates the file if it doesn't exist. Closes the previously opened file, if any. A special file,
+        /// like a pipe or a device, is appended to without checking its entries.
+        /// @param[in] f_path The path of the file.
+        /// @param[in] f_syncPolicy When the entries are synced.
+        /// @param[in] f_groupSize The number of commits written and synced together with DbWalSyncPolicy::GroupCommit.
+        /// @returns True if the file was opened, false elsewhen.
+        bool open(const std::string& f_path, DbWalSyncPolicy f_syncPolicy, uint32_t f_groupSize);
+
+        /// @brief Write and sync the pending entries and close the file.
+        void close();
+
+        /// @brief Check if a log file is opened.
+        /// @returns True if the entries are appended to a file, false elsewhen.
+        bool isOpen() const;
+
+        /// @brief Append the addition of a record to the pending entries.
+        /// @param[in] f_record The added record.
+        void appendAdd(const DbTableTest& f_record);
+
+        /// @brief Append the deletion of a record to the pending entries.
+        /// @param[in] f_id The id of the deleted record.
+        void appendDelete(uint64_t f_id);
+
+        /// @brief End a mutation consisting of the entries appended since the last commit.
+        /// @details Writes and syncs the pending entries as required by the sync policy. After a failed write every
+        /// following commit fails and drops its entries, until the file is opened again.
+        /// @returns True if the required writes succeeded, false elsewhen.
+        bool commit();
+
+        /// @brief Write and sync all the pending entries independent of the sync policy.
+        /// @returns True if all the entries written since opening the file are synced, false if a write failed.
+        bool sync();
+
+        /// @brief Remove all the entries from the file, including the pending ones.
+        /// @details Used after the records are saved into a snapshot, which already contains the mutations.
+        /// @returns True if the file was emptied, false elsewhen.
+        bool truncate();
+
+        /// @brief Get the number of times the file was synced.
+        /// @returns The number of syncs since opening the file.
+        uint64_t getNumberOfSyncs() const;
+
+        /// @brief Read the entries of a log file.
+        /// @details Stops at the end of the file or at the first incomplete or corrupted entry.
+        /// @param[in] f_path The path of the file.
+        /// @param[out] f_entries Contains the complete entries in the order they were written.
+        /// @returns True if the file doesn't exist or was read, false if it cannot be read.
+        static bool readEntries(const std::string& f_path, DbWalEntriesCollection& f_entries);
+
+    private:
+        /// @brief Write the pending entries to the file.
+        /// @param[in] f_isSynced If true, the file is synced after writing.
+        /// @returns True if the entries were written, false elsewhen.
+        bool writePending(bool f_isSynced);
+
+        std::FILE* m_file{ nullptr }; ///< The log file.
+        std::string m_path; ///< The path of the log file.
+        DbWalSyncPolicy m_syncPolicy{ DbWalSyncPolicy::GroupCommit }; ///< When the entries are synced.
+        uint32_t m_groupSize{ 1 }; ///< The number of commits written together with the group commit.
+        uint32_t m_numberOfPendingCommits{ 0 }; ///< The number of commits in the buffer.
+        DbWalBufferCollection m_buffer; ///< The pending entries, which are not written yet.
+        uint64_t m_numberOfSyncs{ 0 }; ///< The number of syncs since opening the file.
+        bool m_hasFailed{ false }; ///< True if a write failed since opening the file.
+    };
+} /// namespace xq
+#endif /// !DB_WRITE_AHEAD_LOG_HPP
@@ -0,0 +1,135 @@
+/// @file DbZoneMap.hpp
+///
+/// @brief Definition of the zone map of an integer column.
+/// @details Keeps the smallest and the largest value of every block of records,
+/// so that the scans can skip the blocks, which cannot contain the searched values.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#ifndef DB_ZONE_MAP_HPP
+#define DB_ZONE_MAP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace xq
+{
+    /// @class DbZoneMap
+    /// @brief Smallest and largest value per block of 4096 records.
+    /// @details Adding a value widens the bounds of its zone. Removing a value only counts it, because finding
+    /// the new bounds needs all the remaining values of the zone. The bounds stay correct, just wider than needed,
+    /// until the zone is empty or half of its records were removed. Then the owner rebuilds the zone.
+    /// On naturally clustered data, like ids inserted in ascending order, most zones are skipped by a search.
+    /// @tparam TValue The type of the values.
+    template<typename TValue>
+    class DbZoneMap
+    {
+    public:
+        // The number of records in each zone
+        static constexpr size_t const cRecordsPerZone{ 4096 };
+
+        /// @brief Add the value of a record to its zone.
+        /// @param[in] f_index The position of the record.
+        /// @param[in] f_value The value of the record.
+        void addValue(size_t f_index, TValue f_value)
+        {
+            size_t zoneIndex = f_index / cRecordsPerZone;
+            if (zoneIndex >= m_zones.size())
+            {
+                m_zones.resize(zoneIndex + 1);
+            }
+            auto& zone = m_zones[zoneIndex];
+            zone.minimum = std::min(zone.minimum, f_value);
+            zone.maximum = std::max(zone.maximum, f_value);
+            ++zone.numberOfValues;
+        }
+
+        /// @brief Remove the value of a record from its zone.
+        /// @param[in] f_index The position of the record.
+        /// @returns True if the zone shall be rebuilt from its remaining values, false elsewhen.
+        bool removeValue(size_t f_index)
+        {
+            auto& zone = m_zones[f_index / cRecordsPerZone];
+            --zone.numberOfValues;
+            ++zone.numberOfRemovedValues;
+            if (zone.numberOfValues == 0)
+            {
+                zone = DbZone{};
+                return false;
+            }
+            return zone.numberOfRemovedValues >= cRecordsPerZone / 2;
+        }
+
+        /// @brief Remove all the values from the zone of a record, so that it can be rebuilt.
+        /// @param[in] f_index The position of the record.
+        void resetZone(size_t f_index)
+        {
+            m_zones[f_index / cRecordsPerZone] = DbZone{};
+        }
+
+        /// @brief Remove all the zones.
+        void clear()
+        {
+            m_zones.clear();
+        }
+
+        /// @brief Get the number of zones.
+        /// @returns The number of zones.
+        size_t getNumberOfZones() const
+        {
+            return m_zones.size();
+        }
+
+        /// @brief Check if a zone might contain values between two bounds.
+        /// @param[in] f_zoneIndex The index of the zone.
+        /// @param[in] f_lowerBound The smallest searched value.
+        /// @param[in] f_upperBound The largest searched value.
+        /// @returns True if the zone might contain such values, false if it cannot.
+        bool mightContain(size_t f_zoneIndex, TValue f_lowerBound, TValue f_upperBound) const
+        {
+            const auto& zone = m_zones[f_zoneIndex];
+            return zone.numberOfValues > 0 && f_lowerBound <= zone.maximum && f_upperBound >= zone.minimum;
+        }
+
+        /// @brief Call a function for each part of a range of records, which might contain values between two bounds.
+        /// @param[in] f_lowerBound The smallest searched value.
+        /// @param[in] f_upperBound The largest searched value.
+        /// @param[in] f_begin The position of the first record.
+        /// @param[in] f_end The position after the last record.
+        /// @param[in] f_scanZone Function called with the first and after the last position of each part.
+        template<typename TScanZone>
+        void forEachMatchingZone(TValue f_lowerBound, TValue f_upperBound, size_t f_begin, size_t f_end,
+            TScanZone f_scanZone) const
+        {
+            // The records after the last zone have no values
+            f_end = std::min(f_end, m_zones.size() * cRecordsPerZone);
+            for (size_t zoneBegin = f_begin - f_begin % cRecordsPerZone; zoneBegin < f_end; zoneBegin += cRecordsPerZone)
+            {
+                if (mightContain(zoneBegin / cRecordsPerZone, f_lowerBound, f_upperBound))
+                {
+                    f_scanZone(std::max(f_begin, zoneBegin), std::min(f_end, zoneBegin + cRecordsPerZone));
+                }
+            }
+        }
+
+    private:
+        /// @struct DbZone
+        /// @brief Summary of the values in a zone.
+        struct DbZone
+        {
+            TValue minimum{ std::numeric_limits<TValue>::max() }; ///< The smallest value.
+            TValue maximum{ std::numeric_limits<TValue>::lowest() }; ///< The largest value.
+            uint32_t numberOfValues{ 0 }; ///< The number of records in the zone.
+            uint32_t numberOfRemovedValues{ 0 }; ///< The number of records removed since the zone was rebuilt.
+        };
+
+        std::vector<DbZone> m_zones; ///< The zones in the order of the records.
+    };
+} /// namespace xq
+#endif /// !DB_ZONE_MAP_HPP
@@ -13,13 +13,57 @@
 #ifndef IN_MEMORY_DB_HPP
 #define IN_MEMORY_DB_HPP
 
+#include "DbAggregate.hpp"
+#include "DbBalanceIndex.hpp"
+#include "DbQuery.hpp"
+#include "DbQueryCache.hpp"
+#include "DbRecordCursor.hpp"
+#include "DbResultSet.hpp"
+#include "DbScanKernels.hpp"
+#include "DbSnapshot.hpp"
 #include "DbTableTest.hpp"
+#include "DbTableTestColumnStore.hpp"
+#include "DbTrigramIndex.hpp"
+#include "DbWriteAheadLog.hpp"
+#include "DbZoneMap.hpp"
 
-#include <queue>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <utility>
 
 namespace xq
 {
-	typedef std::queue<uint64_t> DbFreeIdsCollection;
+	typedef std::vector<size_t> DbFreeSlotsCollection;
+	typedef std::unordered_map<uint64_t, size_t> DbIdIndexCollection;
+	typedef std::vector<uint32_t> DbRecordIdsCollection;
+
+	/// @enum DbStorageLayout
+	/// @brief Different ways of storing the records used by the searches.
+	/// @var DbStorageLayout::Row
+	/// The searches traverse the collection of records.
+	/// @var DbStorageLayout::Column
+	/// Every column is additionally kept in its own contiguous array and the searches traverse only the searched column.
+	enum class DbStorageLayout : uint8_t
+	{
+		Row,
+		Column
+	};
+
+	/// @enum DbSortOrder
+	/// @brief The order of the records returned by the Top-K searches.
+	/// @var DbSortOrder::Ascending
+	/// From the smallest value. Records with equal values are ordered by their position.
+	/// @var DbSortOrder::Descending
+	/// From the largest value. The exact reverse of the ascending order, so records with equal values
+	/// are ordered from the last position.
+	enum class DbSortOrder : uint8_t
+	{
+		Ascending,
+		Descending
+	};
+
 	/// @class InMemoryDb
 	/// @brief In-memory database class.
 	/// @details Provides implementation of a database which is hosted
@@ -29,8 +73,18 @@ namespace xq
 	{
 	public:
 		/// @brief Class constructor with arguments.
-		/// @details Constructs the class using the given arguments.
-		InMemoryDb(const DbTestRecordCollection& f_records);
+		/// @details Constructs the class using the given arguments and builds the primary-key index.
+		/// With the column layout the records are still kept as they are, so that the searches can
+		/// return pointers to them, but the searches read only the contiguous array of the searched column.
+		/// @param[in] f_records The records to be stored in the database.
+		/// @param[in] f_storageLayout The storage layout used by the searches.
+		InMemoryDb(const DbTestRecordCollection& f_records, DbStorageLayout f_storageLayout = DbStorageLayout::Row);
+
+		/// @brief Class constructor loading the records in bulk.
+		/// @details Takes over the memory of the given records instead of copying them and builds the primary-key index.
+		/// @param[in] f_records The records to be stored in the database. Empty after the construction.
+		/// @param[in] f_storageLayout The storage layout used by the searches.
+		InMemoryDb(DbTestRecordCollection&& f_records, DbStorageLayout f_storageLayout = DbStorageLayout::Row);
 
 		/// @brief Searches a set of records for a given string in a given column in a more optimized way.
 		/// @details This is an updated version of the original algorithm from Quickbase. It checks
@@ -45,39 +99,139 @@ namespace xq
 			const std::string& f_matchString, DbTestRecordPointersCollection& f_output) const;
 
 		/// @brief Searches a set of records for a given string in a given column.
-		/// @details This is an updated version of the original algorithm from Quickbase. It stores the provided data 
-		/// in one DbTableTestStringMatcher and uses its methods to process the search. This is a less optimized version
-		/// of the algorithm in the term of speed, but the implementation is generalized and thus allows to use any kind of 
-		/// data table without significant changes, given that the table provides a string matcher class. 
+		/// @details This is an updated version of the original algorithm from Quickbase. It selects the column from
+		/// the compile-time description DbTableTestColumns and matches the records with a DbColumnMatcher specialized
+		/// for it, so the loop over the records is as tight as the hand-written one. The implementation is generalized
+		/// and thus allows to use any kind of data table without significant changes, given that the table describes its columns. 
 		/// @param[in] f_columnName The name of the column to search in.
 		/// @param[in] f_matchString The string to search for.
 		/// @param[out] f_output Contains the records which match the search criteria.
 		void findMatchingRecords(const std::string& f_columnName, 
 			const std::string& f_matchString, DbTestRecordPointersCollection& f_output) const;
 
+		/// @brief Searches a set of records for a given string in a given column into a result set.
+		/// @details Does the same search as findMatchingRecords, but marks the positions of the found records in a bitmap
+		/// instead of collecting pointers to them, so no memory is allocated when the result set is reused. The results
+		/// of several searches can then be intersected or united without copying any records.
+		/// @param[in] f_columnName The name of the column to search in.
+		/// @param[in] f_matchString The string to search for.
+		/// @param[out] f_output Reset to the number of records and contains the positions of the found records.
+		void findMatchingRecords(const std::string& f_columnName,
+			const std::string& f_matchString, DbResultSet& f_output) const;
+
+		/// @brief Searches the records matching all the predicates of a query.
+		/// @details Evaluates all the predicates in one pass over the records. If a predicate can be answered by an index,
+		/// only the records found by the index are checked. The rest of the predicates are checked starting with the
+		/// cheapest ones, so the integer comparisons are done before the substring searches, and the checks of a record
+		/// stop at the first predicate which doesn't match.
+		/// @param[in] f_query The predicates to search for.
+		/// @param[out] f_output Contains the records which match all the predicates, in the order of the records.
+		void findMatchingRecords(const DbQuery& f_query, DbTestRecordPointersCollection& f_output) const;
+
+		/// @brief Searches the records matching all the predicates of a query into a result set.
+		/// @details Evaluates the query the same way as the other overload.
+		/// @param[in] f_query The predicates to search for.
+		/// @param[out] f_output Reset to the number of records and contains the positions of the found records.
+		void findMatchingRecords(const DbQuery& f_query, DbResultSet& f_output) const;
+
+		/// @brief Open a cursor over the records matching all the predicates of a query.
+		/// @details Selects an index the same way as the other query searches, but checks the records only while
+		/// the cursor is advanced. The first record is returned as soon as it is found and no more records are
+		/// checked after the limit is reached. The cursor is valid until the database is modified.
+		/// @param[in] f_query The predicates to search for.
+		/// @param[in] f_limit The maximum number of records returned by the cursor.
+		/// @returns The cursor positioned before the first matching record, in the order of the records.
+		DbRecordCursor openCursor(const DbQuery& f_query, size_t f_limit = DbRecordCursor::cNoLimit) const;
+
+		/// @brief Open a cursor over the records matching a string in a given column.
+		/// @details Does the same as the other overload for a query with a single predicate.
+		/// @param[in] f_columnName The name of the column to search in.
+		/// @param[in] f_matchString The string to search for.
+		/// @param[in] f_limit The maximum number of records returned by the cursor.
+		/// @returns The cursor positioned before the first matching record, in the order of the records.
+		DbRecordCursor openCursor(const std::string& f_columnName, const std::string& f_matchString,
+			size_t f_limit = DbRecordCursor::cNoLimit) const;
+
+		/// @brief Get the record at a given position.
+		/// @param[in] f_index The position of the record, for example taken from a DbResultSet.
+		/// @returns The record at the position. Deleted records have ID 0.
+		const DbTableTest& getRecord(size_t f_index) const;
+
+		/// @brief Find a record with the given id.
+		/// @details Looks up the position of the record in the primary-key index instead of traversing
+		/// the whole collection of records, so the lookup is done in constant time.
+		/// @param[in] f_id The id of the record to look for.
+		/// @returns Pointer to the found record or nullptr if there is no record with the given id.
+		const DbTableTest* findById(uint64_t f_id) const;
+
 		/// @brief Delete a record from the database with the given id.
-		/// @details Traverses the whole collection of records and looks for a record, which matches the selected Id.
+		/// @details Looks up the record with the selected Id in the primary-key index.
 		/// Sets that record's ID to 0 which annotates that the record is deleted. The record is not actually removed from the collection
 		/// because this is a costly operation but instead it's index is saved in another collection to be used later when adding new record.
 		/// This way deleting new records will not require shifting of the remaining and adding new record might not require reallocation
-		/// of new memory.
+		/// of new memory. Once the deleted records are more than the compaction threshold, each deletion also relocates a few of the
+		/// last records into the free slots, so that the collection shrinks step by step. The compaction is disabled by default.
+		/// While it is enabled, a deletion changes the positions of other records, so the pointers and the result sets
+		/// found before any deletion are not valid anymore.
 		/// @param[in] f_id The id of the record to be deleted.
-		void deleteRecordByID(uint32_t f_id);
+		/// @returns False if the mutation could not be written to the write-ahead log and was not applied, true elsewhen.
+		bool deleteRecordByID(uint32_t f_id);
 
 		/// @brief Delete a record from the database with the given id in a non-optimized way.
 		/// @details Traverses the whole collection of records and looks for a record, which matches the selected Id.
 		/// Removes the record from the collection, which also causes all the aftercomming records to be shifted.
+		/// Because of the shifting, the primary-key index has to be rebuilt afterwards.
 		/// @param[in] f_id The id of the record to be deleted.
-		void deleteRecordByIDNonOptimized(uint32_t f_id);
+		/// @returns False if the mutation could not be written to the write-ahead log and was not applied, true elsewhen.
+		bool deleteRecordByIDNonOptimized(uint32_t f_id);
+
+		/// @brief Delete several records from the database with the given ids.
+		/// @details Deletes each record the same way as deleteRecordByID, but checks if the records have to be
+		/// compacted only once after all the records are deleted. Ids, which are not found, are ignored.
+		/// While the compaction is enabled, the pointers and the result sets found before are not valid anymore.
+		/// @param[in] f_ids The ids of the records to be deleted.
+		/// @returns False if the mutation could not be written to the write-ahead log and was not applied, true elsewhen.
+		bool deleteRecordsByIds(const DbRecordIdsCollection& f_ids);
 
 		/// @brief Add a new record to the database.
-		/// @details First checks if there is a free slot in the database by looking at m_freeIds. In case there is,
+		/// @details First checks if there is a free slot in the database by looking at m_freeSlots. In case there is,
 		/// put the new record on its place. In case there is non, push the new record at the back of the records' collection.
+		/// The position of the new record is stored in the primary-key index.
 		/// @param[in] f_newRecord The new record to be added.
-		void addRecord(const DbTableTest& f_newRecord);
+		/// @returns False if the mutation could not be written to the write-ahead log and was not applied, true elsewhen.
+		bool addRecord(const DbTableTest& f_newRecord);
+
+		/// @brief Add a new record to the database, moving its strings into it.
+		/// @details Adds the record the same way as the other overload, but without copying the strings.
+		/// @param[in] f_newRecord The new record to be added.
+		/// @returns False if the mutation could not be written to the write-ahead log and was not applied, true elsewhen.
+		bool addRecord(DbTableTest&& f_newRecord);
+
+		/// @brief Construct a new record from its values and add it to the database.
+		/// @details The values are forwarded to the record, so strings passed as rvalues are not copied.
+		/// @param[in] f_values The id, name, balance and address of the new record.
+		/// @returns False if the mutation could not be written to the write-ahead log and was not applied, true elsewhen.
+		template <typename... TValues>
+		bool emplaceRecord(TValues&&... f_values)
+		{
+			return addRecord(DbTableTest{ std::forward<TValues>(f_values)... });
+		}
+
+		/// @brief Add several new records to the database.
+		/// @details Fills the free slots first. The memory for the rest of the records is reserved
+		/// once and they are moved at the end of the records' collection.
+		/// @param[in] f_newRecords The new records to be added. Their strings are moved into the database.
+		/// @returns False if the mutation could not be written to the write-ahead log and was not applied, true elsewhen.
+		bool addRecords(DbTestRecordCollection&& f_newRecords);
+
+		/// @brief Add several new records to the database.
+		/// @details Copies the records and adds them the same way as the other overload.
+		/// @param[in] f_newRecords The new records to be added.
+		/// @returns False if the mutation could not be written to the write-ahead log and was not applied, true elsewhen.
+		bool addRecords(const DbTestRecordCollection& f_newRecords);
 
 		/// @brief Gets the number of deleted records.
-		/// @details Gets the number of elements in the m_freeIds member variable.
+		/// @details Gets the number of free slots, which are still part of the collection of records.
 		/// @returns Number of deleted records.
 		uint64_t getNumberOfDeletedRecords() const;
 
@@ -85,9 +239,376 @@ namespace xq
 		/// @returns The number of available records, which are not considered deleted.
 		uint64_t getNumberOfRecords() const;
 
+		/// @brief Remove all the deleted records from the collection of records.
+		/// @details Moves the last records into the free slots and shrinks the collection, so that the searches
+		/// traverse only the records which are not deleted. The positions of the moved records change, so the
+		/// pointers and the result sets found before are not valid anymore.
+		void compact();
+
+		/// @brief Save the records, which are not deleted, into a binary snapshot file.
+		/// @details The file is column-oriented and can be mapped into memory. See DbSnapshot for the format.
+		/// The snapshot is written into a temporary file with the suffix ".tmp" first and then renamed, so an existing
+		/// file is never rewritten in place. Saving over the snapshot loaded by this database is safe while it is searched.
+		/// @param[in] f_path The path of the file. An existing file is replaced.
+		/// @returns True if the snapshot was saved, false elsewhen.
+		bool saveSnapshot(const std::string& f_path) const;
+
+		/// @brief Replace all the records with the records from a binary snapshot file.
+		/// @details Maps the file into memory and reads every column sequentially, instead of parsing the file
+		/// record by record. The storage layout and the enabled indexes and encodings are kept and rebuilt.
+		/// With the column layout the columns use the arrays of the file in place and the file stays mapped until
+		/// another snapshot is loaded or the database is destroyed. A column is copied at its first modification.
+		/// The records themselves are still copied out of the file, as the searches return pointers to them,
+		/// so the loading time grows with the number of records. If the file cannot be loaded, the database is
+		/// not changed.
+		/// @param[in] f_path The path of the file.
+		/// @returns True if the snapshot was loaded, false if the file cannot be opened or is not a valid snapshot.
+		bool loadSnapshot(const std::string& f_path);
+
+		/// @brief Log every following addition and deletion of records into a write-ahead log file.
+		/// @details The mutations are appended to the log before the records are changed. Every call of a function adding
+		/// or deleting records is one commit, so a batch of records is synced together. A mutation, whose commit fails,
+		/// is not applied and reported as failed. It might still have reached the file, like a write interrupted by a
+		/// power loss. After a failure the log rejects all the following mutations until it is enabled again. Replay the existing entries of
+		/// the file first, the new entries are appended after them.
+		/// @param[in] f_path The path of the log file. Created if it doesn't exist.
+		/// @param[in] f_syncPolicy When the entries are forced to the storage device.
+		/// @param[in] f_groupSize The number of commits synced together with DbWalSyncPolicy::GroupCommit.
+		/// @returns True if the log file was opened, false elsewhen.
+		bool enableWriteAheadLog(const std::string& f_path, DbWalSyncPolicy f_syncPolicy = DbWalSyncPolicy::GroupCommit,
+			uint32_t f_groupSize = 64);
+
+		/// @brief Check if the mutations are logged.
+		/// @returns True if a write-ahead log is enabled, false elsewhen.
+		bool hasWriteAheadLog() const;
+
+		/// @brief Write and sync the pending entries of the write-ahead log independent of its sync policy.
+		/// @returns True if all the logged mutations are stored, false if the log is not enabled or a write failed.
+		bool syncWriteAheadLog();
+
+		/// @brief Apply the mutations from a write-ahead log file to the records.
+		/// @details Adds and deletes the records in the order of the log through the usual functions, so the records,
+		/// the free slots and the indexes end up as before the restart. The replayed mutations are not logged again.
+		/// Additions of ids, which are already present, are skipped, so replaying a log again on top of a snapshot,
+		/// which already contains its mutations, gives the same records. The entries after the first incomplete
+		/// or corrupted one are ignored.
+		/// @param[in] f_path The path of the log file. A missing file contains no mutations.
+		/// @returns True if the file was replayed, false if it cannot be read.
+		bool replayWriteAheadLog(const std::string& f_path);
+
+		/// @brief Save a snapshot and empty the write-ahead log.
+		/// @details The snapshot is written into a temporary file first and then renamed, so the previous snapshot
+		/// stays valid until the new one is complete. The file and the rename are synced to the storage device and
+		/// only then the log is emptied, so a power loss never leaves an empty log without the snapshot. Recovering loads the snapshot and replays only the mutations
+		/// logged since the checkpoint, so the recovery time is bounded by the time between the checkpoints.
+		/// @param[in] f_snapshotPath The path of the snapshot file.
+		/// @returns True if the snapshot was saved and the log emptied, false elsewhen.
+		bool checkpoint(const std::string& f_snapshotPath);
+
+		/// @brief Cache the results of the searches for a string in a column.
+		/// @details A repeated search returns the cached positions of the found records instead of scanning the records.
+		/// The searches are normalized, so the same value of an integer column written differently is the same search.
+		/// Every addition or deletion of records invalidates the whole cache. Only findMatchingRecords with a column,
+		/// a string and a collection of pointers is cached. Enabling the cache again replaces it with an empty one.
+		/// @param[in] f_maximumSize The maximum number of cached positions. Each result takes one more.
+		void enableQueryCache(size_t f_maximumSize = 1048576);
+
+		/// @brief Check if the search results are cached.
+		/// @returns True if the query cache is enabled, false elsewhen.
+		bool hasQueryCache() const;
+
+		/// @brief Get the number of searches answered by the query cache.
+		/// @returns The number of hits, 0 if the cache is not enabled.
+		uint64_t getNumberOfQueryCacheHits() const;
+
+		/// @brief Get the number of searches not answered by the query cache.
+		/// @returns The number of misses, 0 if the cache is not enabled.
+		uint64_t getNumberOfQueryCacheMisses() const;
+
+		/// @brief Set when the deletions start compacting the records.
+		/// @details The compaction is disabled by default, as it moves records and so invalidates the pointers
+		/// and the result sets. compact() removes all the deleted records independent of the threshold.
+		/// @param[in] f_tombstoneRatio The part of the records, which has to be deleted, before the deletions start
+		/// compacting the records. The value 1 disables the compaction.
+		void setCompactionThreshold(double f_tombstoneRatio);
+
+		/// @brief Get when the deletions start compacting the records.
+		/// @returns The part of the records, which has to be deleted, before the deletions start compacting the records.
+		double getCompactionThreshold() const;
+
+		/// @brief Get the storage layout used by the searches.
+		/// @returns The storage layout selected when constructing the database.
+		DbStorageLayout getStorageLayout() const;
+
+		/// @brief Set the number of threads used by the searches.
+		/// @details The records are split into one chunk per thread and every chunk is scanned in parallel.
+		/// The found records are the same and in the same order as with a single thread. Small collections
+		/// of records are still scanned by a single thread, since starting the threads would take longer.
+		/// @param[in] f_numberOfThreads The number of threads. If 0, the number of hardware threads is used.
+		void setNumberOfThreads(uint32_t f_numberOfThreads);
+
+		/// @brief Get the number of threads used by the searches.
+		/// @returns The number of threads.
+		uint32_t getNumberOfThreads() const;
+
+		/// @brief Enable the trigram index for a string column.
+		/// @details Builds the trigram index from the records and keeps it up to date when adding and deleting records.
+		/// Both searches use the index for that column to check only the records containing all the trigrams of the
+		/// searched string. Searched strings shorter than three characters still traverse all the records.
+		/// @param[in] f_columnName The name of the string column to be indexed - column1 or column3.
+		void enableTrigramIndex(const std::string& f_columnName);
+
+		/// @brief Check if the trigram index is enabled for a column.
+		/// @param[in] f_columnName The name of the column.
+		/// @returns True if the column has a trigram index, false elsewhen.
+		bool hasTrigramIndex(const std::string& f_columnName) const;
+
+		/// @brief Enable the dictionary encoding for a string column.
+		/// @details Stores every distinct string of the column once and a 32-bit code per record. A substring search
+		/// checks the distinct strings once and then only compares the codes of the records. Only the column layout
+		/// keeps separate columns, so with the row layout the records own their strings and nothing is changed.
+		/// @param[in] f_columnName The name of the string column to be encoded - column1 or column3.
+		void enableDictionaryEncoding(const std::string& f_columnName);
+
+		/// @brief Check if the dictionary encoding is enabled for a column.
+		/// @param[in] f_columnName The name of the column.
+		/// @returns True if the column is dictionary encoded, false elsewhen.
+		bool hasDictionaryEncoding(const std::string& f_columnName) const;
+
+		/// @brief Enable the compression for an integer column.
+		/// @details Packs the values of the column in blocks with frame of reference and bit-packing. The equality
+		/// and range searches compare the packed values without decompressing them and skip the blocks,
+		/// which cannot contain the searched values. Only the column layout keeps separate columns,
+		/// so with the row layout nothing is changed.
+		/// @param[in] f_columnName The name of the integer column to be compressed - column0 or column2.
+		void enableIntegerCompression(const std::string& f_columnName);
+
+		/// @brief Check if the compression is enabled for a column.
+		/// @param[in] f_columnName The name of the column.
+		/// @returns True if the column is compressed, false elsewhen.
+		bool hasIntegerCompression(const std::string& f_columnName) const;
+
+		/// @brief Enable the ordered index for the balance column.
+		/// @details Builds the balance index from the records and keeps it up to date when adding and deleting records.
+		/// Range searches and the searches for an exact balance use the index instead of traversing all the records.
+		void enableBalanceIndex();
+
+		/// @brief Check if the balance index is enabled.
+		/// @returns True if the balance column has an ordered index, false elsewhen.
+		bool hasBalanceIndex() const;
+
+		/// @brief Searches for the records with a balance in a given range.
+		/// @details Finds the records with f_lowerBound <= balance <= f_upperBound. Use std::numeric_limits<int32_t>
+		/// as one of the bounds for the records with balance below or above a given value. With the balance index
+		/// the search takes O(log N + k) for k found records and they are ordered by balance. Without the index
+		/// all the records are traversed and the found ones are in the order of the records.
+		/// @param[in] f_lowerBound The lowest balance to be found.
+		/// @param[in] f_upperBound The highest balance to be found.
+		/// @param[out] f_output Contains the records with a balance in the range.
+		void findRecordsByBalanceRange(int32_t f_lowerBound, int32_t f_upperBound, DbTestRecordPointersCollection& f_output) const;
+
+		/// @brief Searches the first records matching a query in the order of a column.
+		/// @details Works like ORDER BY with LIMIT. The matching records are kept in a heap of at most f_limit records
+		/// while the records are scanned, so the memory doesn't depend on the number of matching records. When ordering
+		/// by balance with the balance index and no other index answers the query, the index is walked in order
+		/// and the walk stops at the last needed record.
+		/// @param[in] f_query The predicates to search for. A query without predicates matches all the records.
+		/// @param[in] f_orderColumnName The name of the column to order by.
+		/// @param[in] f_sortOrder The direction of the order.
+		/// @param[in] f_limit The maximum number of records to be found.
+		/// @param[out] f_output Contains the first f_limit matching records in the requested order.
+		void findTopRecords(const DbQuery& f_query, const std::string& f_orderColumnName, DbSortOrder f_sortOrder,
+			size_t f_limit, DbTestRecordPointersCollection& f_output) const;
+
+		/// @brief Aggregate an integer column over the records matching a query.
+		/// @details Computes COUNT, SUM, MIN, MAX and AVG inside the scan loop, without collecting the matching records.
+		/// Every thread aggregates its own chunk of the records and the partial aggregates are merged at the end.
+		/// Aggregating the balances of all the records with the column layout uses the vectorized scan kernels.
+		/// @param[in] f_query The predicates to search for. A query without predicates matches all the records.
+		/// @param[in] f_valueColumnName The name of the integer column to aggregate.
+		/// @param[in,out] f_output The aggregate, to which the values of the matching records are added.
+		/// @returns True if the column is an integer column and was aggregated, false elsewhen.
+		bool aggregate(const DbQuery& f_query, const std::string& f_valueColumnName, DbAggregate& f_output) const;
+
+		/// @brief Aggregate an integer column per group of the records matching a query.
+		/// @details Works like GROUP BY. Every thread aggregates its own chunk of the records into a hash table
+		/// keyed by the value of the grouping column, and the tables are merged at the end. The string columns
+		/// are keyed by views of the records, so no string is copied until the merge.
+		/// @param[in] f_query The predicates to search for. A query without predicates matches all the records.
+		/// @param[in] f_groupColumnName The name of the column to group by.
+		/// @param[in] f_valueColumnName The name of the integer column to aggregate.
+		/// @param[in,out] f_output The aggregates of the groups, to which the values of the matching records are added.
+		/// The groups of the integer columns are keyed by the values converted to strings.
+		/// @returns True if the column is an integer column and was aggregated, false elsewhen.
+		bool aggregateByGroup(const DbQuery& f_query, const std::string& f_groupColumnName,
+			const std::string& f_valueColumnName, DbAggregateGroupsCollection& f_output) const;
+
 	private:
+		/// @brief Searches the records for a given string in a given column without the query cache.
+		/// @param[in] f_columnName The name of the column to search in.
+		/// @param[in] f_matchString The string to search for.
+		/// @param[out] f_output Contains the records which match the search criteria.
+		void findMatchingRecordsWithoutCache(const std::string& f_columnName,
+			const std::string& f_matchString, DbTestRecordPointersCollection& f_output) const;
+
+		/// @brief Searches the secondary indexes of a column for a given string.
+		/// @details Uses the trigram index for the string columns and the balance index for the balance column.
+		/// @param[in] f_columnName The name of the column to search in.
+		/// @param[in] f_matchString The string to search for.
+		/// @param[out] f_output Contains the positions of the records which match the search criteria.
+		/// @returns True if the search was done using an index, false if the column has no index
+		/// or the searched string cannot use it.
+		bool findMatchingIndexesInSecondaryIndexes(const std::string& f_columnName,
+			const std::string& f_matchString, DbRecordIndexesCollection& f_output) const;
+
+		/// @brief Prepare the evaluation of a query.
+		/// @details Selects the predicate with the most selective index - the primary-key index, then the balance index
+		/// and then the trigram index with the longest searched string. The rest of the predicates get a matcher each,
+		/// ordered by their cost.
+		/// @param[in] f_query The predicates to search for.
+		/// @param[out] f_candidateIndexes Contains the positions of the records found by the selected index.
+		/// @param[out] f_matchers Contains the matchers of the predicates, which are not answered by the index.
+		/// @returns True if an index was used and only the candidates have to be checked, false elsewhen.
+		bool prepareQuery(const DbQuery& f_query, DbRecordIndexesCollection& f_candidateIndexes,
+			DbTableTestMatchersCollection& f_matchers) const;
+
+		/// @brief Add pointers to the records at given positions.
+		/// @param[in] f_indexes The positions of the records.
+		/// @param[out] f_output Contains the added records.
+		void appendRecords(const DbRecordIndexesCollection& f_indexes, DbTestRecordPointersCollection& f_output) const;
+
+		/// @brief Add a record to all the indexes.
+		/// @param[in] f_index The position of the record.
+		void addToIndexes(size_t f_index);
+
+		/// @brief Remove a record from all the indexes.
+		/// @details Shall be called before the record is changed, since the indexes are looked up by its values.
+		/// @param[in] f_index The position of the record.
+		void removeFromIndexes(size_t f_index);
+
+		/// @brief Rebuild the zone of a record in the zone maps from the records, which are not deleted.
+		/// @param[in] f_removedIndex The position of the record, which is removed and shall be skipped.
+		void rebuildZone(size_t f_removedIndex);
+
+		/// @brief Searches the column arrays for a given string in a given column.
+		/// @details Used by both searches when the column layout is selected. Deleted records are skipped.
+		/// The integer columns are compared using the vectorized scan kernels.
+		/// @param[in] f_columnName The name of the column to search in.
+		/// @param[in] f_matchString The string to search for.
+		/// @param[out] f_output Contains the records which match the search criteria.
+		void findMatchingRecordsInColumns(const std::string& f_columnName,
+			const std::string& f_matchString, DbTestRecordPointersCollection& f_output) const;
+
+		/// @brief Searches a string column array for a given substring.
+		/// @details For a dictionary encoded column the distinct strings are searched once, 
+		/// and then the records are selected by their code. Deleted records are skipped.
+		/// @param[in] f_column The string column to search in.
+		/// @param[in] f_matchString The substring to search for.
+		/// @param[out] f_output Contains the records which match the search criteria.
+		void findMatchingRecordsInStringColumn(const DbStringColumn& f_column,
+			const std::string& f_matchString, DbTestRecordPointersCollection& f_output) const;
+
+		/// @brief Get the number of chunks the records shall be scanned in.
+		/// @returns The number of threads, limited so that every thread has enough records to process.
+		size_t getNumberOfPartitions() const;
+
+		/// @brief Run a function for contiguous chunks of the records, each one on its own thread.
+		/// @details The current thread takes care of the first chunk.
+		/// @param[in] f_numberOfPartitions The number of chunks.
+		/// @param[in] f_alignment Every chunk, except the last one, has a size which is a multiple of that.
+		/// @param[in] f_scanPartition Function called with the number of the chunk, its first and its past-the-end position.
+		template <typename TScanPartition>
+		void runInPartitions(size_t f_numberOfPartitions, size_t f_alignment, TScanPartition f_scanPartition) const;
+
+		/// @brief Scan the records in parallel chunks.
+		/// @details Splits the positions of the records into one contiguous chunk per thread. Every chunk is
+		/// scanned into a buffer of its own and the buffers are merged in the order of the records.
+		/// @param[in] f_scanChunk Function called with the first and the past-the-end position of a chunk
+		/// and the collection where the found records of the chunk are to be stored.
+		/// @param[out] f_output Contains the found records of all the chunks.
+		template <typename TScanChunk>
+		void scanInPartitions(TScanChunk f_scanChunk, DbTestRecordPointersCollection& f_output) const;
+
+		/// @brief Collect all the records matching a given predicate.
+		/// @details Traverses the positions of all the records and adds a pointer to every record
+		/// for which the predicate returns true. The positions are traversed in parallel chunks.
+		/// @param[in] f_predicate Function called with the position of each record.
+		/// @param[out] f_output Contains the records which match the predicate.
+		template <typename TPredicate>
+		void collectMatchingRecords(TPredicate f_predicate, DbTestRecordPointersCollection& f_output) const;
+
+		/// @brief Mark all the records matching a given predicate in a result set.
+		/// @details The positions are traversed in parallel chunks aligned to the words of the bitmap,
+		/// so that the threads never write to the same word.
+		/// @param[in] f_predicate Function called with the position of each record.
+		/// @param[out] f_output Contains the records which match the predicate.
+		template <typename TPredicate>
+		void markMatchingRecords(TPredicate f_predicate, DbResultSet& f_output) const;
+
+		/// @brief Scan only the parts of the records, whose zones might contain values between two bounds.
+		/// @details The parts are scanned in parallel chunks, the same way as with scanInPartitions.
+		/// @param[in] f_zoneMap The zone map of the searched column.
+		/// @param[in] f_lowerBound The smallest searched value.
+		/// @param[in] f_upperBound The largest searched value.
+		/// @param[in] f_scanZone Function called with the first and the past-the-end position of a part
+		/// and the collection where the found records are to be stored.
+		/// @param[out] f_output Contains the found records of all the parts.
+		template <typename TValue, typename TScanZone>
+		void scanMatchingZones(const DbZoneMap<TValue>& f_zoneMap, TValue f_lowerBound, TValue f_upperBound,
+			TScanZone f_scanZone, DbTestRecordPointersCollection& f_output) const;
+
+		/// @brief Search the records for a given value of an integer column, skipping the zones which cannot contain it.
+		/// @details Used by both searches when the row layout is selected.
+		/// @param[in] f_columnName The name of the column to search in.
+		/// @param[in] f_matchString The string to search for.
+		/// @param[out] f_output Contains the records which match the search criteria.
+		/// @returns True if the column is an integer column and was searched, false elsewhen.
+		bool findMatchingRecordsInZones(const std::string& f_columnName,
+			const std::string& f_matchString, DbTestRecordPointersCollection& f_output) const;
+
+		/// @brief Rebuild all the indexes.
+		/// @details Adds each record, which is not deleted, to the primary-key index and the enabled secondary indexes.
+		/// The positions of the deleted records are collected again as free slots.
+		void rebuildIndexes();
+
+		/// @brief Mark the record at a given position as deleted and keep its slot for a later use.
+		/// @param[in] f_index The position of the record, which is not deleted yet.
+		void markRecordDeleted(size_t f_index);
+
+		/// @brief Take a free slot to place a record in.
+		/// @details Skips the free slots, which were removed or reused by the compaction meanwhile.
+		/// @param[out] f_slot The position of the free slot.
+		/// @returns True if a free slot was found, false elsewhen.
+		bool takeFreeSlot(size_t& f_slot);
+
+		/// @brief Relocate some of the last records into free slots and shrink the collection of records.
+		/// @param[in] f_maximumRelocations The maximum number of records to be moved.
+		void compactRecords(size_t f_maximumRelocations);
+
+		/// @brief Remove the last record from the collection of records and from the columns.
+		void removeLastRecord();
+
 		DbTestRecordCollection m_records; ///< Collection with all the users records.
-		DbFreeIdsCollection m_freeIndexes; ///< Collection with indexes of deleted records, which can be used to add new records.
+		DbFreeSlotsCollection m_freeSlots; ///< Stack with the positions of deleted records, which can be used to add new records.
+		uint64_t m_numberOfDeletedRecords; ///< The number of deleted records still in the collection of records.
+		double m_compactionThreshold; ///< The part of the records, which has to be deleted, before the deletions start compacting.
+		DbIdIndexCollection m_idIndex; ///< Primary-key index mapping the id of each record to its position in m_records.
+		DbStorageLayout m_storageLayout; ///< The storage layout used by the searches.
+		std::unique_ptr<DbSnapshot> m_snapshot; ///< The loaded snapshot, whose arrays the columns use in place.
+		DbTableTestColumnStore m_columns; ///< The columns of the records, filled only with the column layout.
+		DbScanKernels m_scanKernels; ///< The scan kernels for the integer columns, selected depending on the processor.
+		uint32_t m_numberOfThreads; ///< The number of threads used by the searches.
+		std::optional<DbTrigramIndex> m_nameTrigramIndex; ///< Trigram index of the names, if enabled.
+		std::optional<DbTrigramIndex> m_addressTrigramIndex; ///< Trigram index of the addresses, if enabled.
+		std::optional<DbBalanceIndex> m_balanceIndex; ///< Ordered index of the balances, if enabled.
+		DbZoneMap<uint64_t> m_idZoneMap; ///< Smallest and largest id per zone of records.
+		DbZoneMap<int32_t> m_balanceZoneMap; ///< Smallest and largest balance per zone of records.
+		std::unique_ptr<DbWriteAheadLog> m_writeAheadLog; ///< Log of the mutations, if enabled.
+		std::unique_ptr<DbQueryCache> m_queryCache; ///< Cache of the search results, if enabled.
+		uint64_t m_recordsVersion; ///< Changed with every modification of the records, which invalidates the query cache.
 	};
+
+	// Definition for the Mutation Function applied to a database by the concurrent databases
+	typedef std::function<void(InMemoryDb&)> DbMutationFunction;
 } /// namespace xq
 #endif /// !IN_MEMORY_DB_HPP
@@ -11,7 +11,7 @@
 #ifndef PERFORMANCE_TESTER_HPP
 #define PERFORMANCE_TESTER_HPP
 
-#include "DbTableTest.hpp"
+#include "InMemoryDb.hpp"
 
 namespace xq
 {
@@ -48,7 +48,165 @@ namespace xq
 		/// @param[in] f_id The ID of the record to be deleted. 
 		void measureAddNewRecord(uint64_t f_numberOfRecords, uint32_t f_id) const;
 
+		/// @brief Measure the performance of the Find Record By Id operation.
+		/// @details Measures the time to find a record with the given ID using the primary-key index
+		/// and compares it against traversing all the records in search for that ID.
+		/// @param[in] f_numberOfRecords The number of total records to generate and search among. 
+		/// @param[in] f_id The ID of the record to be found. 
+		void measureFindRecordByIdPerformance(uint64_t f_numberOfRecords, uint32_t f_id) const;
+
+		/// @brief Measure the performance of the Find Matching Records operation for both storage layouts.
+		/// @details Measures the time to search the balance, the id and the name columns once with the row layout
+		/// and once with the column layout of the database.
+		/// @param[in] f_numberOfRecords The number of total records to generate and search among. 
+		void measureStorageLayoutPerformance(uint64_t f_numberOfRecords) const;
+
+		/// @brief Measure the performance of the scan kernels for the integer columns.
+		/// @details Measures the time to search an id column and a balance column with every
+		/// scan kernel supported by the processor. Only the columns are generated, without
+		/// the rest of the records, so that the kernels can be measured on large amounts of records.
+		/// @param[in] f_numberOfRecords The number of values to generate and search among. 
+		void measureScanKernelsPerformance(uint64_t f_numberOfRecords) const;
+
+		/// @brief Measure the performance of the Find Matching Records operation on several threads.
+		/// @details Measures the time to search for matching names and addresses in the database
+		/// with the given number of threads and compares it against a single thread.
+		/// @param[in] f_numberOfRecords The number of total records to generate and search among. 
+		/// @param[in] f_numberOfThreads The number of threads to search with.
+		void measureFindMatchingRecordsParallelPerformance(uint64_t f_numberOfRecords, uint32_t f_numberOfThreads) const;
+
+		/// @brief Measure the performance of the Find Matching Records operation with a trigram index.
+		/// @details Measures the time to search for a unique name in the database without and with 
+		/// a trigram index of the name column. Also measures the time to build the index.
+		/// @param[in] f_numberOfRecords The number of total records to generate and search among. 
+		void measureTrigramIndexPerformance(uint64_t f_numberOfRecords) const;
+
+		/// @brief Measure the performance of the balance range search with an ordered index.
+		/// @details Measures the time to search for the records in a narrow balance range without and 
+		/// with the balance index. Also measures the time to build the index.
+		/// @param[in] f_numberOfRecords The number of total records to generate and search among. 
+		void measureBalanceRangePerformance(uint64_t f_numberOfRecords) const;
+
+		/// @brief Measure the performance of combining two searches with result sets.
+		/// @details Measures the time to find the records matching both a name and a balance using
+		/// collections of pointers to the records and using result sets, also when the result sets are reused.
+		/// @param[in] f_numberOfRecords The number of total records to generate and search among. 
+		void measureResultSetPerformance(uint64_t f_numberOfRecords) const;
+
+		/// @brief Measure the performance of a query with several predicates.
+		/// @details Measures the time to find the records matching both a name and a balance with two 
+		/// searches and with a single query, also when the query can use the balance index.
+		/// @param[in] f_numberOfRecords The number of total records to generate and search among. 
+		void measureQueryPerformance(uint64_t f_numberOfRecords) const;
+
+		/// @brief Measure the performance of the compaction of the deleted records.
+		/// @details Measures the time to delete most of the records, while they are compacted, and the time 
+		/// to search among the remaining records with and without the compaction.
+		/// @param[in] f_numberOfRecords The number of total records to generate and delete from. 
+		void measureCompactionPerformance(uint64_t f_numberOfRecords) const;
+
+		/// @brief Measure the performance of the batch operations.
+		/// @details Measures the time to construct the database by copying and by moving the records, and the time
+		/// to add and delete many records one by one and in a batch.
+		/// @param[in] f_numberOfRecords The number of records to construct the database with and to add to it. 
+		void measureBatchOperationsPerformance(uint64_t f_numberOfRecords) const;
+
+		/// @brief Measure the performance of loading the records into the database.
+		/// @details Measures the time and the number of heap allocations to load the records by copying them
+		/// and by moving or constructing them in place.
+		/// @param[in] f_numberOfRecords The number of records to load. 
+		void measureLoadPerformance(uint64_t f_numberOfRecords) const;
+
+		/// @brief Measure the performance of the string arena of the column-oriented storage.
+		/// @details Measures the heap memory taken by the columns and the time to search the string columns
+		/// in the row-oriented and the column-oriented storage. The strings are longer than the small string buffer.
+		/// @param[in] f_numberOfRecords The number of total records to generate and search among. 
+		void measureStringArenaPerformance(uint64_t f_numberOfRecords) const;
+
+		/// @brief Measure the performance of the dictionary encoding.
+		/// @details Measures the heap memory taken by the columns and the time to search the address column
+		/// with and without dictionary encoding. The addresses repeat one of 1000 distinct values.
+		/// @param[in] f_numberOfRecords The number of total records to generate and search among. 
+		void measureDictionaryEncodingPerformance(uint64_t f_numberOfRecords) const;
+
+		/// @brief Measure the performance of the integer compression.
+		/// @details Measures the heap memory taken by the compressed integer columns and the time to search them
+		/// compared to the plain columns.
+		/// @param[in] f_numberOfRecords The number of total records to generate and search among. 
+		void measureIntegerCompressionPerformance(uint64_t f_numberOfRecords) const;
+
+		/// @brief Measure the performance of the zone maps.
+		/// @details Measures the time of the integer searches without the primary-key and the balance index
+		/// on clustered data, where the zone maps skip most of the records.
+		/// @param[in] f_numberOfRecords The number of total records to generate and search among. 
+		void measureZoneMapsPerformance(uint64_t f_numberOfRecords) const;
+
+		/// @brief Measure the performance of the binary snapshots.
+		/// @details Measures the time of saving a snapshot, opening it and loading it into a database,
+		/// compared to generating the same records and constructing the database from them.
+		/// @param[in] f_numberOfRecords The number of total records to generate, save and load. 
+		void measureSnapshotPerformance(uint64_t f_numberOfRecords) const;
+
+		/// @brief Measure the performance of the write-ahead log.
+		/// @details Measures the time of adding and then deleting records one by one without a log and with a log
+		/// for each sync policy, so that every mutation is one commit. Measures the time of replaying the log as well.
+		/// @param[in] f_numberOfMutations The number of records to add and delete. 
+		void measureWriteAheadLogPerformance(uint64_t f_numberOfMutations) const;
+
+		/// @brief Measure the performance of concurrent reads and writes.
+		/// @details Several reader threads look up records by id, while one writer thread adds and deletes records.
+		/// Measures the time until all of them are done with a database guarded by a reader/writer lock
+		/// and with the concurrent database, where the readers never block.
+		/// @param[in] f_numberOfRecords The number of total records to generate and search among. 
+		void measureConcurrencyPerformance(uint64_t f_numberOfRecords) const;
+
+		/// @brief Measure how the writes scale with the number of writer threads.
+		/// @details Every thread adds and then deletes its own records one by one. Measures the time until all the threads
+		/// are done with a database guarded by a single lock and with the sharded database, for a growing number of threads.
+		/// @param[in] f_numberOfWrites The total number of records to add and delete by all the threads. 
+		void measureShardingPerformance(uint64_t f_numberOfWrites) const;
+
+		/// @brief Measure the performance of the cursors.
+		/// @details Measures walking all the records matching a search, collected into a vector and fetched
+		/// from a cursor in batches, as well as the time until the first record and the first few records.
+		/// @param[in] f_numberOfRecords The number of total records to generate and search among. 
+		void measureCursorPerformance(uint64_t f_numberOfRecords) const;
+
+		/// @brief Measure the performance of the Top-K searches.
+		/// @details Measures finding the records with the largest balances, by sorting all the matching records
+		/// and by keeping only the best ones in a bounded heap, as well as by walking the balance index.
+		/// @param[in] f_numberOfRecords The number of total records to generate and search among. 
+		void measureTopRecordsPerformance(uint64_t f_numberOfRecords) const;
+
+		/// @brief Measure the performance of the aggregations.
+		/// @details Measures summing the balances of the matching records collected into a vector and aggregated
+		/// inside the scan with the row and the column layout, as well as grouping the balances by their value.
+		/// @param[in] f_numberOfRecords The number of total records to generate and aggregate. 
+		void measureAggregationPerformance(uint64_t f_numberOfRecords) const;
+
+		/// @brief Measure the performance of the query cache.
+		/// @details Measures repeating the same searches without and with the query cache,
+		/// as well as the first search after a modification invalidated the cache.
+		/// @param[in] f_numberOfRecords The number of total records to generate and search among. 
+		void measureQueryCachePerformance(uint64_t f_numberOfRecords) const;
+
 	private:
+		/// @brief Measure the time of adding and deleting records one by one.
+		/// @param[in] f_testData The records to add and delete.
+		/// @param[in] f_logPath The path of the write-ahead log. If empty, the mutations are not logged.
+		/// @param[in] f_syncPolicy The sync policy of the log.
+		/// @param[in] f_operationName The name of the operation to be printed.
+		void measureMutations(const DbTestRecordCollection& f_testData, const std::string& f_logPath,
+			DbWalSyncPolicy f_syncPolicy, const std::string& f_operationName) const;
+
+		/// @brief Measure the time of the Find Matching Records operation with a given storage layout.
+		/// @param[in] f_testData The records to search among.
+		/// @param[in] f_storageLayout The storage layout of the database.
+		/// @param[in] f_layoutName The name of the storage layout to be printed.
+		/// @returns The number of found records in all the searches.
+		uint64_t measureFindMatchingRecordsWithLayout(const DbTestRecordCollection& f_testData,
+			DbStorageLayout f_storageLayout, const std::string& f_layoutName) const;
+
 		/// @brief Generates test data.
 		/// @details Generates test data to be used for testing the algorithms and store it in a collection.
 		/// @param[in] f_prefixSuffix The string to be used to populate the string members of the test data. 
@@ -0,0 +1,107 @@
+/// @file ShardedInMemoryDb.hpp
+///
+/// @brief Definition of the in-memory database class ShardedInMemoryDb.
+/// @details Splits the records by the hash of their id into several independent databases,
+/// so that writers of different records don't wait for each other.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#ifndef SHARDED_IN_MEMORY_DB_HPP
+#define SHARDED_IN_MEMORY_DB_HPP
+
+#include "InMemoryDb.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <vector>
+
+namespace xq
+{
+    /// @class ShardedInMemoryDb
+    /// @brief In-memory database split into shards, each with its own lock.
+    /// @details Every shard is a whole InMemoryDb with its own records, free slots and indexes, guarded by its own
+    /// reader/writer lock. The shard of a record is selected by the hash of its id, so the operations on a single
+    /// record lock only one shard and the writers of different shards run in parallel. The searches lock every shard
+    /// for reading, search the shards in parallel and merge the found records. A search sees each shard at some
+    /// point during the search, not all the shards at the same moment.
+    class ShardedInMemoryDb
+    {
+    public:
+        /// @brief Class constructor with arguments.
+        /// @details Distributes the records among the shards and constructs every shard from its records.
+        /// @param[in] f_records The records to be stored in the database.
+        /// @param[in] f_numberOfShards The number of shards. If 0, the number of hardware threads is used.
+        /// @param[in] f_storageLayout The storage layout used by the searches of every shard.
+        ShardedInMemoryDb(const DbTestRecordCollection& f_records, uint32_t f_numberOfShards = 0,
+            DbStorageLayout f_storageLayout = DbStorageLayout::Row);
+
+        /// @brief Add a new record to the database.
+        /// @details Locks only the shard of the record.
+        /// @param[in] f_newRecord The new record to be added.
+        void addRecord(const DbTableTest& f_newRecord);
+
+        /// @brief Add several new records to the database.
+        /// @details Groups the records by their shard and locks every shard once.
+        /// @param[in] f_newRecords The new records to be added.
+        void addRecords(const DbTestRecordCollection& f_newRecords);
+
+        /// @brief Delete a record from the database with the given id.
+        /// @details Locks only the shard of the record.
+        /// @param[in] f_id The id of the record to be deleted.
+        void deleteRecordByID(uint32_t f_id);
+
+        /// @brief Delete several records from the database with the given ids.
+        /// @details Groups the ids by their shard and locks every shard once.
+        /// @param[in] f_ids The ids of the records to be deleted.
+        void deleteRecordsByIds(const DbRecordIdsCollection& f_ids);
+
+        /// @brief Find a record with the given id.
+        /// @details Locks only the shard of the record.
+        /// @param[in] f_id The id of the record to look for.
+        /// @param[out] f_record The copy of the found record.
+        /// @returns True if the record was found, false elsewhen.
+        bool findById(uint64_t f_id, DbTableTest& f_record) const;
+
+        /// @brief Searches the records for a given string in a given column.
+        /// @details Searches the shards in parallel, if they are large enough.
+        /// @param[in] f_columnName The name of the column to search in.
+        /// @param[in] f_matchString The string to search for.
+        /// @param[out] f_output Contains copies of the found records, ordered by shard and by position within the shard.
+        void findMatchingRecords(const std::string& f_columnName, const std::string& f_matchString,
+            DbTestRecordCollection& f_output) const;
+
+        /// @brief Apply a mutation to every shard.
+        /// @details Used to configure all the shards the same way, for example to enable an index.
+        /// @param[in] f_mutation Function called with every shard, while it is locked for writing.
+        void writeAllShards(const DbMutationFunction& f_mutation);
+
+        /// @brief Get the number of records in the database.
+        /// @returns The number of available records, which are not considered deleted.
+        uint64_t getNumberOfRecords() const;
+
+        /// @brief Get the number of shards.
+        /// @returns The number of shards.
+        uint32_t getNumberOfShards() const;
+
+    private:
+        /// @struct DbShard
+        /// @brief A database with its lock, alone in its cache lines.
+        struct alignas(64) DbShard
+        {
+            mutable std::shared_mutex mutex; ///< Guards the database.
+            InMemoryDb database; ///< The records of the shard.
+        };
+
+        /// @brief Get the shard of a record.
+        /// @param[in] f_id The id of the record.
+        /// @returns The index of the shard.
+        size_t getShardIndex(uint64_t f_id) const;
+
+        std::vector<std::unique_ptr<DbShard>> m_shards; ///< The shards.
+    };
+} /// namespace xq
+#endif /// !SHARDED_IN_MEMORY_DB_HPP
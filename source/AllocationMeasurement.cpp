@@ -0,0 +1,144 @@
+/// @file AllocationMeasurement.cpp
+///
+/// @brief Implementation of the class counting the memory allocations.
+/// @details Provides methods which start and stop counting the allocations
+/// done with operator new and return the counted allocations.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "AllocationMeasurement.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+#ifdef _MSC_VER
+#include <malloc.h>
+#endif
+
+#ifdef XQ_MEASURE_ALLOCATIONS
+namespace
+{
+	std::atomic<uint64_t> gNumberOfAllocations{ 0 }; ///< The number of allocations of the program.
+	std::atomic<uint64_t> gNumberOfAllocatedBytes{ 0 }; ///< The number of allocated bytes of the program.
+
+	/// @brief Count an allocation.
+	/// @param[in] f_size The number of allocated bytes.
+	void countAllocation(std::size_t f_size)
+	{
+		gNumberOfAllocations.fetch_add(1, std::memory_order_relaxed);
+		gNumberOfAllocatedBytes.fetch_add(f_size, std::memory_order_relaxed);
+	}
+}
+
+// Replace the global allocation functions to count the allocations. The array
+// and nothrow versions of the standard library call these ones.
+void* operator new(std::size_t f_size)
+{
+	countAllocation(f_size);
+	// malloc(0) might return a null pointer, but operator new shall return a unique pointer
+	void* memory = std::malloc(f_size == 0 ? 1 : f_size);
+	if (memory == nullptr)
+	{
+		throw std::bad_alloc{};
+	}
+	return memory;
+}
+
+void operator delete(void* f_memory) noexcept
+{
+	std::free(f_memory);
+}
+
+void operator delete(void* f_memory, std::size_t) noexcept
+{
+	std::free(f_memory);
+}
+
+// The over-aligned types are allocated by the aligned versions, which are replaced too
+void* operator new(std::size_t f_size, std::align_val_t f_alignment)
+{
+	countAllocation(f_size);
+	auto alignment = static_cast<std::size_t>(f_alignment);
+	// aligned_alloc requires the size to be a multiple of the alignment
+	auto alignedSize = (f_size + alignment - 1) / alignment * alignment;
+#ifdef _MSC_VER
+	void* memory = _aligned_malloc(alignedSize == 0 ? alignment : alignedSize, alignment);
+#else
+	void* memory = std::aligned_alloc(alignment, alignedSize == 0 ? alignment : alignedSize);
+#endif
+	if (memory == nullptr)
+	{
+		throw std::bad_alloc{};
+	}
+	return memory;
+}
+
+void operator delete(void* f_memory, std::align_val_t) noexcept
+{
+#ifdef _MSC_VER
+	_aligned_free(f_memory);
+#else
+	std::free(f_memory);
+#endif
+}
+
+void operator delete(void* f_memory, std::size_t, std::align_val_t f_alignment) noexcept
+{
+	operator delete(f_memory, f_alignment);
+}
+#endif /// XQ_MEASURE_ALLOCATIONS
+
+namespace xq
+{
+	bool AllocationMeasurement::isEnabled()
+	{
+#ifdef XQ_MEASURE_ALLOCATIONS
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	void AllocationMeasurement::startMeasurement()
+	{
+#ifdef XQ_MEASURE_ALLOCATIONS
+		m_startAllocations = gNumberOfAllocations.load(std::memory_order_relaxed);
+		m_startAllocatedBytes = gNumberOfAllocatedBytes.load(std::memory_order_relaxed);
+#endif
+	}
+
+	void AllocationMeasurement::stopMeasurement()
+	{
+#ifdef XQ_MEASURE_ALLOCATIONS
+		m_numberOfAllocations = gNumberOfAllocations.load(std::memory_order_relaxed) - m_startAllocations;
+		m_numberOfAllocatedBytes = gNumberOfAllocatedBytes.load(std::memory_order_relaxed) - m_startAllocatedBytes;
+#endif
+	}
+
+	uint64_t AllocationMeasurement::getNumberOfAllocations() const
+	{
+		return m_numberOfAllocations;
+	}
+
+	uint64_t AllocationMeasurement::getNumberOfAllocatedBytes() const
+	{
+		return m_numberOfAllocatedBytes;
+	}
+
+	void AllocationMeasurement::printAllocations(const std::string& f_operationName) const
+	{
+		if (!isEnabled())
+		{
+			std::cout << "The allocations of the operation " << f_operationName
+				<< " are not counted, build with MEASURE_ALLOCATIONS to count them\n";
+			return;
+		}
+		std::cout << "The operation " << f_operationName << " made " << m_numberOfAllocations
+			<< " allocations of " << m_numberOfAllocatedBytes << " bytes\n";
+	}
+} /// namespace xq
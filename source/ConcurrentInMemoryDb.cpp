@@ -0,0 +1,104 @@
+/// @file ConcurrentInMemoryDb.cpp
+///
+/// @brief Implementation of the in-memory database class ConcurrentInMemoryDb.
+/// @details Gives several threads concurrent access to an in-memory database,
+/// where the readers never block and never see a partly applied mutation.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "ConcurrentInMemoryDb.hpp"
+
+#include <thread>
+
+namespace xq
+{
+    ConcurrentInMemoryDb::ConcurrentInMemoryDb(const DbTestRecordCollection& f_records, DbStorageLayout f_storageLayout)
+        :
+        m_instances{ { InMemoryDb{ f_records, f_storageLayout }, InMemoryDb{ f_records, f_storageLayout } } },
+        m_readInstanceIndex{ 0 },
+        m_versionIndex{ 0 }
+    {
+    }
+
+    void ConcurrentInMemoryDb::write(const DbMutationFunction& f_mutation)
+    {
+        std::lock_guard<std::mutex> lock{ m_writeMutex };
+
+        // Change the copy, which no reader uses, and send the new readers to it
+        uint32_t readInstanceIndex = m_readInstanceIndex.load();
+        f_mutation(m_instances[1 - readInstanceIndex]);
+        m_readInstanceIndex.store(1 - readInstanceIndex);
+
+        // The readers of the old copy are registered with the current version or, if they loaded the version
+        // just before it was switched the last time, with the other one. Wait for both groups to leave.
+        uint32_t versionIndex = m_versionIndex.load();
+        waitForReaders(1 - versionIndex);
+        m_versionIndex.store(1 - versionIndex);
+        waitForReaders(versionIndex);
+
+        // No reader uses the old copy anymore
+        f_mutation(m_instances[readInstanceIndex]);
+    }
+
+    void ConcurrentInMemoryDb::addRecord(const DbTableTest& f_newRecord)
+    {
+        write([&](InMemoryDb& f_database) { f_database.addRecord(f_newRecord); });
+    }
+
+    void ConcurrentInMemoryDb::addRecords(const DbTestRecordCollection& f_newRecords)
+    {
+        write([&](InMemoryDb& f_database) { f_database.addRecords(f_newRecords); });
+    }
+
+    void ConcurrentInMemoryDb::deleteRecordByID(uint32_t f_id)
+    {
+        write([&](InMemoryDb& f_database) { f_database.deleteRecordByID(f_id); });
+    }
+
+    void ConcurrentInMemoryDb::deleteRecordsByIds(const DbRecordIdsCollection& f_ids)
+    {
+        write([&](InMemoryDb& f_database) { f_database.deleteRecordsByIds(f_ids); });
+    }
+
+    bool ConcurrentInMemoryDb::findById(uint64_t f_id, DbTableTest& f_record) const
+    {
+        return read([&](const InMemoryDb& f_database) {
+            auto foundRecord = f_database.findById(f_id);
+            if (foundRecord == nullptr)
+            {
+                return false;
+            }
+            f_record = *foundRecord;
+            return true;
+        });
+    }
+
+    void ConcurrentInMemoryDb::findMatchingRecords(const std::string& f_columnName, const std::string& f_matchString,
+        DbTestRecordCollection& f_output) const
+    {
+        read([&](const InMemoryDb& f_database) {
+            DbTestRecordPointersCollection foundRecords{};
+            f_database.findMatchingRecords(f_columnName, f_matchString, foundRecords);
+            for (auto foundRecord : foundRecords)
+            {
+                f_output.push_back(*foundRecord);
+            }
+        });
+    }
+
+    uint64_t ConcurrentInMemoryDb::getNumberOfRecords() const
+    {
+        return read([](const InMemoryDb& f_database) { return f_database.getNumberOfRecords(); });
+    }
+
+    void ConcurrentInMemoryDb::waitForReaders(uint32_t f_versionIndex) const
+    {
+        while (m_readIndicators[f_versionIndex].numberOfReaders.load() != 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+} /// namespace xq
@@ -0,0 +1,138 @@
+/// @file DbBalanceIndex.cpp
+///
+/// @brief Implementation of the ordered secondary index for the balance column.
+/// @details Keeps the balances of the records sorted, so that range searches
+/// only need to look at the records in the range.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "DbBalanceIndex.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+
+namespace xq
+{
+    // The delta buffers are merged once they have more entries than that or the square root of the size of the index
+    constexpr size_t const cMinimumDeltaBufferSize{ 1024 };
+
+    void DbBalanceIndex::build(DbBalanceIndexEntriesCollection f_entries)
+    {
+        m_entries = std::move(f_entries);
+        std::sort(m_entries.begin(), m_entries.end());
+        m_addedEntries.clear();
+        m_removedEntries.clear();
+    }
+
+    void DbBalanceIndex::addEntry(int32_t f_balance, size_t f_index)
+    {
+        DbBalanceIndexEntry entry{ f_balance, f_index };
+
+        // An entry removed after the last merge is still in the sorted array, so simply restore it
+        auto removedIter = std::lower_bound(m_removedEntries.begin(), m_removedEntries.end(), entry);
+        if (removedIter != m_removedEntries.end() && *removedIter == entry)
+        {
+            m_removedEntries.erase(removedIter);
+            return;
+        }
+
+        m_addedEntries.insert(std::upper_bound(m_addedEntries.begin(), m_addedEntries.end(), entry), entry);
+        mergeIfNeeded();
+    }
+
+    void DbBalanceIndex::removeEntry(int32_t f_balance, size_t f_index)
+    {
+        DbBalanceIndexEntry entry{ f_balance, f_index };
+
+        // An entry added after the last merge is only in the delta buffer, so simply drop it
+        auto addedIter = std::lower_bound(m_addedEntries.begin(), m_addedEntries.end(), entry);
+        if (addedIter != m_addedEntries.end() && *addedIter == entry)
+        {
+            m_addedEntries.erase(addedIter);
+            return;
+        }
+
+        m_removedEntries.insert(std::upper_bound(m_removedEntries.begin(), m_removedEntries.end(), entry), entry);
+        mergeIfNeeded();
+    }
+
+    void DbBalanceIndex::clear()
+    {
+        m_entries.clear();
+        m_addedEntries.clear();
+        m_removedEntries.clear();
+    }
+
+    void DbBalanceIndex::findRange(int32_t f_lowerBound, int32_t f_upperBound, DbRecordIndexesCollection& f_output) const
+    {
+        if (f_lowerBound > f_upperBound)
+        {
+            return;
+        }
+
+        // The range covers all the positions of the records with the bounding balances
+        DbBalanceIndexEntry lowerEntry{ f_lowerBound, 0 };
+        DbBalanceIndexEntry upperEntry{ f_upperBound, std::numeric_limits<size_t>::max() };
+        auto entriesIter = std::lower_bound(m_entries.begin(), m_entries.end(), lowerEntry);
+        auto entriesEnd = std::upper_bound(entriesIter, m_entries.end(), upperEntry);
+        auto addedIter = std::lower_bound(m_addedEntries.begin(), m_addedEntries.end(), lowerEntry);
+        auto addedEnd = std::upper_bound(addedIter, m_addedEntries.end(), upperEntry);
+        auto removedIter = std::lower_bound(m_removedEntries.begin(), m_removedEntries.end(), lowerEntry);
+
+        // Merge the sorted array and the added entries, skipping the removed ones. The removed entries
+        // are sorted the same way, so they are found while advancing through the sorted array.
+        while (entriesIter != entriesEnd || addedIter != addedEnd)
+        {
+            if (addedIter != addedEnd && (entriesIter == entriesEnd || *addedIter < *entriesIter))
+            {
+                f_output.emplace_back(addedIter->index);
+                ++addedIter;
+                continue;
+            }
+
+            while (removedIter != m_removedEntries.end() && *removedIter < *entriesIter)
+            {
+                ++removedIter;
+            }
+            if (removedIter == m_removedEntries.end() || !(*removedIter == *entriesIter))
+            {
+                f_output.emplace_back(entriesIter->index);
+            }
+            ++entriesIter;
+        }
+    }
+
+    size_t DbBalanceIndex::getNumberOfEntries() const
+    {
+        return m_entries.size() + m_addedEntries.size() - m_removedEntries.size();
+    }
+
+    void DbBalanceIndex::mergeIfNeeded()
+    {
+        auto threshold = std::max(cMinimumDeltaBufferSize, static_cast<size_t>(std::sqrt(static_cast<double>(m_entries.size()))));
+        if (m_addedEntries.size() + m_removedEntries.size() <= threshold)
+        {
+            return;
+        }
+
+        // Drop the removed entries and merge the added ones in a single pass over the sorted array
+        DbBalanceIndexEntriesCollection keptEntries{};
+        keptEntries.reserve(m_entries.size() - m_removedEntries.size());
+        std::set_difference(m_entries.begin(), m_entries.end(),
+            m_removedEntries.begin(), m_removedEntries.end(), std::back_inserter(keptEntries));
+
+        DbBalanceIndexEntriesCollection mergedEntries{};
+        mergedEntries.reserve(keptEntries.size() + m_addedEntries.size());
+        std::merge(keptEntries.begin(), keptEntries.end(),
+            m_addedEntries.begin(), m_addedEntries.end(), std::back_inserter(mergedEntries));
+
+        m_entries.swap(mergedEntries);
+        m_addedEntries.clear();
+        m_removedEntries.clear();
+    }
+} /// namespace xq
@@ -0,0 +1,134 @@
+/// @file DbMappedFile.cpp
+///
+/// @brief Implementation of the read-only memory mapping of a file.
+/// @details Maps the whole content of a file into the address space of the process,
+/// so that it can be read in place without copying it into buffers.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "DbMappedFile.hpp"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace xq
+{
+    DbMappedFile::~DbMappedFile()
+    {
+        close();
+    }
+
+#if defined(_WIN32)
+    bool DbMappedFile::open(const std::string& f_path)
+    {
+        close();
+        HANDLE fileHandle = CreateFileA(f_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0)
+        {
+            CloseHandle(fileHandle);
+            return false;
+        }
+
+        HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mappingHandle == nullptr)
+        {
+            CloseHandle(fileHandle);
+            return false;
+        }
+
+        void* data = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+        if (data == nullptr)
+        {
+            CloseHandle(mappingHandle);
+            CloseHandle(fileHandle);
+            return false;
+        }
+
+        m_fileHandle = fileHandle;
+        m_mappingHandle = mappingHandle;
+        m_data = static_cast<const unsigned char*>(data);
+        m_size = static_cast<size_t>(fileSize.QuadPart);
+        return true;
+    }
+
+    void DbMappedFile::close()
+    {
+        if (m_data != nullptr)
+        {
+            UnmapViewOfFile(m_data);
+            CloseHandle(m_mappingHandle);
+            CloseHandle(m_fileHandle);
+        }
+        m_data = nullptr;
+        m_size = 0;
+        m_fileHandle = nullptr;
+        m_mappingHandle = nullptr;
+    }
+#else
+    bool DbMappedFile::open(const std::string& f_path)
+    {
+        close();
+        int fileDescriptor = ::open(f_path.c_str(), O_RDONLY);
+        if (fileDescriptor < 0)
+        {
+            return false;
+        }
+
+        struct stat fileStatus{};
+        if (fstat(fileDescriptor, &fileStatus) != 0 || fileStatus.st_size <= 0)
+        {
+            ::close(fileDescriptor);
+            return false;
+        }
+
+        // The mapping stays valid after the file is closed
+        auto size = static_cast<size_t>(fileStatus.st_size);
+        void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        ::close(fileDescriptor);
+        if (data == MAP_FAILED)
+        {
+            return false;
+        }
+
+        m_data = static_cast<const unsigned char*>(data);
+        m_size = size;
+        return true;
+    }
+
+    void DbMappedFile::close()
+    {
+        if (m_data != nullptr)
+        {
+            munmap(const_cast<unsigned char*>(m_data), m_size);
+        }
+        m_data = nullptr;
+        m_size = 0;
+    }
+#endif
+
+    const unsigned char* DbMappedFile::getData() const
+    {
+        return m_data;
+    }
+
+    size_t DbMappedFile::getSize() const
+    {
+        return m_size;
+    }
+} /// namespace xq
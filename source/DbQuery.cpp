@@ -0,0 +1,26 @@
+/// @file DbQuery.cpp
+///
+/// @brief Implementation of the query combining several search predicates.
+/// @details A query holds several column predicates, which all have to match
+/// for a record to be found.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "DbQuery.hpp"
+
+namespace xq
+{
+    DbQuery& DbQuery::addPredicate(const std::string& f_columnName, const std::string& f_matchString)
+    {
+        m_predicates.push_back({ f_columnName, f_matchString });
+        return *this;
+    }
+
+    const DbQueryPredicatesCollection& DbQuery::getPredicates() const
+    {
+        return m_predicates;
+    }
+} /// namespace xq
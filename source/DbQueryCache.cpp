@@ -0,0 +1,109 @@
+/// @file DbQueryCache.cpp
+///
+/// @brief Implementation of the cache of the search results.
+/// @details Keeps the positions of the records found by recent searches, so that a repeated
+/// search between two modifications of the records doesn't scan the records again.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "DbQueryCache.hpp"
+
+#include <iterator>
+
+namespace xq
+{
+    DbQueryCache::DbQueryCache(size_t f_maximumSize)
+        :
+        m_maximumSize{ f_maximumSize }
+    {
+    }
+
+    bool DbQueryCache::findResult(const std::string& f_key, uint64_t f_version, DbCachedResult& f_result)
+    {
+        std::lock_guard<std::mutex> lock{ m_mutex };
+        dropOutdatedEntries(f_version);
+        auto lookupIter = m_lookup.find(f_key);
+        if (f_version != m_version || lookupIter == m_lookup.end())
+        {
+            ++m_numberOfMisses;
+            return false;
+        }
+
+        // Move the entry to the front without copying it
+        m_entries.splice(m_entries.begin(), m_entries, lookupIter->second);
+        f_result = lookupIter->second->result;
+        ++m_numberOfHits;
+        return true;
+    }
+
+    void DbQueryCache::storeResult(const std::string& f_key, uint64_t f_version, DbCachedResult f_result)
+    {
+        size_t entrySize = getEntrySize(f_result);
+        std::lock_guard<std::mutex> lock{ m_mutex };
+        dropOutdatedEntries(f_version);
+        if (f_version != m_version || entrySize > m_maximumSize)
+        {
+            return;
+        }
+
+        // Another search might have stored the same result meanwhile
+        auto lookupIter = m_lookup.find(f_key);
+        if (lookupIter != m_lookup.end())
+        {
+            dropEntry(lookupIter->second);
+        }
+        while (m_size + entrySize > m_maximumSize)
+        {
+            dropEntry(std::prev(m_entries.end()));
+        }
+
+        m_entries.push_front(DbCacheEntry{ f_key, std::move(f_result) });
+        m_lookup.emplace(m_entries.front().key, m_entries.begin());
+        m_size += entrySize;
+    }
+
+    uint64_t DbQueryCache::getNumberOfHits() const
+    {
+        std::lock_guard<std::mutex> lock{ m_mutex };
+        return m_numberOfHits;
+    }
+
+    uint64_t DbQueryCache::getNumberOfMisses() const
+    {
+        std::lock_guard<std::mutex> lock{ m_mutex };
+        return m_numberOfMisses;
+    }
+
+    size_t DbQueryCache::getNumberOfEntries() const
+    {
+        std::lock_guard<std::mutex> lock{ m_mutex };
+        return m_entries.size();
+    }
+
+    void DbQueryCache::dropOutdatedEntries(uint64_t f_version)
+    {
+        // A result of an older version, stored by a search which was slower than a modification, is ignored
+        if (f_version > m_version)
+        {
+            m_lookup.clear();
+            m_entries.clear();
+            m_size = 0;
+            m_version = f_version;
+        }
+    }
+
+    void DbQueryCache::dropEntry(DbCacheEntriesCollection::iterator f_entry)
+    {
+        m_size -= getEntrySize(f_entry->result);
+        m_lookup.erase(f_entry->key);
+        m_entries.erase(f_entry);
+    }
+
+    size_t DbQueryCache::getEntrySize(const DbCachedResult& f_result)
+    {
+        return f_result->size() + 1;
+    }
+} /// namespace xq
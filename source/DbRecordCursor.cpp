@@ -0,0 +1,77 @@
+/// @file DbRecordCursor.cpp
+///
+/// @brief Implementation of the cursor over the records found by a query.
+/// @details Finds the matching records while the caller pulls them, instead of
+/// searching all the records before the caller sees the first one.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "DbRecordCursor.hpp"
+
+#include <algorithm>
+
+namespace xq
+{
+    DbRecordCursor::DbRecordCursor(const DbTestRecordCollection& f_records, DbTableTestMatchersCollection&& f_matchers,
+        DbRecordIndexesCollection&& f_candidateIndexes, bool f_hasCandidates, size_t f_limit)
+        :
+        m_records{ &f_records },
+        m_matchers{ std::move(f_matchers) },
+        m_candidateIndexes{ std::move(f_candidateIndexes) },
+        m_hasCandidates{ f_hasCandidates },
+        m_remainingLimit{ f_limit }
+    {
+    }
+
+    const DbTableTest* DbRecordCursor::next()
+    {
+        size_t index{ 0 };
+        return findNext(index) ? &(*m_records)[index] : nullptr;
+    }
+
+    size_t DbRecordCursor::fetch(DbTestRecordPointersCollection& f_batch, size_t f_maximumBatchSize)
+    {
+        f_batch.clear();
+        size_t index{ 0 };
+        while (f_batch.size() < f_maximumBatchSize && findNext(index))
+        {
+            f_batch.emplace_back(&(*m_records)[index]);
+        }
+        return f_batch.size();
+    }
+
+    bool DbRecordCursor::isExhausted() const
+    {
+        return m_remainingLimit == 0 || m_position >= (m_hasCandidates ? m_candidateIndexes.size() : m_records->size());
+    }
+
+    bool DbRecordCursor::findNext(size_t& f_index)
+    {
+        if (m_remainingLimit == 0)
+        {
+            return false;
+        }
+
+        size_t end = m_hasCandidates ? m_candidateIndexes.size() : m_records->size();
+        while (m_position < end)
+        {
+            size_t index = m_hasCandidates ? m_candidateIndexes[m_position] : m_position;
+            ++m_position;
+
+            // Deleted records have ID 0 and are never returned
+            const auto& rec = (*m_records)[index];
+            if (rec.id != 0 && std::all_of(m_matchers.begin(), m_matchers.end(), [&](const DbTableTestStringMatcher& f_matcher) {
+                return f_matcher.checkMatching(rec);
+            }))
+            {
+                --m_remainingLimit;
+                f_index = index;
+                return true;
+            }
+        }
+        return false;
+    }
+} /// namespace xq
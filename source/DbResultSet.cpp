@@ -0,0 +1,175 @@
+/// @file DbResultSet.cpp
+///
+/// @brief Implementation of the result set of the searches.
+/// @details Stores the positions of the found records in a bitmap with one bit
+/// per record, so that the results of several searches can be combined cheaply.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "DbResultSet.hpp"
+
+#include <algorithm>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace xq
+{
+    // The number of records stored in each word of the bitmap
+    constexpr size_t const cBitsPerWord{ 64 };
+
+    namespace
+    {
+        /// @brief Get the number of set bits in a word.
+        /// @param[in] f_word The word.
+        /// @returns The number of set bits.
+        size_t countSetBits(uint64_t f_word)
+        {
+#if defined(_MSC_VER)
+            return static_cast<size_t>(__popcnt64(f_word));
+#else
+            return static_cast<size_t>(__builtin_popcountll(f_word));
+#endif
+        }
+
+        /// @brief Get the position of the lowest set bit in a word.
+        /// @param[in] f_word The word. Shall not be zero.
+        /// @returns The position of the lowest set bit.
+        size_t findLowestSetBit(uint64_t f_word)
+        {
+#if defined(_MSC_VER)
+            unsigned long position{ 0 };
+            _BitScanForward64(&position, f_word);
+            return static_cast<size_t>(position);
+#else
+            return static_cast<size_t>(__builtin_ctzll(f_word));
+#endif
+        }
+    }
+
+    DbResultSet::ConstIterator::ConstIterator(const DbResultSetWordsCollection* f_words, size_t f_wordIndex)
+        :
+        m_words{ f_words },
+        m_wordIndex{ f_wordIndex },
+        m_remainingBits{ f_wordIndex < f_words->size() ? (*f_words)[f_wordIndex] : 0 }
+    {
+        skipEmptyWords();
+    }
+
+    size_t DbResultSet::ConstIterator::operator*() const
+    {
+        return m_wordIndex * cBitsPerWord + findLowestSetBit(m_remainingBits);
+    }
+
+    DbResultSet::ConstIterator& DbResultSet::ConstIterator::operator++()
+    {
+        // Clear the lowest set bit, which was just iterated
+        m_remainingBits &= m_remainingBits - 1;
+        skipEmptyWords();
+        return *this;
+    }
+
+    bool DbResultSet::ConstIterator::operator==(const ConstIterator& f_other) const
+    {
+        return m_wordIndex == f_other.m_wordIndex && m_remainingBits == f_other.m_remainingBits;
+    }
+
+    bool DbResultSet::ConstIterator::operator!=(const ConstIterator& f_other) const
+    {
+        return !(*this == f_other);
+    }
+
+    void DbResultSet::ConstIterator::skipEmptyWords()
+    {
+        while (m_remainingBits == 0 && m_wordIndex < m_words->size())
+        {
+            ++m_wordIndex;
+            m_remainingBits = m_wordIndex < m_words->size() ? (*m_words)[m_wordIndex] : 0;
+        }
+    }
+
+    DbResultSet::DbResultSet(size_t f_numberOfRecords)
+    {
+        reset(f_numberOfRecords);
+    }
+
+    void DbResultSet::reset(size_t f_numberOfRecords)
+    {
+        m_numberOfRecords = f_numberOfRecords;
+        m_words.assign((f_numberOfRecords + cBitsPerWord - 1) / cBitsPerWord, 0);
+    }
+
+    void DbResultSet::addRecord(size_t f_index)
+    {
+        m_words[f_index / cBitsPerWord] |= uint64_t{ 1 } << (f_index % cBitsPerWord);
+    }
+
+    bool DbResultSet::containsRecord(size_t f_index) const
+    {
+        if (f_index >= m_numberOfRecords)
+        {
+            return false;
+        }
+        return (m_words[f_index / cBitsPerWord] >> (f_index % cBitsPerWord) & 1) != 0;
+    }
+
+    size_t DbResultSet::count() const
+    {
+        size_t numberOfFoundRecords{ 0 };
+        for (auto word : m_words)
+        {
+            numberOfFoundRecords += countSetBits(word);
+        }
+        return numberOfFoundRecords;
+    }
+
+    bool DbResultSet::empty() const
+    {
+        return std::all_of(m_words.begin(), m_words.end(), [](uint64_t f_word) {
+            return f_word == 0;
+        });
+    }
+
+    void DbResultSet::intersectWith(const DbResultSet& f_other)
+    {
+        // The records after the end of the other bitmap were not found by it
+        size_t commonWords = std::min(m_words.size(), f_other.m_words.size());
+        for (size_t i = 0; i < commonWords; ++i)
+        {
+            m_words[i] &= f_other.m_words[i];
+        }
+        std::fill(m_words.begin() + static_cast<std::ptrdiff_t>(commonWords), m_words.end(), 0);
+    }
+
+    void DbResultSet::uniteWith(const DbResultSet& f_other)
+    {
+        if (f_other.m_numberOfRecords > m_numberOfRecords)
+        {
+            m_numberOfRecords = f_other.m_numberOfRecords;
+            m_words.resize(f_other.m_words.size(), 0);
+        }
+        for (size_t i = 0; i < f_other.m_words.size(); ++i)
+        {
+            m_words[i] |= f_other.m_words[i];
+        }
+    }
+
+    size_t DbResultSet::getNumberOfRecords() const
+    {
+        return m_numberOfRecords;
+    }
+
+    DbResultSet::ConstIterator DbResultSet::begin() const
+    {
+        return ConstIterator{ &m_words, 0 };
+    }
+
+    DbResultSet::ConstIterator DbResultSet::end() const
+    {
+        return ConstIterator{ &m_words, m_words.size() };
+    }
+} /// namespace xq
@@ -0,0 +1,382 @@
+/// @file DbScanKernels.cpp
+///
+/// @brief Implementation of the vectorized scan kernels for the integer columns.
+/// @details Provides equality scans and aggregations over contiguous integer columns, which process
+/// several values per instruction using AVX2 or SSE4.2 when the processor supports them.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "DbScanKernels.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define XQ_SCAN_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// MSVC allows the use of the intrinsics in any function, while GCC and Clang
+// require the function to be marked with the instruction set it uses
+#if defined(_MSC_VER) && !defined(__clang__)
+#define XQ_TARGET_AVX2
+#define XQ_TARGET_SSE42
+#else
+#define XQ_TARGET_AVX2 __attribute__((target("avx2")))
+#define XQ_TARGET_SSE42 __attribute__((target("sse4.2")))
+#endif
+
+namespace xq
+{
+    namespace
+    {
+        /// @brief Get the position of the lowest set bit.
+        /// @param[in] f_mask The mask to check. Shall not be 0.
+        /// @returns The position of the lowest set bit.
+        inline uint32_t countTrailingZeros(uint32_t f_mask)
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            unsigned long position{};
+            _BitScanForward(&position, f_mask);
+            return static_cast<uint32_t>(position);
+#else
+            return static_cast<uint32_t>(__builtin_ctz(f_mask));
+#endif
+        }
+
+        /// @brief Store the positions of all the set bits of a match bitmask.
+        /// @param[in] f_mask The match bitmask, where bit N represents the value at f_firstIndex + N.
+        /// @param[in] f_firstIndex The position of the value represented by the lowest bit.
+        /// @param[out] f_output Contains the positions of the matching values.
+        inline void compactMatchMask(uint32_t f_mask, size_t f_firstIndex, DbRecordIndexesCollection& f_output)
+        {
+            while (f_mask != 0)
+            {
+                f_output.emplace_back(f_firstIndex + countTrailingZeros(f_mask));
+                f_mask &= f_mask - 1;
+            }
+        }
+
+        /// @brief Compare the values one at a time.
+        /// @details Used by the scalar kernel and for the last values, which do not fill a whole block.
+        template <typename TValue>
+        void findEqualScalar(const TValue* f_values, size_t f_firstIndex, size_t f_numberOfValues,
+            TValue f_matchValue, DbRecordIndexesCollection& f_output)
+        {
+            for (size_t index = f_firstIndex; index < f_numberOfValues; ++index)
+            {
+                if (f_values[index] == f_matchValue)
+                {
+                    f_output.emplace_back(index);
+                }
+            }
+        }
+
+        /// @brief Aggregate the values one at a time.
+        /// @details Used by the scalar kernel and for the last values, which do not fill a whole block.
+        void aggregateScalar(const int32_t* f_values, const uint64_t* f_ids, size_t f_firstIndex, size_t f_numberOfValues,
+            DbAggregate& f_aggregate)
+        {
+            for (size_t index = f_firstIndex; index < f_numberOfValues; ++index)
+            {
+                if (f_ids[index] != 0)
+                {
+                    f_aggregate.addValue(f_values[index]);
+                }
+            }
+        }
+
+        /// @brief Combine the partial aggregates of the lanes of a vectorized kernel.
+        /// @param[in] f_sums The sum per lane.
+        /// @param[in] f_deletedCounts The number of deleted records per lane.
+        /// @param[in] f_minimums The minimum per lane.
+        /// @param[in] f_maximums The maximum per lane.
+        /// @param[in] f_numberOfLanes The number of lanes.
+        /// @param[in] f_numberOfValues The number of values processed by all the lanes.
+        /// @param[in,out] f_aggregate The aggregate, to which the lanes are added.
+        void mergeLanes(const int64_t* f_sums, const int64_t* f_deletedCounts, const int64_t* f_minimums,
+            const int64_t* f_maximums, size_t f_numberOfLanes, size_t f_numberOfValues, DbAggregate& f_aggregate)
+        {
+            DbAggregate lanesAggregate{};
+            lanesAggregate.count = f_numberOfValues;
+            for (size_t lane = 0; lane < f_numberOfLanes; ++lane)
+            {
+                lanesAggregate.count -= static_cast<uint64_t>(f_deletedCounts[lane]);
+                lanesAggregate.sum += f_sums[lane];
+                lanesAggregate.minimum = std::min(lanesAggregate.minimum, f_minimums[lane]);
+                lanesAggregate.maximum = std::max(lanesAggregate.maximum, f_maximums[lane]);
+            }
+            f_aggregate.merge(lanesAggregate);
+        }
+
+#ifdef XQ_SCAN_KERNELS_X86
+        XQ_TARGET_AVX2 void findEqualAvx2(const int32_t* f_values, size_t f_numberOfValues,
+            int32_t f_matchValue, DbRecordIndexesCollection& f_output)
+        {
+            const __m256i matchVector = _mm256_set1_epi32(f_matchValue);
+            size_t index = 0;
+            // Compare 16 values per iteration and build one 16-bit mask out of them
+            for (; index + 16 <= f_numberOfValues; index += 16)
+            {
+                __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(f_values + index));
+                __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(f_values + index + 8));
+                auto lowMask = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(low, matchVector))));
+                auto highMask = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(high, matchVector))));
+                compactMatchMask(lowMask | (highMask << 8), index, f_output);
+            }
+            findEqualScalar(f_values, index, f_numberOfValues, f_matchValue, f_output);
+        }
+
+        XQ_TARGET_AVX2 void findEqualAvx2(const uint64_t* f_values, size_t f_numberOfValues,
+            uint64_t f_matchValue, DbRecordIndexesCollection& f_output)
+        {
+            const __m256i matchVector = _mm256_set1_epi64x(static_cast<int64_t>(f_matchValue));
+            size_t index = 0;
+            // Compare 16 values per iteration and build one 16-bit mask out of them
+            for (; index + 16 <= f_numberOfValues; index += 16)
+            {
+                uint32_t mask = 0;
+                for (size_t block = 0; block < 4; ++block)
+                {
+                    __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(f_values + index + block * 4));
+                    auto blockMask = static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(values, matchVector))));
+                    mask |= blockMask << (block * 4);
+                }
+                compactMatchMask(mask, index, f_output);
+            }
+            findEqualScalar(f_values, index, f_numberOfValues, f_matchValue, f_output);
+        }
+
+        XQ_TARGET_SSE42 void findEqualSse42(const int32_t* f_values, size_t f_numberOfValues,
+            int32_t f_matchValue, DbRecordIndexesCollection& f_output)
+        {
+            const __m128i matchVector = _mm_set1_epi32(f_matchValue);
+            size_t index = 0;
+            // Compare 16 values per iteration and build one 16-bit mask out of them
+            for (; index + 16 <= f_numberOfValues; index += 16)
+            {
+                uint32_t mask = 0;
+                for (size_t block = 0; block < 4; ++block)
+                {
+                    __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f_values + index + block * 4));
+                    auto blockMask = static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(values, matchVector))));
+                    mask |= blockMask << (block * 4);
+                }
+                compactMatchMask(mask, index, f_output);
+            }
+            findEqualScalar(f_values, index, f_numberOfValues, f_matchValue, f_output);
+        }
+
+        XQ_TARGET_SSE42 void findEqualSse42(const uint64_t* f_values, size_t f_numberOfValues,
+            uint64_t f_matchValue, DbRecordIndexesCollection& f_output)
+        {
+            const __m128i matchVector = _mm_set1_epi64x(static_cast<int64_t>(f_matchValue));
+            size_t index = 0;
+            // Compare 16 values per iteration and build one 16-bit mask out of them
+            for (; index + 16 <= f_numberOfValues; index += 16)
+            {
+                uint32_t mask = 0;
+                for (size_t block = 0; block < 8; ++block)
+                {
+                    __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f_values + index + block * 2));
+                    auto blockMask = static_cast<uint32_t>(_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(values, matchVector))));
+                    mask |= blockMask << (block * 2);
+                }
+                compactMatchMask(mask, index, f_output);
+            }
+            findEqualScalar(f_values, index, f_numberOfValues, f_matchValue, f_output);
+        }
+
+        XQ_TARGET_AVX2 void aggregateAvx2(const int32_t* f_values, const uint64_t* f_ids, size_t f_numberOfValues,
+            DbAggregate& f_aggregate)
+        {
+            const __m256i zeroVector = _mm256_setzero_si256();
+            const __m256i largestVector = _mm256_set1_epi64x(std::numeric_limits<int64_t>::max());
+            const __m256i smallestVector = _mm256_set1_epi64x(std::numeric_limits<int64_t>::min());
+            __m256i sums = zeroVector;
+            __m256i deletedCounts = zeroVector;
+            __m256i minimums = largestVector;
+            __m256i maximums = smallestVector;
+            size_t index = 0;
+            // Widen 4 values per iteration to 64 bits, so that the sums cannot overflow
+            for (; index + 4 <= f_numberOfValues; index += 4)
+            {
+                __m256i values = _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(f_values + index)));
+                __m256i isDeleted = _mm256_cmpeq_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(f_ids + index)), zeroVector);
+                sums = _mm256_add_epi64(sums, _mm256_andnot_si256(isDeleted, values));
+                // The mask of a deleted record is -1
+                deletedCounts = _mm256_sub_epi64(deletedCounts, isDeleted);
+                __m256i minimumCandidates = _mm256_blendv_epi8(values, largestVector, isDeleted);
+                minimums = _mm256_blendv_epi8(minimums, minimumCandidates, _mm256_cmpgt_epi64(minimums, minimumCandidates));
+                __m256i maximumCandidates = _mm256_blendv_epi8(values, smallestVector, isDeleted);
+                maximums = _mm256_blendv_epi8(maximums, maximumCandidates, _mm256_cmpgt_epi64(maximumCandidates, maximums));
+            }
+
+            alignas(32) int64_t laneSums[4];
+            alignas(32) int64_t laneDeletedCounts[4];
+            alignas(32) int64_t laneMinimums[4];
+            alignas(32) int64_t laneMaximums[4];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(laneSums), sums);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(laneDeletedCounts), deletedCounts);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(laneMinimums), minimums);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(laneMaximums), maximums);
+            mergeLanes(laneSums, laneDeletedCounts, laneMinimums, laneMaximums, 4, index, f_aggregate);
+            aggregateScalar(f_values, f_ids, index, f_numberOfValues, f_aggregate);
+        }
+
+        XQ_TARGET_SSE42 void aggregateSse42(const int32_t* f_values, const uint64_t* f_ids, size_t f_numberOfValues,
+            DbAggregate& f_aggregate)
+        {
+            const __m128i zeroVector = _mm_setzero_si128();
+            const __m128i largestVector = _mm_set1_epi64x(std::numeric_limits<int64_t>::max());
+            const __m128i smallestVector = _mm_set1_epi64x(std::numeric_limits<int64_t>::min());
+            __m128i sums = zeroVector;
+            __m128i deletedCounts = zeroVector;
+            __m128i minimums = largestVector;
+            __m128i maximums = smallestVector;
+            size_t index = 0;
+            // Widen 2 values per iteration to 64 bits, so that the sums cannot overflow
+            for (; index + 2 <= f_numberOfValues; index += 2)
+            {
+                __m128i values = _mm_cvtepi32_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(f_values + index)));
+                __m128i isDeleted = _mm_cmpeq_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(f_ids + index)), zeroVector);
+                sums = _mm_add_epi64(sums, _mm_andnot_si128(isDeleted, values));
+                // The mask of a deleted record is -1
+                deletedCounts = _mm_sub_epi64(deletedCounts, isDeleted);
+                __m128i minimumCandidates = _mm_blendv_epi8(values, largestVector, isDeleted);
+                minimums = _mm_blendv_epi8(minimums, minimumCandidates, _mm_cmpgt_epi64(minimums, minimumCandidates));
+                __m128i maximumCandidates = _mm_blendv_epi8(values, smallestVector, isDeleted);
+                maximums = _mm_blendv_epi8(maximums, maximumCandidates, _mm_cmpgt_epi64(maximumCandidates, maximums));
+            }
+
+            alignas(16) int64_t laneSums[2];
+            alignas(16) int64_t laneDeletedCounts[2];
+            alignas(16) int64_t laneMinimums[2];
+            alignas(16) int64_t laneMaximums[2];
+            _mm_store_si128(reinterpret_cast<__m128i*>(laneSums), sums);
+            _mm_store_si128(reinterpret_cast<__m128i*>(laneDeletedCounts), deletedCounts);
+            _mm_store_si128(reinterpret_cast<__m128i*>(laneMinimums), minimums);
+            _mm_store_si128(reinterpret_cast<__m128i*>(laneMaximums), maximums);
+            mergeLanes(laneSums, laneDeletedCounts, laneMinimums, laneMaximums, 2, index, f_aggregate);
+            aggregateScalar(f_values, f_ids, index, f_numberOfValues, f_aggregate);
+        }
+#endif
+
+        /// @brief Select the implementation and execute the scan.
+        template <typename TValue>
+        void findEqualWithKernel(DbScanKernelType f_kernelType, const TValue* f_values, size_t f_numberOfValues,
+            TValue f_matchValue, DbRecordIndexesCollection& f_output)
+        {
+            switch (f_kernelType)
+            {
+#ifdef XQ_SCAN_KERNELS_X86
+            case DbScanKernelType::Avx2:
+                findEqualAvx2(f_values, f_numberOfValues, f_matchValue, f_output);
+                break;
+            case DbScanKernelType::Sse42:
+                findEqualSse42(f_values, f_numberOfValues, f_matchValue, f_output);
+                break;
+#endif
+            default:
+                findEqualScalar(f_values, 0, f_numberOfValues, f_matchValue, f_output);
+                break;
+            }
+        }
+    }
+
+    DbScanKernels::DbScanKernels()
+        :
+        m_kernelType{ DbScanKernelType::Scalar }
+    {
+        // Select the fastest implementation supported by the processor
+        if (isKernelSupported(DbScanKernelType::Avx2))
+        {
+            m_kernelType = DbScanKernelType::Avx2;
+        }
+        else if (isKernelSupported(DbScanKernelType::Sse42))
+        {
+            m_kernelType = DbScanKernelType::Sse42;
+        }
+    }
+
+    DbScanKernels::DbScanKernels(DbScanKernelType f_kernelType)
+        :
+        DbScanKernels()
+    {
+        if (isKernelSupported(f_kernelType))
+        {
+            m_kernelType = f_kernelType;
+        }
+    }
+
+    void DbScanKernels::findEqual(const uint64_t* f_values, size_t f_numberOfValues, uint64_t f_matchValue,
+        DbRecordIndexesCollection& f_output) const
+    {
+        findEqualWithKernel(m_kernelType, f_values, f_numberOfValues, f_matchValue, f_output);
+    }
+
+    void DbScanKernels::findEqual(const int32_t* f_values, size_t f_numberOfValues, int32_t f_matchValue,
+        DbRecordIndexesCollection& f_output) const
+    {
+        findEqualWithKernel(m_kernelType, f_values, f_numberOfValues, f_matchValue, f_output);
+    }
+
+    void DbScanKernels::aggregate(const int32_t* f_values, const uint64_t* f_ids, size_t f_numberOfValues,
+        DbAggregate& f_aggregate) const
+    {
+        switch (m_kernelType)
+        {
+#ifdef XQ_SCAN_KERNELS_X86
+        case DbScanKernelType::Avx2:
+            aggregateAvx2(f_values, f_ids, f_numberOfValues, f_aggregate);
+            break;
+        case DbScanKernelType::Sse42:
+            aggregateSse42(f_values, f_ids, f_numberOfValues, f_aggregate);
+            break;
+#endif
+        default:
+            aggregateScalar(f_values, f_ids, 0, f_numberOfValues, f_aggregate);
+            break;
+        }
+    }
+
+    DbScanKernelType DbScanKernels::getKernelType() const
+    {
+        return m_kernelType;
+    }
+
+    bool DbScanKernels::isKernelSupported(DbScanKernelType f_kernelType)
+    {
+        if (f_kernelType == DbScanKernelType::Scalar)
+        {
+            return true;
+        }
+#if defined(XQ_SCAN_KERNELS_X86) && defined(_MSC_VER) && !defined(__clang__)
+        int cpuInfo[4]{};
+        __cpuid(cpuInfo, 1);
+        bool isSse42Supported = (cpuInfo[2] & (1 << 20)) != 0;
+        // AVX2 also requires the operating system to save the 256-bit registers
+        bool isAvxEnabled = (cpuInfo[2] & (1 << 27)) != 0 && (cpuInfo[2] & (1 << 28)) != 0 &&
+            (_xgetbv(0) & 0x6) == 0x6;
+        __cpuidex(cpuInfo, 7, 0);
+        bool isAvx2Supported = isAvxEnabled && (cpuInfo[1] & (1 << 5)) != 0;
+        return f_kernelType == DbScanKernelType::Avx2 ? isAvx2Supported : isSse42Supported;
+#elif defined(XQ_SCAN_KERNELS_X86)
+        __builtin_cpu_init();
+        if (f_kernelType == DbScanKernelType::Avx2)
+        {
+            return __builtin_cpu_supports("avx2");
+        }
+        return __builtin_cpu_supports("sse4.2");
+#else
+        return false;
+#endif
+    }
+} /// namespace xq
@@ -0,0 +1,288 @@
+/// @file DbSnapshot.cpp
+///
+/// @brief Implementation of the binary snapshot of the test table.
+/// @details Writes the records into a column-oriented file and reads the columns
+/// of such a file in place from a memory mapping.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "DbSnapshot.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+#include <vector>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace xq
+{
+    // The first bytes of every snapshot file
+    constexpr char const cSnapshotMagic[8]{ 'X', 'Q', 'D', 'B', 'S', 'N', 'A', 'P' };
+    // The version of the file format
+    constexpr uint32_t const cSnapshotVersion{ 1 };
+    // The alignment of every array in the file
+    constexpr size_t const cSnapshotAlignment{ 8 };
+
+    namespace
+    {
+        /// @struct DbSnapshotHeader
+        /// @brief Header at the beginning of the snapshot file.
+        struct DbSnapshotHeader
+        {
+            char magic[8]; ///< Always cSnapshotMagic.
+            uint32_t version; ///< The version of the file format.
+            uint32_t reserved; ///< Unused, always zero.
+            uint64_t numberOfRecords; ///< The number of records.
+            uint64_t numberOfNameBytes; ///< The total length of the names.
+            uint64_t numberOfAddressBytes; ///< The total length of the addresses.
+        };
+
+        /// @brief Round a size up to the alignment of the arrays.
+        /// @param[in] f_size The size.
+        /// @returns The aligned size.
+        uint64_t alignSize(uint64_t f_size)
+        {
+            return (f_size + cSnapshotAlignment - 1) / cSnapshotAlignment * cSnapshotAlignment;
+        }
+
+        /// @brief Write an array into the file and pad it up to the alignment.
+        /// @param[in,out] f_file The file.
+        /// @param[in] f_data The first byte of the array.
+        /// @param[in] f_size The number of bytes of the array.
+        /// @returns True if the array was written, false elsewhen.
+        bool writeArray(std::FILE* f_file, const void* f_data, uint64_t f_size)
+        {
+            const char padding[cSnapshotAlignment]{};
+            size_t paddingSize = static_cast<size_t>(alignSize(f_size) - f_size);
+            return (f_size == 0 || std::fwrite(f_data, 1, static_cast<size_t>(f_size), f_file) == f_size) &&
+                (paddingSize == 0 || std::fwrite(padding, 1, paddingSize, f_file) == paddingSize);
+        }
+
+        /// @brief Write the buffered data of a file and force it to the storage device.
+        /// @param[in] f_file The file.
+        /// @returns True if the data reached the storage device, false elsewhen.
+        bool syncFile(std::FILE* f_file)
+        {
+            if (std::fflush(f_file) != 0)
+            {
+                return false;
+            }
+#if defined(_WIN32)
+            return _commit(_fileno(f_file)) == 0;
+#else
+            return fsync(fileno(f_file)) == 0;
+#endif
+        }
+
+        /// @brief Force the entries of a directory, like a renamed file, to the storage device.
+        /// @param[in] f_path The path of the directory.
+        /// @returns True if the directory was synced, false elsewhen.
+        bool syncDirectory(const std::filesystem::path& f_path)
+        {
+#if defined(_WIN32)
+            // The directories cannot be opened for syncing, NTFS journals the renames itself
+            (void)f_path;
+            return true;
+#else
+            int directory = ::open(f_path.empty() ? "." : f_path.c_str(), O_RDONLY);
+            if (directory < 0)
+            {
+                return false;
+            }
+            bool isSynced = fsync(directory) == 0;
+            ::close(directory);
+            return isSynced;
+#endif
+        }
+    }
+
+    bool DbSnapshot::write(const std::string& f_path, const DbTestRecordCollection& f_records)
+    {
+        // Collect the columns of the records, which are not deleted
+        std::vector<uint64_t> ids{};
+        std::vector<int32_t> balances{};
+        std::vector<uint64_t> nameOffsets{ 0 };
+        std::vector<uint64_t> addressOffsets{ 0 };
+        std::string names{};
+        std::string addresses{};
+        ids.reserve(f_records.size());
+        balances.reserve(f_records.size());
+        nameOffsets.reserve(f_records.size() + 1);
+        addressOffsets.reserve(f_records.size() + 1);
+        for (const auto& rec : f_records)
+        {
+            if (rec.id == 0)
+            {
+                continue;
+            }
+            ids.emplace_back(rec.id);
+            balances.emplace_back(rec.balance);
+            names += rec.name;
+            addresses += rec.address;
+            nameOffsets.emplace_back(names.size());
+            addressOffsets.emplace_back(addresses.size());
+        }
+
+        std::FILE* file = std::fopen(f_path.c_str(), "wb");
+        if (file == nullptr)
+        {
+            return false;
+        }
+
+        DbSnapshotHeader header{};
+        std::memcpy(header.magic, cSnapshotMagic, sizeof(header.magic));
+        header.version = cSnapshotVersion;
+        header.numberOfRecords = ids.size();
+        header.numberOfNameBytes = names.size();
+        header.numberOfAddressBytes = addresses.size();
+        bool isWritten = writeArray(file, &header, sizeof(header)) &&
+            writeArray(file, ids.data(), ids.size() * sizeof(uint64_t)) &&
+            writeArray(file, balances.data(), balances.size() * sizeof(int32_t)) &&
+            writeArray(file, nameOffsets.data(), nameOffsets.size() * sizeof(uint64_t)) &&
+            writeArray(file, addressOffsets.data(), addressOffsets.size() * sizeof(uint64_t)) &&
+            writeArray(file, names.data(), names.size()) &&
+            writeArray(file, addresses.data(), addresses.size());
+
+        // The snapshot replaces the log entries, so it has to reach the storage device before they are removed
+        isWritten = isWritten && syncFile(file);
+        return std::fclose(file) == 0 && isWritten;
+    }
+
+    bool DbSnapshot::replace(const std::string& f_temporaryPath, const std::string& f_path)
+    {
+        std::error_code error{};
+        std::filesystem::rename(f_temporaryPath, f_path, error);
+        if (error)
+        {
+            std::filesystem::remove(f_temporaryPath, error);
+            return false;
+        }
+
+        // The rename itself is stored in the directory, which has to be synced too
+        return syncDirectory(std::filesystem::path{ f_path }.parent_path());
+    }
+
+    bool DbSnapshot::open(const std::string& f_path)
+    {
+        m_numberOfRecords = 0;
+        if (!m_file.open(f_path) || m_file.getSize() < sizeof(DbSnapshotHeader))
+        {
+            m_file.close();
+            return false;
+        }
+
+        DbSnapshotHeader header{};
+        std::memcpy(&header, m_file.getData(), sizeof(header));
+        if (std::memcmp(header.magic, cSnapshotMagic, sizeof(header.magic)) != 0 || header.version != cSnapshotVersion)
+        {
+            m_file.close();
+            return false;
+        }
+
+        // Find the position of every array and check that all of them are inside the file
+        uint64_t numberOfRecords = header.numberOfRecords;
+        uint64_t idsPosition = alignSize(sizeof(header));
+        uint64_t balancesPosition = idsPosition + alignSize(numberOfRecords * sizeof(uint64_t));
+        uint64_t nameOffsetsPosition = balancesPosition + alignSize(numberOfRecords * sizeof(int32_t));
+        uint64_t addressOffsetsPosition = nameOffsetsPosition + alignSize((numberOfRecords + 1) * sizeof(uint64_t));
+        uint64_t namesPosition = addressOffsetsPosition + alignSize((numberOfRecords + 1) * sizeof(uint64_t));
+        uint64_t addressesPosition = namesPosition + alignSize(header.numberOfNameBytes);
+        uint64_t endPosition = addressesPosition + alignSize(header.numberOfAddressBytes);
+        if (numberOfRecords > m_file.getSize() / sizeof(uint64_t) || header.numberOfNameBytes > m_file.getSize() ||
+            header.numberOfAddressBytes > m_file.getSize() || endPosition != m_file.getSize())
+        {
+            m_file.close();
+            return false;
+        }
+
+        // The mapping starts at a page boundary and the arrays are aligned, so they can be used in place
+        const unsigned char* data = m_file.getData();
+        m_ids = reinterpret_cast<const uint64_t*>(data + idsPosition);
+        m_balances = reinterpret_cast<const int32_t*>(data + balancesPosition);
+        m_nameOffsets = reinterpret_cast<const uint64_t*>(data + nameOffsetsPosition);
+        m_addressOffsets = reinterpret_cast<const uint64_t*>(data + addressOffsetsPosition);
+        m_names = reinterpret_cast<const char*>(data + namesPosition);
+        m_addresses = reinterpret_cast<const char*>(data + addressesPosition);
+        if (m_nameOffsets[numberOfRecords] != header.numberOfNameBytes ||
+            m_addressOffsets[numberOfRecords] != header.numberOfAddressBytes)
+        {
+            m_file.close();
+            return false;
+        }
+        m_numberOfRecords = numberOfRecords;
+        return true;
+    }
+
+    uint64_t DbSnapshot::getNumberOfRecords() const
+    {
+        return m_numberOfRecords;
+    }
+
+    const uint64_t* DbSnapshot::getIds() const
+    {
+        return m_ids;
+    }
+
+    const int32_t* DbSnapshot::getBalances() const
+    {
+        return m_balances;
+    }
+
+    const uint64_t* DbSnapshot::getNameOffsets() const
+    {
+        return m_nameOffsets;
+    }
+
+    const char* DbSnapshot::getNameCharacters() const
+    {
+        return m_names;
+    }
+
+    const uint64_t* DbSnapshot::getAddressOffsets() const
+    {
+        return m_addressOffsets;
+    }
+
+    const char* DbSnapshot::getAddressCharacters() const
+    {
+        return m_addresses;
+    }
+
+    std::string_view DbSnapshot::getName(size_t f_index) const
+    {
+        return std::string_view{ m_names + m_nameOffsets[f_index], m_nameOffsets[f_index + 1] - m_nameOffsets[f_index] };
+    }
+
+    std::string_view DbSnapshot::getAddress(size_t f_index) const
+    {
+        return std::string_view{ m_addresses + m_addressOffsets[f_index],
+            m_addressOffsets[f_index + 1] - m_addressOffsets[f_index] };
+    }
+
+    bool DbSnapshot::readRecords(DbTestRecordCollection& f_records) const
+    {
+        f_records.clear();
+        f_records.reserve(m_numberOfRecords);
+        for (size_t index = 0; index < m_numberOfRecords; ++index)
+        {
+            // The offsets are checked here, where they are read anyway, instead of when opening the file
+            if (m_nameOffsets[index] > m_nameOffsets[index + 1] || m_addressOffsets[index] > m_addressOffsets[index + 1])
+            {
+                f_records.clear();
+                return false;
+            }
+            f_records.push_back({ m_ids[index], std::string{ getName(index) }, m_balances[index], std::string{ getAddress(index) } });
+        }
+        return true;
+    }
+} /// namespace xq
@@ -0,0 +1,289 @@
+/// @file DbStringArena.cpp
+///
+/// @brief Implementation of the arena storing the strings of the string columns.
+/// @details Copies the strings one after another into large contiguous slabs,
+/// so that the columns only keep the position and length of every string.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "DbStringArena.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace xq
+{
+    // The size of a slab. Longer strings get a slab of their own size.
+    constexpr size_t const cSlabSize{ 64 * 1024 };
+    // The number of unused bytes, below which the strings are never copied into a new arena
+    constexpr size_t const cMinimumUnusedBytesToRepack{ 1024 * 1024 };
+
+    DbStringArenaView DbStringArena::addString(std::string_view f_string)
+    {
+        // Start a new slab when the string does not fit in the current one
+        if (m_slabs.empty() || m_currentSlabUsedBytes + f_string.size() > m_currentSlabSize)
+        {
+            m_currentSlabSize = std::max(cSlabSize, f_string.size());
+            m_currentSlabUsedBytes = 0;
+            m_slabs.emplace_back(new char[m_currentSlabSize]);
+        }
+
+        DbStringArenaView view{ static_cast<uint32_t>(m_slabs.size() - 1), static_cast<uint32_t>(m_currentSlabUsedBytes),
+            static_cast<uint32_t>(f_string.size()) };
+        if (!f_string.empty())
+        {
+            std::memcpy(m_slabs.back().get() + m_currentSlabUsedBytes, f_string.data(), f_string.size());
+        }
+        m_currentSlabUsedBytes += f_string.size();
+        m_numberOfUsedBytes += f_string.size();
+        return view;
+    }
+
+    std::string_view DbStringArena::getString(const DbStringArenaView& f_view) const
+    {
+        return std::string_view{ m_slabs[f_view.slab].get() + f_view.offset, f_view.length };
+    }
+
+    void DbStringArena::clear()
+    {
+        m_slabs.clear();
+        m_currentSlabSize = 0;
+        m_currentSlabUsedBytes = 0;
+        m_numberOfUsedBytes = 0;
+    }
+
+    size_t DbStringArena::getNumberOfSlabs() const
+    {
+        return m_slabs.size();
+    }
+
+    size_t DbStringArena::getNumberOfUsedBytes() const
+    {
+        return m_numberOfUsedBytes;
+    }
+
+    void DbStringColumn::appendString(const std::string& f_string)
+    {
+        copyMappedStrings();
+        if (m_isDictionaryEncoded)
+        {
+            m_codes.emplace_back(encodeString(f_string));
+            return;
+        }
+        m_views.emplace_back(m_arena.addString(f_string));
+    }
+
+    void DbStringColumn::setString(size_t f_index, const std::string& f_string)
+    {
+        copyMappedStrings();
+        if (m_isDictionaryEncoded)
+        {
+            m_codes[f_index] = encodeString(f_string);
+            return;
+        }
+        uint32_t oldLength = m_views[f_index].length;
+        m_views[f_index] = m_arena.addString(f_string);
+        releaseString(oldLength);
+    }
+
+    void DbStringColumn::mapStrings(const uint64_t* f_offsets, const char* f_characters, size_t f_numberOfStrings)
+    {
+        clear();
+        m_mappedOffsets = f_offsets;
+        m_mappedCharacters = f_characters;
+        m_numberOfMappedStrings = f_numberOfStrings;
+        if (m_isDictionaryEncoded)
+        {
+            copyMappedStrings();
+        }
+    }
+
+    void DbStringColumn::eraseString(size_t f_index)
+    {
+        copyMappedStrings();
+        if (m_isDictionaryEncoded)
+        {
+            m_codes.erase(m_codes.begin() + static_cast<std::ptrdiff_t>(f_index));
+            return;
+        }
+        uint32_t oldLength = m_views[f_index].length;
+        m_views.erase(m_views.begin() + static_cast<std::ptrdiff_t>(f_index));
+        releaseString(oldLength);
+    }
+
+    std::string_view DbStringColumn::getString(size_t f_index) const
+    {
+        if (m_mappedOffsets != nullptr)
+        {
+            return std::string_view{ m_mappedCharacters + m_mappedOffsets[f_index],
+                static_cast<size_t>(m_mappedOffsets[f_index + 1] - m_mappedOffsets[f_index]) };
+        }
+        if (m_isDictionaryEncoded)
+        {
+            return m_arena.getString(m_dictionaryViews[m_codes[f_index]]);
+        }
+        return m_arena.getString(m_views[f_index]);
+    }
+
+    void DbStringColumn::reserve(size_t f_numberOfStrings)
+    {
+        copyMappedStrings();
+        if (m_isDictionaryEncoded)
+        {
+            m_codes.reserve(f_numberOfStrings);
+            return;
+        }
+        m_views.reserve(f_numberOfStrings);
+    }
+
+    void DbStringColumn::clear()
+    {
+        // The encoding is kept, so that the column can be filled again the same way
+        m_arena.clear();
+        m_views.clear();
+        m_mappedOffsets = nullptr;
+        m_mappedCharacters = nullptr;
+        m_numberOfMappedStrings = 0;
+        m_numberOfUnusedBytes = 0;
+        m_codes.clear();
+        m_dictionaryViews.clear();
+        m_dictionary.clear();
+    }
+
+    size_t DbStringColumn::size() const
+    {
+        if (m_mappedOffsets != nullptr)
+        {
+            return m_numberOfMappedStrings;
+        }
+        return m_isDictionaryEncoded ? m_codes.size() : m_views.size();
+    }
+
+    const DbStringArena& DbStringColumn::getArena() const
+    {
+        return m_arena;
+    }
+
+    void DbStringColumn::enableDictionaryEncoding()
+    {
+        if (m_isDictionaryEncoded)
+        {
+            return;
+        }
+        if (m_mappedOffsets != nullptr)
+        {
+            // Encode the strings directly from the place where they are used
+            m_isDictionaryEncoded = true;
+            copyMappedStrings();
+            return;
+        }
+
+        // Move the current strings aside and store only the distinct ones in the new arena
+        DbStringArena plainArena = std::move(m_arena);
+        DbStringArenaViewsCollection plainViews = std::move(m_views);
+        m_arena = DbStringArena{};
+        m_views = DbStringArenaViewsCollection{};
+        m_numberOfUnusedBytes = 0;
+        m_isDictionaryEncoded = true;
+
+        m_codes.reserve(plainViews.size());
+        for (const auto& view : plainViews)
+        {
+            m_codes.emplace_back(encodeString(plainArena.getString(view)));
+        }
+    }
+
+    bool DbStringColumn::isDictionaryEncoded() const
+    {
+        return m_isDictionaryEncoded;
+    }
+
+    const DbStringCodesCollection& DbStringColumn::getCodes() const
+    {
+        return m_codes;
+    }
+
+    size_t DbStringColumn::getDictionarySize() const
+    {
+        return m_dictionaryViews.size();
+    }
+
+    std::string_view DbStringColumn::getDictionaryString(uint32_t f_code) const
+    {
+        return m_arena.getString(m_dictionaryViews[f_code]);
+    }
+
+    void DbStringColumn::copyMappedStrings()
+    {
+        if (m_mappedOffsets == nullptr)
+        {
+            return;
+        }
+
+        const uint64_t* offsets = m_mappedOffsets;
+        const char* characters = m_mappedCharacters;
+        size_t numberOfStrings = m_numberOfMappedStrings;
+        m_mappedOffsets = nullptr;
+        m_mappedCharacters = nullptr;
+        m_numberOfMappedStrings = 0;
+        if (m_isDictionaryEncoded)
+        {
+            m_codes.reserve(numberOfStrings);
+        }
+        else
+        {
+            m_views.reserve(numberOfStrings);
+        }
+        for (size_t index = 0; index < numberOfStrings; ++index)
+        {
+            std::string_view value{ characters + offsets[index], static_cast<size_t>(offsets[index + 1] - offsets[index]) };
+            if (m_isDictionaryEncoded)
+            {
+                m_codes.emplace_back(encodeString(value));
+            }
+            else
+            {
+                m_views.emplace_back(m_arena.addString(value));
+            }
+        }
+    }
+
+    uint32_t DbStringColumn::encodeString(std::string_view f_string)
+    {
+        auto foundCodeIter = m_dictionary.find(f_string);
+        if (foundCodeIter != m_dictionary.end())
+        {
+            return foundCodeIter->second;
+        }
+
+        // The key views the characters in the arena, which are never moved
+        auto view = m_arena.addString(f_string);
+        auto code = static_cast<uint32_t>(m_dictionaryViews.size());
+        m_dictionaryViews.emplace_back(view);
+        m_dictionary.emplace(m_arena.getString(view), code);
+        return code;
+    }
+
+    void DbStringColumn::releaseString(uint32_t f_length)
+    {
+        m_numberOfUnusedBytes += f_length;
+        size_t numberOfLiveBytes = m_arena.getNumberOfUsedBytes() - m_numberOfUnusedBytes;
+        if (m_numberOfUnusedBytes < cMinimumUnusedBytesToRepack || m_numberOfUnusedBytes < numberOfLiveBytes)
+        {
+            return;
+        }
+
+        // Copy the strings in the order of the column, so that they are contiguous again
+        DbStringArena packedArena{};
+        for (auto& view : m_views)
+        {
+            view = packedArena.addString(m_arena.getString(view));
+        }
+        m_arena = std::move(packedArena);
+        m_numberOfUnusedBytes = 0;
+    }
+} /// namespace xq
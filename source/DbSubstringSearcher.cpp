@@ -0,0 +1,120 @@
+/// @file DbSubstringSearcher.cpp
+///
+/// @brief Implementation of the precompiled substring searcher for the string columns.
+/// @details Prepares the searched string once per query, so that checking each
+/// record only has to scan the text of the record.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "DbSubstringSearcher.hpp"
+
+#include <cstring>
+
+namespace xq
+{
+    // Patterns with at least that many characters are searched with the Boyer-Moore-Horspool algorithm
+    constexpr size_t const cHorspoolMinimumPatternLength{ 16 };
+
+    DbSubstringSearcher::DbSubstringSearcher()
+        :
+        DbSubstringSearcher(std::string{})
+    {
+    }
+
+    DbSubstringSearcher::DbSubstringSearcher(const std::string& f_pattern)
+        :
+        m_pattern{ f_pattern },
+        m_useHorspool{ f_pattern.size() >= cHorspoolMinimumPatternLength },
+        m_shiftTable{}
+    {
+        if (m_useHorspool)
+        {
+            // Characters which are not in the pattern allow to skip the whole length of the pattern. The
+            // ones in the pattern allow to skip up to their last position before the end of the pattern.
+            m_shiftTable.fill(static_cast<uint32_t>(m_pattern.size()));
+            for (size_t i = 0; i + 1 < m_pattern.size(); ++i)
+            {
+                m_shiftTable[static_cast<unsigned char>(m_pattern[i])] = static_cast<uint32_t>(m_pattern.size() - 1 - i);
+            }
+        }
+    }
+
+    bool DbSubstringSearcher::isFoundIn(const std::string& f_text) const
+    {
+        return isFoundIn(f_text.data(), f_text.size());
+    }
+
+    bool DbSubstringSearcher::isFoundIn(const char* f_text, size_t f_textLength) const
+    {
+        // The empty pattern is found in every text, the same way as with std::string::find
+        if (m_pattern.empty())
+        {
+            return true;
+        }
+        if (f_textLength < m_pattern.size())
+        {
+            return false;
+        }
+        if (m_useHorspool)
+        {
+            return findByHorspool(f_text, f_textLength);
+        }
+        return findByFirstAndLastCharacter(f_text, f_textLength);
+    }
+
+    const std::string& DbSubstringSearcher::getPattern() const
+    {
+        return m_pattern;
+    }
+
+    bool DbSubstringSearcher::findByFirstAndLastCharacter(const char* f_text, size_t f_textLength) const
+    {
+        const size_t patternLength = m_pattern.size();
+        const char firstCharacter = m_pattern.front();
+        const char lastCharacter = m_pattern.back();
+
+        // The pattern can only start at positions, which leave enough characters for the rest of it
+        const char* current = f_text;
+        const char* const lastStart = f_text + (f_textLength - patternLength);
+        while (current <= lastStart)
+        {
+            current = static_cast<const char*>(std::memchr(current, firstCharacter, static_cast<size_t>(lastStart - current) + 1));
+            if (current == nullptr)
+            {
+                return false;
+            }
+
+            // Check the last character before comparing the characters in between
+            if (current[patternLength - 1] == lastCharacter &&
+                (patternLength <= 2 || std::memcmp(current + 1, m_pattern.data() + 1, patternLength - 2) == 0))
+            {
+                return true;
+            }
+            ++current;
+        }
+        return false;
+    }
+
+    bool DbSubstringSearcher::findByHorspool(const char* f_text, size_t f_textLength) const
+    {
+        const size_t patternLength = m_pattern.size();
+        const char lastCharacter = m_pattern.back();
+
+        size_t position = 0;
+        while (position + patternLength <= f_textLength)
+        {
+            // Compare the last character of the window first and shift by it if the window doesn't match
+            char windowLastCharacter = f_text[position + patternLength - 1];
+            if (windowLastCharacter == lastCharacter &&
+                std::memcmp(f_text + position, m_pattern.data(), patternLength - 1) == 0)
+            {
+                return true;
+            }
+            position += m_shiftTable[static_cast<unsigned char>(windowLastCharacter)];
+        }
+        return false;
+    }
+} /// namespace xq
@@ -0,0 +1,141 @@
+/// @file DbTableTestColumnStore.cpp
+///
+/// @brief Implementation of the column-oriented storage for the test table.
+/// @details Keeps every column of the test table in its own contiguous array,
+/// so that scanning a single column touches only the data of that column.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "DbTableTestColumnStore.hpp"
+
+namespace xq
+{
+    void DbTableTestColumnStore::build(const DbTestRecordCollection& f_records)
+    {
+        m_ids.clear();
+        m_names.clear();
+        m_balances.clear();
+        m_addresses.clear();
+
+        // Reserve the memory for all the columns at once to avoid reallocations
+        m_ids.reserve(f_records.size());
+        m_names.reserve(f_records.size());
+        m_balances.reserve(f_records.size());
+        m_addresses.reserve(f_records.size());
+
+        for (const auto& record : f_records)
+        {
+            appendRecord(record);
+        }
+    }
+
+    void DbTableTestColumnStore::mapSnapshot(const DbSnapshot& f_snapshot)
+    {
+        auto numberOfRecords = static_cast<size_t>(f_snapshot.getNumberOfRecords());
+        m_ids.mapValues(f_snapshot.getIds(), numberOfRecords);
+        m_names.mapStrings(f_snapshot.getNameOffsets(), f_snapshot.getNameCharacters(), numberOfRecords);
+        m_balances.mapValues(f_snapshot.getBalances(), numberOfRecords);
+        m_addresses.mapStrings(f_snapshot.getAddressOffsets(), f_snapshot.getAddressCharacters(), numberOfRecords);
+    }
+
+    void DbTableTestColumnStore::appendRecord(const DbTableTest& f_record)
+    {
+        m_ids.appendValue(f_record.id);
+        m_names.appendString(f_record.name);
+        m_balances.appendValue(f_record.balance);
+        m_addresses.appendString(f_record.address);
+    }
+
+    void DbTableTestColumnStore::reserve(size_t f_numberOfRecords)
+    {
+        m_ids.reserve(f_numberOfRecords);
+        m_names.reserve(f_numberOfRecords);
+        m_balances.reserve(f_numberOfRecords);
+        m_addresses.reserve(f_numberOfRecords);
+    }
+
+    void DbTableTestColumnStore::setRecord(size_t f_index, const DbTableTest& f_record)
+    {
+        m_ids.setValue(f_index, f_record.id);
+        m_names.setString(f_index, f_record.name);
+        m_balances.setValue(f_index, f_record.balance);
+        m_addresses.setString(f_index, f_record.address);
+    }
+
+    void DbTableTestColumnStore::deleteRecord(size_t f_index)
+    {
+        m_ids.clearValue(f_index);
+        m_names.setString(f_index, std::string{});
+        m_balances.clearValue(f_index);
+        m_addresses.setString(f_index, std::string{});
+    }
+
+    void DbTableTestColumnStore::eraseRecord(size_t f_index)
+    {
+        m_ids.eraseValue(f_index);
+        m_names.eraseString(f_index);
+        m_balances.eraseValue(f_index);
+        m_addresses.eraseString(f_index);
+    }
+
+    void DbTableTestColumnStore::enableIdCompression()
+    {
+        m_ids.enableCompression(getDeletedIndexes());
+    }
+
+    void DbTableTestColumnStore::enableBalanceCompression()
+    {
+        m_balances.enableCompression(getDeletedIndexes());
+    }
+
+    void DbTableTestColumnStore::enableNameDictionaryEncoding()
+    {
+        m_names.enableDictionaryEncoding();
+    }
+
+    void DbTableTestColumnStore::enableAddressDictionaryEncoding()
+    {
+        m_addresses.enableDictionaryEncoding();
+    }
+
+    size_t DbTableTestColumnStore::getNumberOfRecords() const
+    {
+        return m_ids.size();
+    }
+
+    const DbIdColumn& DbTableTestColumnStore::getIds() const
+    {
+        return m_ids;
+    }
+
+    const DbStringColumn& DbTableTestColumnStore::getNames() const
+    {
+        return m_names;
+    }
+
+    const DbBalanceColumn& DbTableTestColumnStore::getBalances() const
+    {
+        return m_balances;
+    }
+
+    const DbStringColumn& DbTableTestColumnStore::getAddresses() const
+    {
+        return m_addresses;
+    }
+
+    DbRecordIndexesCollection DbTableTestColumnStore::getDeletedIndexes() const
+    {
+        DbRecordIndexesCollection deletedIndexes{};
+        for (size_t index = 0; index < m_ids.size(); ++index)
+        {
+            if (m_ids.getValue(index) == 0)
+            {
+                deletedIndexes.emplace_back(index);
+            }
+        }
+        return deletedIndexes;
+    }
+} /// namespace xq
@@ -0,0 +1,247 @@
+/// @file DbTrigramIndex.cpp
+///
+/// @brief Implementation of the trigram index for the string columns.
+/// @details Maps every sequence of three characters found in a string column
+/// to the positions of the records containing it, so that substring searches
+/// only need to check the records containing all the trigrams of the searched string.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "DbTrigramIndex.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+namespace xq
+{
+    // Posting lists that many times longer than the candidates are intersected using binary search
+    constexpr size_t const cBinarySearchIntersectionRatio{ 32 };
+    // The delta buffers of a posting list are merged once they have more positions than that or the square root of its size
+    constexpr size_t const cMinimumDeltaBufferSize{ 64 };
+
+    void DbTrigramIndex::addString(size_t f_index, const std::string& f_string)
+    {
+        for (auto trigram : getTrigrams(f_string))
+        {
+            auto& postingList = m_postingLists[trigram];
+
+            // A position removed after the last merge is still in the sorted array, so simply restore it
+            auto& removedPositions = postingList.removedPositions;
+            auto removedIter = std::lower_bound(removedPositions.begin(), removedPositions.end(), f_index);
+            if (removedIter != removedPositions.end() && *removedIter == f_index)
+            {
+                removedPositions.erase(removedIter);
+                continue;
+            }
+
+            auto& addedPositions = postingList.addedPositions;
+            auto addedIter = std::lower_bound(addedPositions.begin(), addedPositions.end(), f_index);
+            if (addedIter != addedPositions.end() && *addedIter == f_index)
+            {
+                continue;
+            }
+
+            // Records are mostly added at the end, so check this case first
+            auto& positions = postingList.positions;
+            if (positions.empty() || positions.back() < f_index)
+            {
+                positions.emplace_back(f_index);
+                continue;
+            }
+            if (!std::binary_search(positions.begin(), positions.end(), f_index))
+            {
+                addedPositions.insert(addedIter, f_index);
+                mergeIfNeeded(postingList);
+            }
+        }
+    }
+
+    void DbTrigramIndex::removeString(size_t f_index, const std::string& f_string)
+    {
+        for (auto trigram : getTrigrams(f_string))
+        {
+            auto postingListIter = m_postingLists.find(trigram);
+            if (postingListIter == m_postingLists.end())
+            {
+                continue;
+            }
+
+            // A position added after the last merge is only in the delta buffer, so simply drop it
+            auto& postingList = postingListIter->second;
+            auto& addedPositions = postingList.addedPositions;
+            auto addedIter = std::lower_bound(addedPositions.begin(), addedPositions.end(), f_index);
+            if (addedIter != addedPositions.end() && *addedIter == f_index)
+            {
+                addedPositions.erase(addedIter);
+            }
+            else if (std::binary_search(postingList.positions.begin(), postingList.positions.end(), f_index))
+            {
+                auto& removedPositions = postingList.removedPositions;
+                auto removedIter = std::lower_bound(removedPositions.begin(), removedPositions.end(), f_index);
+                if (removedIter == removedPositions.end() || *removedIter != f_index)
+                {
+                    removedPositions.insert(removedIter, f_index);
+                    mergeIfNeeded(postingList);
+                }
+            }
+
+            // Don't keep empty posting lists for trigrams, which are not used anymore
+            if (postingList.getNumberOfPositions() == 0)
+            {
+                m_postingLists.erase(postingListIter);
+            }
+        }
+    }
+
+    void DbTrigramIndex::clear()
+    {
+        m_postingLists.clear();
+    }
+
+    bool DbTrigramIndex::findCandidates(const std::string& f_matchString, DbRecordIndexesCollection& f_output) const
+    {
+        auto trigrams = getTrigrams(f_matchString);
+        if (trigrams.empty())
+        {
+            return false;
+        }
+
+        // If any trigram is not found, no record can contain the searched string
+        std::vector<const DbPostingList*> postingLists{};
+        postingLists.reserve(trigrams.size());
+        for (auto trigram : trigrams)
+        {
+            auto postingListIter = m_postingLists.find(trigram);
+            if (postingListIter == m_postingLists.end())
+            {
+                return true;
+            }
+            postingLists.emplace_back(&postingListIter->second);
+        }
+
+        // Start with the shortest posting list, so that the candidates are reduced as fast as possible
+        std::sort(postingLists.begin(), postingLists.end(), [](const DbPostingList* f_left, const DbPostingList* f_right) {
+            return f_left->getNumberOfPositions() < f_right->getNumberOfPositions();
+        });
+
+        DbRecordIndexesCollection candidates{};
+        getPositions(*postingLists.front(), candidates);
+        DbRecordIndexesCollection intersection{};
+        for (size_t i = 1; i < postingLists.size() && !candidates.empty(); ++i)
+        {
+            intersection.clear();
+            intersectPositions(candidates, *postingLists[i], intersection);
+            candidates.swap(intersection);
+        }
+
+        f_output.insert(f_output.end(), candidates.begin(), candidates.end());
+        return true;
+    }
+
+    size_t DbTrigramIndex::getNumberOfTrigrams() const
+    {
+        return m_postingLists.size();
+    }
+
+    std::vector<uint32_t> DbTrigramIndex::getTrigrams(const std::string& f_string)
+    {
+        std::vector<uint32_t> trigrams{};
+        for (size_t i = 0; i + 3 <= f_string.size(); ++i)
+        {
+            trigrams.emplace_back(static_cast<uint32_t>(static_cast<unsigned char>(f_string[i])) << 16 |
+                static_cast<uint32_t>(static_cast<unsigned char>(f_string[i + 1])) << 8 |
+                static_cast<uint32_t>(static_cast<unsigned char>(f_string[i + 2])));
+        }
+
+        // Every record shall be added only once to the posting list of a trigram
+        std::sort(trigrams.begin(), trigrams.end());
+        trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+        return trigrams;
+    }
+
+    void DbTrigramIndex::getPositions(const DbPostingList& f_postingList, DbRecordIndexesCollection& f_output)
+    {
+        if (f_postingList.addedPositions.empty() && f_postingList.removedPositions.empty())
+        {
+            f_output = f_postingList.positions;
+            return;
+        }
+
+        DbRecordIndexesCollection keptPositions{};
+        keptPositions.reserve(f_postingList.positions.size() - f_postingList.removedPositions.size());
+        std::set_difference(f_postingList.positions.begin(), f_postingList.positions.end(),
+            f_postingList.removedPositions.begin(), f_postingList.removedPositions.end(), std::back_inserter(keptPositions));
+
+        f_output.clear();
+        f_output.reserve(keptPositions.size() + f_postingList.addedPositions.size());
+        std::merge(keptPositions.begin(), keptPositions.end(),
+            f_postingList.addedPositions.begin(), f_postingList.addedPositions.end(), std::back_inserter(f_output));
+    }
+
+    void DbTrigramIndex::intersectPositions(const DbRecordIndexesCollection& f_candidates, const DbPostingList& f_postingList,
+        DbRecordIndexesCollection& f_output)
+    {
+        // Few candidates are looked up in a long posting list with binary search instead of
+        // traversing the whole list. Each search continues from the previously found position.
+        const auto& positions = f_postingList.positions;
+        bool useBinarySearch = f_candidates.size() * cBinarySearchIntersectionRatio < positions.size();
+        auto positionsIter = positions.begin();
+        auto addedIter = f_postingList.addedPositions.begin();
+        auto addedEnd = f_postingList.addedPositions.end();
+        auto removedIter = f_postingList.removedPositions.begin();
+        auto removedEnd = f_postingList.removedPositions.end();
+        for (auto candidate : f_candidates)
+        {
+            if (useBinarySearch)
+            {
+                positionsIter = std::lower_bound(positionsIter, positions.end(), candidate);
+            }
+            else
+            {
+                while (positionsIter != positions.end() && *positionsIter < candidate)
+                {
+                    ++positionsIter;
+                }
+            }
+
+            // The delta buffers are small, so they are simply traversed along with the candidates
+            while (addedIter != addedEnd && *addedIter < candidate)
+            {
+                ++addedIter;
+            }
+            while (removedIter != removedEnd && *removedIter < candidate)
+            {
+                ++removedIter;
+            }
+
+            bool isKept = positionsIter != positions.end() && *positionsIter == candidate &&
+                (removedIter == removedEnd || *removedIter != candidate);
+            bool isAdded = addedIter != addedEnd && *addedIter == candidate;
+            if (isKept || isAdded)
+            {
+                f_output.emplace_back(candidate);
+            }
+        }
+    }
+
+    void DbTrigramIndex::mergeIfNeeded(DbPostingList& f_postingList)
+    {
+        auto threshold = std::max(cMinimumDeltaBufferSize,
+            static_cast<size_t>(std::sqrt(static_cast<double>(f_postingList.positions.size()))));
+        if (f_postingList.addedPositions.size() + f_postingList.removedPositions.size() <= threshold)
+        {
+            return;
+        }
+
+        // Drop the removed positions and merge the added ones in a single pass over the sorted array
+        DbRecordIndexesCollection mergedPositions{};
+        getPositions(f_postingList, mergedPositions);
+        f_postingList.positions.swap(mergedPositions);
+        f_postingList.addedPositions.clear();
+        f_postingList.removedPositions.clear();
+    }
+} /// namespace xq
@@ -0,0 +1,353 @@
+/// @file DbWriteAheadLog.cpp
+///
+/// @brief Implementation of the write-ahead log of the database mutations.
+/// @details Appends every added and deleted record to a binary log file before the database
+/// is changed, so that the mutations can be replayed after a restart.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "DbMappedFile.hpp"
+#include "DbWriteAheadLog.hpp"
+
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace xq
+{
+    // The size of the length and the checksum before every payload
+    constexpr size_t const cWalEntryHeaderSize{ 2 * sizeof(uint32_t) };
+    // The size of the payload of a deletion - the type and the id
+    constexpr size_t const cWalDeletePayloadSize{ sizeof(uint8_t) + sizeof(uint64_t) };
+    // The size of the payload of an addition without the characters of the strings
+    constexpr size_t const cWalAddPayloadSize{ cWalDeletePayloadSize + sizeof(int32_t) + 2 * sizeof(uint32_t) };
+
+    namespace
+    {
+        /// @brief Calculate the CRC-32 checksum of some bytes.
+        /// @param[in] f_data The first byte.
+        /// @param[in] f_size The number of bytes.
+        /// @returns The checksum.
+        uint32_t calculateChecksum(const unsigned char* f_data, size_t f_size)
+        {
+            static const std::array<uint32_t, 256> table = [] {
+                std::array<uint32_t, 256> result{};
+                for (uint32_t index = 0; index < result.size(); ++index)
+                {
+                    uint32_t value = index;
+                    for (int bit = 0; bit < 8; ++bit)
+                    {
+                        value = (value & 1) != 0 ? 0xEDB88320u ^ (value >> 1) : value >> 1;
+                    }
+                    result[index] = value;
+                }
+                return result;
+            }();
+
+            uint32_t checksum{ 0xFFFFFFFFu };
+            for (size_t index = 0; index < f_size; ++index)
+            {
+                checksum = table[(checksum ^ f_data[index]) & 0xFF] ^ (checksum >> 8);
+            }
+            return checksum ^ 0xFFFFFFFFu;
+        }
+
+        /// @brief Append a value to the end of a buffer.
+        /// @param[in,out] f_buffer The buffer.
+        /// @param[in] f_value The value.
+        template<typename TValue>
+        void appendValue(DbWalBufferCollection& f_buffer, TValue f_value)
+        {
+            size_t position = f_buffer.size();
+            f_buffer.resize(position + sizeof(TValue));
+            std::memcpy(f_buffer.data() + position, &f_value, sizeof(TValue));
+        }
+
+        /// @brief Read a value from a possibly unaligned position.
+        /// @param[in] f_data The first byte of the value.
+        /// @returns The value.
+        template<typename TValue>
+        TValue readValue(const unsigned char* f_data)
+        {
+            TValue value{};
+            std::memcpy(&value, f_data, sizeof(TValue));
+            return value;
+        }
+
+        /// @brief Parse the complete entries at the beginning of some bytes.
+        /// @param[in] f_data The first byte of the log.
+        /// @param[in] f_size The number of bytes of the log.
+        /// @param[out] f_entries If not null, contains the parsed entries.
+        /// @returns The number of bytes of the complete entries.
+        size_t parseEntries(const unsigned char* f_data, size_t f_size, DbWalEntriesCollection* f_entries)
+        {
+            size_t position{ 0 };
+            while (f_size - position >= cWalEntryHeaderSize)
+            {
+                auto payloadSize = readValue<uint32_t>(f_data + position);
+                auto checksum = readValue<uint32_t>(f_data + position + sizeof(uint32_t));
+                const unsigned char* payload = f_data + position + cWalEntryHeaderSize;
+                if (payloadSize < cWalDeletePayloadSize || payloadSize > f_size - position - cWalEntryHeaderSize ||
+                    calculateChecksum(payload, payloadSize) != checksum)
+                {
+                    break;
+                }
+
+                DbWalEntry entry{ static_cast<DbWalEntryType>(payload[0]), DbTableTest{} };
+                entry.record.id = readValue<uint64_t>(payload + 1);
+                if (entry.type == DbWalEntryType::Add)
+                {
+                    if (payloadSize < cWalAddPayloadSize)
+                    {
+                        break;
+                    }
+                    entry.record.balance = readValue<int32_t>(payload + cWalDeletePayloadSize);
+                    auto nameLength = readValue<uint32_t>(payload + cWalDeletePayloadSize + sizeof(int32_t));
+                    auto addressLength = readValue<uint32_t>(payload + cWalAddPayloadSize - sizeof(uint32_t));
+                    if (static_cast<uint64_t>(cWalAddPayloadSize) + nameLength + addressLength != payloadSize)
+                    {
+                        break;
+                    }
+                    const char* strings = reinterpret_cast<const char*>(payload + cWalAddPayloadSize);
+                    entry.record.name.assign(strings, nameLength);
+                    entry.record.address.assign(strings + nameLength, addressLength);
+                }
+                else if (entry.type != DbWalEntryType::Delete || payloadSize != cWalDeletePayloadSize)
+                {
+                    break;
+                }
+
+                if (f_entries != nullptr)
+                {
+                    f_entries->emplace_back(std::move(entry));
+                }
+                position += cWalEntryHeaderSize + payloadSize;
+            }
+            return position;
+        }
+
+        /// @brief Get the size of a file.
+        /// @param[in] f_path The path of the file.
+        /// @param[out] f_size The size of the file. 0 if the file doesn't exist or isn't a regular file.
+        /// @returns True if the file doesn't exist or its size was read, false elsewhen.
+        bool getFileSize(const std::string& f_path, size_t& f_size)
+        {
+            std::error_code error{};
+            f_size = 0;
+            if (!std::filesystem::is_regular_file(f_path, error))
+            {
+                // A special file, like a pipe or a device, is appended to without reading it
+                return !error || error == std::errc::no_such_file_or_directory;
+            }
+            f_size = static_cast<size_t>(std::filesystem::file_size(f_path, error));
+            return !error;
+        }
+    }
+
+    DbWriteAheadLog::~DbWriteAheadLog()
+    {
+        close();
+    }
+
+    bool DbWriteAheadLog::open(const std::string& f_path, DbWalSyncPolicy f_syncPolicy, uint32_t f_groupSize)
+    {
+        close();
+
+        // Cut off an entry, which was only partly written, so that the new entries are readable after it
+        size_t fileSize{ 0 };
+        if (!getFileSize(f_path, fileSize))
+        {
+            return false;
+        }
+        if (fileSize > 0)
+        {
+            DbMappedFile mappedFile{};
+            if (!mappedFile.open(f_path))
+            {
+                return false;
+            }
+            size_t validSize = parseEntries(mappedFile.getData(), mappedFile.getSize(), nullptr);
+            mappedFile.close();
+            std::error_code error{};
+            if (validSize < fileSize)
+            {
+                std::filesystem::resize_file(f_path, validSize, error);
+                if (error)
+                {
+                    return false;
+                }
+            }
+        }
+
+        m_file = std::fopen(f_path.c_str(), "ab");
+        if (m_file == nullptr)
+        {
+            return false;
+        }
+        m_path = f_path;
+        m_syncPolicy = f_syncPolicy;
+        m_groupSize = f_groupSize > 0 ? f_groupSize : 1;
+        m_numberOfPendingCommits = 0;
+        m_buffer.clear();
+        m_numberOfSyncs = 0;
+        m_hasFailed = false;
+        return true;
+    }
+
+    void DbWriteAheadLog::close()
+    {
+        if (m_file != nullptr)
+        {
+            writePending(true);
+            std::fclose(m_file);
+            m_file = nullptr;
+        }
+        m_buffer.clear();
+        m_numberOfPendingCommits = 0;
+    }
+
+    bool DbWriteAheadLog::isOpen() const
+    {
+        return m_file != nullptr;
+    }
+
+    void DbWriteAheadLog::appendAdd(const DbTableTest& f_record)
+    {
+        auto payloadSize = static_cast<uint32_t>(cWalAddPayloadSize + f_record.name.size() + f_record.address.size());
+        size_t entryPosition = m_buffer.size();
+        m_buffer.reserve(entryPosition + cWalEntryHeaderSize + payloadSize);
+        appendValue(m_buffer, payloadSize);
+        appendValue(m_buffer, uint32_t{ 0 });
+        appendValue(m_buffer, static_cast<uint8_t>(DbWalEntryType::Add));
+        appendValue(m_buffer, f_record.id);
+        appendValue(m_buffer, f_record.balance);
+        appendValue(m_buffer, static_cast<uint32_t>(f_record.name.size()));
+        appendValue(m_buffer, static_cast<uint32_t>(f_record.address.size()));
+        m_buffer.insert(m_buffer.end(), f_record.name.begin(), f_record.name.end());
+        m_buffer.insert(m_buffer.end(), f_record.address.begin(), f_record.address.end());
+
+        // The checksum is filled in once the payload is complete
+        uint32_t checksum = calculateChecksum(m_buffer.data() + entryPosition + cWalEntryHeaderSize, payloadSize);
+        std::memcpy(m_buffer.data() + entryPosition + sizeof(uint32_t), &checksum, sizeof(checksum));
+    }
+
+    void DbWriteAheadLog::appendDelete(uint64_t f_id)
+    {
+        size_t entryPosition = m_buffer.size();
+        appendValue(m_buffer, static_cast<uint32_t>(cWalDeletePayloadSize));
+        appendValue(m_buffer, uint32_t{ 0 });
+        appendValue(m_buffer, static_cast<uint8_t>(DbWalEntryType::Delete));
+        appendValue(m_buffer, f_id);
+
+        uint32_t checksum = calculateChecksum(m_buffer.data() + entryPosition + cWalEntryHeaderSize, cWalDeletePayloadSize);
+        std::memcpy(m_buffer.data() + entryPosition + sizeof(uint32_t), &checksum, sizeof(checksum));
+    }
+
+    bool DbWriteAheadLog::commit()
+    {
+        // After a failed write the file might end with a part of an entry, so nothing is appended after it
+        if (m_file == nullptr || m_hasFailed)
+        {
+            m_buffer.clear();
+            m_numberOfPendingCommits = 0;
+            return false;
+        }
+
+        ++m_numberOfPendingCommits;
+        switch (m_syncPolicy)
+        {
+        case DbWalSyncPolicy::EveryCommit:
+            return writePending(true);
+        case DbWalSyncPolicy::GroupCommit:
+            // One write and one sync for the whole group
+            return m_numberOfPendingCommits < m_groupSize || writePending(true);
+        case DbWalSyncPolicy::NoSync:
+            return writePending(false);
+        }
+        return false;
+    }
+
+    bool DbWriteAheadLog::sync()
+    {
+        return m_file != nullptr && writePending(true) && !m_hasFailed;
+    }
+
+    bool DbWriteAheadLog::truncate()
+    {
+        if (m_file == nullptr)
+        {
+            return false;
+        }
+
+        m_buffer.clear();
+        m_numberOfPendingCommits = 0;
+        m_file = std::freopen(m_path.c_str(), "wb", m_file);
+        if (m_file == nullptr)
+        {
+            return false;
+        }
+        return writePending(true);
+    }
+
+    uint64_t DbWriteAheadLog::getNumberOfSyncs() const
+    {
+        return m_numberOfSyncs;
+    }
+
+    bool DbWriteAheadLog::readEntries(const std::string& f_path, DbWalEntriesCollection& f_entries)
+    {
+        f_entries.clear();
+        size_t fileSize{ 0 };
+        if (!getFileSize(f_path, fileSize))
+        {
+            return false;
+        }
+        if (fileSize == 0)
+        {
+            return true;
+        }
+
+        DbMappedFile mappedFile{};
+        if (!mappedFile.open(f_path))
+        {
+            return false;
+        }
+        parseEntries(mappedFile.getData(), mappedFile.getSize(), &f_entries);
+        return true;
+    }
+
+    bool DbWriteAheadLog::writePending(bool f_isSynced)
+    {
+        bool isWritten{ true };
+        if (!m_buffer.empty())
+        {
+            isWritten = std::fwrite(m_buffer.data(), 1, m_buffer.size(), m_file) == m_buffer.size();
+            m_buffer.clear();
+        }
+        m_numberOfPendingCommits = 0;
+        isWritten = std::fflush(m_file) == 0 && isWritten;
+
+        if (f_isSynced)
+        {
+#if defined(_WIN32)
+            isWritten = _commit(_fileno(m_file)) == 0 && isWritten;
+#else
+            isWritten = fsync(fileno(m_file)) == 0 && isWritten;
+#endif
+            ++m_numberOfSyncs;
+        }
+
+        m_hasFailed = m_hasFailed || !isWritten;
+        return isWritten;
+    }
+} /// namespace xq
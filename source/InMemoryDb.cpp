@@ -10,158 +10,1591 @@
 /// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
 /// @license No license required at all. Use it as you wish.
 
+#include "DbSnapshot.hpp"
 #include "InMemoryDb.hpp"
 
 #include <algorithm>
+#include <filesystem>
 #include <iterator>
+#include <limits>
+#include <string_view>
+#include <thread>
+#include <type_traits>
 
 namespace xq
 {
-	InMemoryDb::InMemoryDb(const DbTestRecordCollection& f_records)
+	// The minimum number of records to be scanned by a single thread of a parallel scan
+	constexpr size_t const cMinimumRecordsPerThread{ 16384 };
+
+	// The number of records marked in each word of a result set. The parallel chunks are aligned to it.
+	constexpr size_t const cRecordsPerResultSetWord{ 64 };
+
+	// The part of the records, which has to be deleted, before the deletions start compacting the records.
+	// The compaction moves records, so it is disabled until it is enabled explicitly.
+	constexpr double const cDefaultCompactionThreshold{ 1.0 };
+
+	// The maximum number of records relocated by a single deletion. It is more than one, so that the compaction
+	// removes the deleted records faster than new ones are deleted.
+	constexpr size_t const cCompactionStepSize{ 64 };
+
+    namespace
+    {
+        /// @brief Check if a record matches all the given matchers.
+        /// @param[in] f_matchers The matchers to check, the cheapest first.
+        /// @param[in] f_record The record to check.
+        /// @returns True if the record is not deleted and matches all the matchers, false elsewhen.
+        bool matchesAll(const DbTableTestMatchersCollection& f_matchers, const DbTableTest& f_record)
+        {
+            if (f_record.id == 0)
+            {
+                return false;
+            }
+            for (const auto& matcher : f_matchers)
+            {
+                if (!matcher.checkMatching(f_record))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// @brief Get the key of a group in the output of the aggregation.
+        /// @param[in] f_value The value of a string grouping column.
+        /// @returns The value as a string.
+        std::string toGroupKey(std::string_view f_value)
+        {
+            return std::string{ f_value };
+        }
+
+        /// @brief Get the key of a group in the output of the aggregation.
+        /// @param[in] f_value The value of an integer grouping column.
+        /// @returns The value converted to a string.
+        template <typename TValue>
+        std::string toGroupKey(TValue f_value)
+        {
+            return std::to_string(f_value);
+        }
+
+        /// @brief Get the key of a search in the query cache.
+        /// @details Uses the position of the column and the value of an integer column, so that different
+        /// strings of the same search, like "column2" with "7" and "007", have the same key.
+        /// @param[in] f_columnName The name of the column to search in.
+        /// @param[in] f_matchString The string to search for.
+        /// @returns The normalized search.
+        std::string makeQueryCacheKey(const std::string& f_columnName, const std::string& f_matchString)
+        {
+            std::string key = std::to_string(DbTableTestColumns::getColumnIndex(f_columnName)) + ':';
+            DbTableTestColumns::visitColumn(f_columnName, [&](auto f_column) {
+                typedef typename decltype(f_column)::ValueType TValue;
+                if constexpr (std::is_integral<TValue>::value)
+                {
+                    key += std::to_string(parseColumnValue<TValue>(f_matchString));
+                }
+                else
+                {
+                    key += f_matchString;
+                }
+            });
+            return key;
+        }
+    }
+
+	InMemoryDb::InMemoryDb(const DbTestRecordCollection& f_records, DbStorageLayout f_storageLayout)
+		:
+		InMemoryDb{ DbTestRecordCollection{ f_records }, f_storageLayout }
+	{
+	}
+
+	InMemoryDb::InMemoryDb(DbTestRecordCollection&& f_records, DbStorageLayout f_storageLayout)
 		:
-		m_records{ f_records }
+		m_records{ std::move(f_records) },
+		m_numberOfDeletedRecords{ 0 },
+		m_compactionThreshold{ cDefaultCompactionThreshold },
+		m_storageLayout{ f_storageLayout },
+		m_numberOfThreads{ 1 },
+		m_recordsVersion{ 0 }
 	{
+		rebuildIndexes();
+		if (m_storageLayout == DbStorageLayout::Column)
+		{
+			m_columns.build(m_records);
+		}
 	}
 
 	void InMemoryDb::findMatchingRecordsOptimized(const std::string& f_columnName,
 		const std::string& f_matchString, DbTestRecordPointersCollection& f_output) const
 	{
+        // The IDs are unique, so the primary-key index gives the only possible match
+        // without traversing the records
+        if (f_columnName == "column0")
+        {
+            auto foundRecord = findById(parseColumnValue<uint64_t>(f_matchString));
+            if (foundRecord != nullptr)
+            {
+                f_output.emplace_back(foundRecord);
+            }
+            return;
+        }
+
+        DbRecordIndexesCollection foundIndexes{};
+        if (findMatchingIndexesInSecondaryIndexes(f_columnName, f_matchString, foundIndexes))
+        {
+            appendRecords(foundIndexes, f_output);
+            return;
+        }
+
+        if (m_storageLayout == DbStorageLayout::Column)
+        {
+            findMatchingRecordsInColumns(f_columnName, f_matchString, f_output);
+            return;
+        }
+
         // This will decrease the execution time by several milliseconds 
         // but the used memory might be increased unnecessarely.
         f_output.reserve(m_records.size());
         
         // First check what column we are looking at before any processing of the records
-        if (f_columnName == "column0")
-        {
-            // Get the numeric value from the string before the processing of the records 
-            // instead of getting it with each record's processing
-            uint32_t matchValue = std::stoul(f_matchString);
-
-            // Traverse all records searching for a matching IDs
-            std::for_each(m_records.begin(), m_records.end(), [&](const DbTableTest& rec) {
-                if (matchValue == rec.id)
-                {
-                    f_output.emplace_back(&rec);
-                }
-            });
-        }
-        else if (f_columnName == "column1")
+        if (f_columnName == "column1")
         {
+            // Prepare the search for the string before the processing of the records
+            DbSubstringSearcher substringSearcher{ f_matchString };
             // Traverse all records searching for a matching Name
-            std::for_each(m_records.begin(), m_records.end(), [&](const DbTableTest& rec) {
-                if (rec.name.find(f_matchString) != std::string::npos)
-                {
-                    f_output.emplace_back(&rec);
-                }
-            });
+            collectMatchingRecords([&](size_t index) {
+                const auto& rec = m_records[index];
+                return rec.id != 0 && substringSearcher.isFoundIn(rec.name);
+            }, f_output);
         }
         else if (f_columnName == "column2")
         {
-            // Get the numeric value from the string before the processing of the records 
-            // instead of getting it with each record's processing
-            int64_t matchValue = std::stol(f_matchString);
-            // Traverse all records searching for a matching Balance
-            std::for_each(m_records.begin(), m_records.end(), [&](const DbTableTest& rec) {
-                if (matchValue == rec.balance)
-                {
-                    f_output.emplace_back(&rec);
-                }
-            });
+            // Traverse only the zones of records, which might contain the Balance
+            findMatchingRecordsInZones(f_columnName, f_matchString, f_output);
         }
         else if (f_columnName == "column3")
         {
+            // Prepare the search for the string before the processing of the records
+            DbSubstringSearcher substringSearcher{ f_matchString };
             // Traverse all records searching for a matching Address
-            std::for_each(m_records.begin(), m_records.end(), [&](const DbTableTest& rec) {
-                if (rec.address.find(f_matchString) != std::string::npos)
-                {
-                    f_output.emplace_back(&rec);
-                }
-            });
+            collectMatchingRecords([&](size_t index) {
+                const auto& rec = m_records[index];
+                return rec.id != 0 && substringSearcher.isFoundIn(rec.address);
+            }, f_output);
         }
 	}
 
     void InMemoryDb::findMatchingRecords(const std::string& f_columnName,
         const std::string& f_matchString, DbTestRecordPointersCollection& f_output) const
     {
+        if (m_queryCache == nullptr)
+        {
+            findMatchingRecordsWithoutCache(f_columnName, f_matchString, f_output);
+            return;
+        }
+
+        auto key = makeQueryCacheKey(f_columnName, f_matchString);
+        DbCachedResult cachedIndexes{};
+        if (m_queryCache->findResult(key, m_recordsVersion, cachedIndexes))
+        {
+            appendRecords(*cachedIndexes, f_output);
+            return;
+        }
+
+        // The positions stay valid when the collection of records is reallocated, unlike the pointers
+        size_t firstFound = f_output.size();
+        findMatchingRecordsWithoutCache(f_columnName, f_matchString, f_output);
+        auto foundIndexes = std::make_shared<DbRecordIndexesCollection>();
+        foundIndexes->reserve(f_output.size() - firstFound);
+        for (size_t index = firstFound; index < f_output.size(); ++index)
+        {
+            foundIndexes->emplace_back(static_cast<size_t>(f_output[index] - m_records.data()));
+        }
+        m_queryCache->storeResult(key, m_recordsVersion, std::move(foundIndexes));
+    }
+
+    void InMemoryDb::findMatchingRecordsWithoutCache(const std::string& f_columnName,
+        const std::string& f_matchString, DbTestRecordPointersCollection& f_output) const
+    {
+        DbRecordIndexesCollection foundIndexes{};
+        if (findMatchingIndexesInSecondaryIndexes(f_columnName, f_matchString, foundIndexes))
+        {
+            appendRecords(foundIndexes, f_output);
+            return;
+        }
+
+        if (m_storageLayout == DbStorageLayout::Column)
+        {
+            findMatchingRecordsInColumns(f_columnName, f_matchString, f_output);
+            return;
+        }
+
         // This will decrease the execution time by several milliseconds 
         // but the used memory might be increased unnecessarely.
         f_output.reserve(m_records.size());
+
+        // The integer columns skip the zones of records, which cannot contain the value
+        if (findMatchingRecordsInZones(f_columnName, f_matchString, f_output))
+        {
+            return;
+        }
         
-        DbTableTestStringMatcher tableTestStringMatcher{ f_columnName, f_matchString };
-        std::for_each(m_records.begin(), m_records.end(), [&](const DbTableTest& rec) {
-            // Check if the record is not deleted already
-            if (rec.id != 0)
+        // Select the column once, so that the loop over the records is compiled for its type
+        DbTableTestColumns::visitColumn(f_columnName, [&](auto f_column) {
+            DbColumnMatcher<decltype(f_column)> columnMatcher{ f_matchString };
+            collectMatchingRecords([&](size_t index) {
+                // Check if the record is not deleted already and search for matching records
+                const auto& rec = m_records[index];
+                return rec.id != 0 && columnMatcher(rec);
+            }, f_output);
+        });
+    }
+
+    void InMemoryDb::findMatchingRecords(const std::string& f_columnName,
+        const std::string& f_matchString, DbResultSet& f_output) const
+    {
+        f_output.reset(m_records.size());
+
+        DbRecordIndexesCollection foundIndexes{};
+        if (findMatchingIndexesInSecondaryIndexes(f_columnName, f_matchString, foundIndexes))
+        {
+            for (auto index : foundIndexes)
+            {
+                f_output.addRecord(index);
+            }
+            return;
+        }
+
+        // The IDs are unique, so the primary-key index gives the only possible match
+        if (f_columnName == "column0")
+        {
+            auto foundIndexIter = m_idIndex.find(parseColumnValue<uint64_t>(f_matchString));
+            if (foundIndexIter != m_idIndex.end())
+            {
+                f_output.addRecord(foundIndexIter->second);
+            }
+            return;
+        }
+
+        DbTableTestColumns::visitColumn(f_columnName, [&](auto f_column) {
+            DbColumnMatcher<decltype(f_column)> columnMatcher{ f_matchString };
+            markMatchingRecords([&](size_t index) {
+                const auto& rec = m_records[index];
+                return rec.id != 0 && columnMatcher(rec);
+            }, f_output);
+        });
+    }
+
+    void InMemoryDb::findMatchingRecords(const DbQuery& f_query, DbTestRecordPointersCollection& f_output) const
+    {
+        DbRecordIndexesCollection candidateIndexes{};
+        DbTableTestMatchersCollection matchers{};
+        if (prepareQuery(f_query, candidateIndexes, matchers))
+        {
+            for (auto index : candidateIndexes)
             {
-                // Search for matching records
-                if (tableTestStringMatcher.checkMatching(rec))
+                if (matchesAll(matchers, m_records[index]))
                 {
-                    f_output.emplace_back(&rec);
+                    f_output.emplace_back(&m_records[index]);
                 }
             }
-        });
+            return;
+        }
+
+        collectMatchingRecords([&](size_t index) {
+            return matchesAll(matchers, m_records[index]);
+        }, f_output);
+    }
+
+    void InMemoryDb::findMatchingRecords(const DbQuery& f_query, DbResultSet& f_output) const
+    {
+        f_output.reset(m_records.size());
+
+        DbRecordIndexesCollection candidateIndexes{};
+        DbTableTestMatchersCollection matchers{};
+        if (prepareQuery(f_query, candidateIndexes, matchers))
+        {
+            for (auto index : candidateIndexes)
+            {
+                if (matchesAll(matchers, m_records[index]))
+                {
+                    f_output.addRecord(index);
+                }
+            }
+            return;
+        }
+
+        markMatchingRecords([&](size_t index) {
+            return matchesAll(matchers, m_records[index]);
+        }, f_output);
+    }
+
+    DbRecordCursor InMemoryDb::openCursor(const DbQuery& f_query, size_t f_limit) const
+    {
+        DbRecordIndexesCollection candidateIndexes{};
+        DbTableTestMatchersCollection matchers{};
+        bool hasCandidates = prepareQuery(f_query, candidateIndexes, matchers);
+        return DbRecordCursor{ m_records, std::move(matchers), std::move(candidateIndexes), hasCandidates, f_limit };
+    }
+
+    DbRecordCursor InMemoryDb::openCursor(const std::string& f_columnName, const std::string& f_matchString,
+        size_t f_limit) const
+    {
+        DbQuery query{};
+        query.addPredicate(f_columnName, f_matchString);
+        return openCursor(query, f_limit);
+    }
+
+    const DbTableTest& InMemoryDb::getRecord(size_t f_index) const
+    {
+        return m_records[f_index];
+    }
+
+    const DbTableTest* InMemoryDb::findById(uint64_t f_id) const
+    {
+        auto foundIndexIter = m_idIndex.find(f_id);
+        if (foundIndexIter != m_idIndex.end())
+        {
+            return &m_records[foundIndexIter->second];
+        }
+        return nullptr;
     }
 
-    void InMemoryDb::deleteRecordByID(uint32_t f_id)
+    bool InMemoryDb::deleteRecordByID(uint32_t f_id)
     {
-        DbTableTest emptyElement{};
-        // Look for a record with the matching ID and once found, replace it with empty record. Stop any further processing of the records
-        auto foundRecordIter = std::find_if(m_records.begin(), m_records.end(), [&](const DbTableTest& rec) {
-            return rec.id == f_id; });
-        if (foundRecordIter != m_records.end())
+        // Look for the position of the record with the matching ID in the primary-key index
+        auto foundIndexIter = m_idIndex.find(f_id);
+        if (foundIndexIter != m_idIndex.end())
         {
-            // Save the index of the deleted record for a later use
-            m_freeIndexes.push(foundRecordIter->id);
+            if (m_writeAheadLog != nullptr)
+            {
+                m_writeAheadLog->appendDelete(f_id);
+                if (!m_writeAheadLog->commit())
+                {
+                    return false;
+                }
+            }
+            markRecordDeleted(foundIndexIter->second);
 
-            // Replace the record that has to be deleted with an empty one
-            *foundRecordIter = emptyElement;
+            // Too many deleted records slow down the searches, so move a few records into their slots
+            if (static_cast<double>(m_numberOfDeletedRecords) > m_compactionThreshold * static_cast<double>(m_records.size()))
+            {
+                compactRecords(cCompactionStepSize);
+            }
         }
+        return true;
     }
 
-    void InMemoryDb::deleteRecordByIDNonOptimized(uint32_t f_id)
+    bool InMemoryDb::deleteRecordByIDNonOptimized(uint32_t f_id)
     {
         // Remove a record with a matching ID from the collection of records
-        auto removeIter = std::remove_if(m_records.begin(), m_records.end(), [&](const DbTableTest& rec) {
+        auto removeIter = std::find_if(m_records.begin(), m_records.end(), [&](const DbTableTest& rec) {
             return rec.id == f_id;
             });
         if (removeIter != m_records.end())
         {
+            if (m_writeAheadLog != nullptr)
+            {
+                m_writeAheadLog->appendDelete(f_id);
+                if (!m_writeAheadLog->commit())
+                {
+                    return false;
+                }
+            }
+            auto removeIndex = static_cast<size_t>(removeIter - m_records.begin());
+            if (m_storageLayout == DbStorageLayout::Column)
+            {
+                m_columns.eraseRecord(removeIndex);
+            }
             m_records.erase(removeIter);
+
+            // All the records after the removed one were shifted, so their positions
+            // and the positions of the free slots have to be updated
+            rebuildIndexes();
         }
+        return true;
+    }
+
+    bool InMemoryDb::addRecord(const DbTableTest& f_newRecord)
+    {
+        // Copy the record only once and move the copy into the database
+        return addRecord(DbTableTest{ f_newRecord });
     }
 
-    void InMemoryDb::addRecord(const DbTableTest& f_newRecord)
+    bool InMemoryDb::addRecord(DbTableTest&& f_newRecord)
     {
-        // Check if we have available slot already
-        if (m_freeIndexes.size() > 0)
+        if (m_writeAheadLog != nullptr)
         {
-            auto freeIndex = m_freeIndexes.front();
-            m_freeIndexes.pop();
-            // Check just in case that we haven't gotten any wrong index out of bounds
-            if (freeIndex < m_records.size())
+            m_writeAheadLog->appendAdd(f_newRecord);
+            if (!m_writeAheadLog->commit())
             {
-                // Replace an existing free slot with the new record
-                m_records.at(freeIndex) = f_newRecord;
+                return false;
             }
-            // If the index was wrong, place the new record at the end of the collection
-            else
+        }
+
+        // Check if we have available slot already. The most recently freed one is taken first.
+        size_t newIndex = m_records.size();
+        if (takeFreeSlot(newIndex))
+        {
+            --m_numberOfDeletedRecords;
+        }
+
+        // Keep the columns in sync with the records. The free slot, if any, is the same in both.
+        if (newIndex < m_records.size())
+        {
+            // Replace an existing free slot with the new record
+            m_records[newIndex] = std::move(f_newRecord);
+            if (m_storageLayout == DbStorageLayout::Column)
             {
-                m_records.emplace_back(f_newRecord);
+                m_columns.setRecord(newIndex, m_records[newIndex]);
             }
         }
         else
         {
             // No free slots available, push the record at the end
-            m_records.emplace_back(f_newRecord);
+            m_records.emplace_back(std::move(f_newRecord));
+            if (m_storageLayout == DbStorageLayout::Column)
+            {
+                m_columns.appendRecord(m_records.back());
+            }
+        }
+        addToIndexes(newIndex);
+        return true;
+    }
+
+    bool InMemoryDb::deleteRecordsByIds(const DbRecordIdsCollection& f_ids)
+    {
+        // All the deletions are one commit, which has to succeed before any record is deleted
+        if (m_writeAheadLog != nullptr)
+        {
+            for (auto id : f_ids)
+            {
+                if (m_idIndex.find(id) != m_idIndex.end())
+                {
+                    m_writeAheadLog->appendDelete(id);
+                }
+            }
+            if (!m_writeAheadLog->commit())
+            {
+                return false;
+            }
+        }
+
+        for (auto id : f_ids)
+        {
+            auto foundIndexIter = m_idIndex.find(id);
+            if (foundIndexIter != m_idIndex.end())
+            {
+                markRecordDeleted(foundIndexIter->second);
+            }
+        }
+
+        // Compact all the deleted records at once instead of step by step
+        if (static_cast<double>(m_numberOfDeletedRecords) > m_compactionThreshold * static_cast<double>(m_records.size()))
+        {
+            compactRecords(m_records.size());
+        }
+        return true;
+    }
+
+    bool InMemoryDb::addRecords(DbTestRecordCollection&& f_newRecords)
+    {
+        // All the additions are one commit
+        if (m_writeAheadLog != nullptr)
+        {
+            for (const auto& newRecord : f_newRecords)
+            {
+                m_writeAheadLog->appendAdd(newRecord);
+            }
+            if (!m_writeAheadLog->commit())
+            {
+                return false;
+            }
+        }
+
+        // Fill the free slots first, the same way as when adding the records one by one
+        auto newRecordIter = f_newRecords.begin();
+        size_t freeSlot{ 0 };
+        while (newRecordIter != f_newRecords.end() && takeFreeSlot(freeSlot))
+        {
+            --m_numberOfDeletedRecords;
+            m_records[freeSlot] = std::move(*newRecordIter);
+            if (m_storageLayout == DbStorageLayout::Column)
+            {
+                m_columns.setRecord(freeSlot, m_records[freeSlot]);
+            }
+            addToIndexes(freeSlot);
+            ++newRecordIter;
+        }
+
+        // Reserve the memory for the rest of the records only once
+        size_t firstNewIndex = m_records.size();
+        size_t numberOfRecords = firstNewIndex + static_cast<size_t>(f_newRecords.end() - newRecordIter);
+        m_records.reserve(numberOfRecords);
+        m_idIndex.reserve(numberOfRecords);
+        m_records.insert(m_records.end(), std::make_move_iterator(newRecordIter), std::make_move_iterator(f_newRecords.end()));
+        if (m_storageLayout == DbStorageLayout::Column)
+        {
+            m_columns.reserve(numberOfRecords);
+        }
+        for (size_t index = firstNewIndex; index < numberOfRecords; ++index)
+        {
+            if (m_storageLayout == DbStorageLayout::Column)
+            {
+                m_columns.appendRecord(m_records[index]);
+            }
+            addToIndexes(index);
         }
+        f_newRecords.clear();
+        return true;
+    }
+
+    bool InMemoryDb::addRecords(const DbTestRecordCollection& f_newRecords)
+    {
+        return addRecords(DbTestRecordCollection{ f_newRecords });
     }
 
     uint64_t InMemoryDb::getNumberOfDeletedRecords() const
     {
-        return m_freeIndexes.size();
+        return m_numberOfDeletedRecords;
     }
 
     uint64_t InMemoryDb::getNumberOfRecords() const
     {
-        return m_records.size() - m_freeIndexes.size();
+        return m_records.size() - m_numberOfDeletedRecords;
+    }
+
+    void InMemoryDb::compact()
+    {
+        compactRecords(m_records.size());
+        m_records.shrink_to_fit();
+    }
+
+    bool InMemoryDb::saveSnapshot(const std::string& f_path) const
+    {
+        // The previous file might be mapped by the columns of this database while the searches read them,
+        // so it is never rewritten in place. The new file is written aside and then renamed over it.
+        std::string temporaryPath = f_path + ".tmp";
+        if (!DbSnapshot::write(temporaryPath, m_records))
+        {
+            std::error_code error{};
+            std::filesystem::remove(temporaryPath, error);
+            return false;
+        }
+        return DbSnapshot::replace(temporaryPath, f_path);
+    }
+
+    bool InMemoryDb::loadSnapshot(const std::string& f_path)
+    {
+        auto snapshot = std::make_unique<DbSnapshot>();
+        DbTestRecordCollection records{};
+        if (!snapshot->open(f_path) || !snapshot->readRecords(records))
+        {
+            return false;
+        }
+
+        m_records = std::move(records);
+        rebuildIndexes();
+        if (m_storageLayout == DbStorageLayout::Column)
+        {
+            // The columns stop using the previous snapshot before it is unmapped
+            m_columns.mapSnapshot(*snapshot);
+            m_snapshot = std::move(snapshot);
+        }
+        return true;
+    }
+
+    bool InMemoryDb::enableWriteAheadLog(const std::string& f_path, DbWalSyncPolicy f_syncPolicy, uint32_t f_groupSize)
+    {
+        auto writeAheadLog = std::make_unique<DbWriteAheadLog>();
+        if (!writeAheadLog->open(f_path, f_syncPolicy, f_groupSize))
+        {
+            return false;
+        }
+        m_writeAheadLog = std::move(writeAheadLog);
+        return true;
+    }
+
+    bool InMemoryDb::hasWriteAheadLog() const
+    {
+        return m_writeAheadLog != nullptr;
+    }
+
+    bool InMemoryDb::syncWriteAheadLog()
+    {
+        return m_writeAheadLog != nullptr && m_writeAheadLog->sync();
+    }
+
+    bool InMemoryDb::replayWriteAheadLog(const std::string& f_path)
+    {
+        DbWalEntriesCollection entries{};
+        if (!DbWriteAheadLog::readEntries(f_path, entries))
+        {
+            return false;
+        }
+
+        // The replayed mutations are already in the log, so they are applied without logging them
+        auto writeAheadLog = std::move(m_writeAheadLog);
+        for (auto& entry : entries)
+        {
+            if (entry.type == DbWalEntryType::Delete)
+            {
+                deleteRecordByID(static_cast<uint32_t>(entry.record.id));
+            }
+            else if (m_idIndex.find(entry.record.id) == m_idIndex.end())
+            {
+                addRecord(std::move(entry.record));
+            }
+        }
+        m_writeAheadLog = std::move(writeAheadLog);
+        return true;
+    }
+
+    bool InMemoryDb::checkpoint(const std::string& f_snapshotPath)
+    {
+        // Replace the previous snapshot only with a complete one, which is already on the storage device
+        if (!saveSnapshot(f_snapshotPath))
+        {
+            return false;
+        }
+
+        // If the process stops before the log is emptied, replaying it again on the snapshot changes nothing
+        return m_writeAheadLog == nullptr || m_writeAheadLog->truncate();
+    }
+
+    void InMemoryDb::enableQueryCache(size_t f_maximumSize)
+    {
+        m_queryCache = std::make_unique<DbQueryCache>(f_maximumSize);
+    }
+
+    bool InMemoryDb::hasQueryCache() const
+    {
+        return m_queryCache != nullptr;
+    }
+
+    uint64_t InMemoryDb::getNumberOfQueryCacheHits() const
+    {
+        return m_queryCache != nullptr ? m_queryCache->getNumberOfHits() : 0;
+    }
+
+    uint64_t InMemoryDb::getNumberOfQueryCacheMisses() const
+    {
+        return m_queryCache != nullptr ? m_queryCache->getNumberOfMisses() : 0;
+    }
+
+    void InMemoryDb::setCompactionThreshold(double f_tombstoneRatio)
+    {
+        m_compactionThreshold = f_tombstoneRatio;
+    }
+
+    double InMemoryDb::getCompactionThreshold() const
+    {
+        return m_compactionThreshold;
+    }
+
+    DbStorageLayout InMemoryDb::getStorageLayout() const
+    {
+        return m_storageLayout;
+    }
+
+    void InMemoryDb::setNumberOfThreads(uint32_t f_numberOfThreads)
+    {
+        m_numberOfThreads = f_numberOfThreads;
+        if (m_numberOfThreads == 0)
+        {
+            // The number of hardware threads might not be available on every platform
+            m_numberOfThreads = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+    }
+
+    uint32_t InMemoryDb::getNumberOfThreads() const
+    {
+        return m_numberOfThreads;
+    }
+
+    size_t InMemoryDb::getNumberOfPartitions() const
+    {
+        // Every thread shall have enough records to process, so that it is worth starting it
+        return std::max<size_t>(1, std::min<size_t>(m_numberOfThreads, m_records.size() / cMinimumRecordsPerThread));
+    }
+
+    template <typename TScanPartition>
+    void InMemoryDb::runInPartitions(size_t f_numberOfPartitions, size_t f_alignment, TScanPartition f_scanPartition) const
+    {
+        size_t numberOfRecords = m_records.size();
+        size_t partitionSize = (numberOfRecords + f_numberOfPartitions - 1) / f_numberOfPartitions;
+        partitionSize = (partitionSize + f_alignment - 1) / f_alignment * f_alignment;
+
+        std::vector<std::thread> threads{};
+        threads.reserve(f_numberOfPartitions - 1);
+        for (size_t partition = 1; partition < f_numberOfPartitions; ++partition)
+        {
+            size_t begin = std::min(partition * partitionSize, numberOfRecords);
+            size_t end = std::min(begin + partitionSize, numberOfRecords);
+            threads.emplace_back([&f_scanPartition, partition, begin, end]() {
+                f_scanPartition(partition, begin, end);
+            });
+        }
+
+        // The current thread takes care of the first chunk
+        f_scanPartition(0, 0, std::min(partitionSize, numberOfRecords));
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    template <typename TScanChunk>
+    void InMemoryDb::scanInPartitions(TScanChunk f_scanChunk, DbTestRecordPointersCollection& f_output) const
+    {
+        size_t numberOfChunks = getNumberOfPartitions();
+        if (numberOfChunks <= 1)
+        {
+            f_scanChunk(0, m_records.size(), f_output);
+            return;
+        }
+
+        // Each chunk is scanned into a buffer of its own, so that the threads don't need any synchronization
+        std::vector<DbTestRecordPointersCollection> chunkOutputs(numberOfChunks);
+        runInPartitions(numberOfChunks, 1, [&f_scanChunk, &chunkOutputs](size_t f_chunk, size_t f_begin, size_t f_end) {
+            f_scanChunk(f_begin, f_end, chunkOutputs[f_chunk]);
+        });
+
+        // Merge the buffers in the order of the chunks to keep the order of the records
+        size_t numberOfFoundRecords = 0;
+        for (const auto& chunkOutput : chunkOutputs)
+        {
+            numberOfFoundRecords += chunkOutput.size();
+        }
+        f_output.reserve(f_output.size() + numberOfFoundRecords);
+        for (const auto& chunkOutput : chunkOutputs)
+        {
+            f_output.insert(f_output.end(), chunkOutput.begin(), chunkOutput.end());
+        }
+    }
+
+    template <typename TPredicate>
+    void InMemoryDb::collectMatchingRecords(TPredicate f_predicate, DbTestRecordPointersCollection& f_output) const
+    {
+        scanInPartitions([&](size_t f_begin, size_t f_end, DbTestRecordPointersCollection& f_chunkOutput) {
+            for (size_t index = f_begin; index < f_end; ++index)
+            {
+                if (f_predicate(index))
+                {
+                    f_chunkOutput.emplace_back(&m_records[index]);
+                }
+            }
+        }, f_output);
+    }
+
+    template <typename TPredicate>
+    void InMemoryDb::markMatchingRecords(TPredicate f_predicate, DbResultSet& f_output) const
+    {
+        runInPartitions(getNumberOfPartitions(), cRecordsPerResultSetWord, [&](size_t, size_t f_begin, size_t f_end) {
+            for (size_t index = f_begin; index < f_end; ++index)
+            {
+                if (f_predicate(index))
+                {
+                    f_output.addRecord(index);
+                }
+            }
+        });
+    }
+
+    template <typename TValue, typename TScanZone>
+    void InMemoryDb::scanMatchingZones(const DbZoneMap<TValue>& f_zoneMap, TValue f_lowerBound, TValue f_upperBound,
+        TScanZone f_scanZone, DbTestRecordPointersCollection& f_output) const
+    {
+        scanInPartitions([&](size_t f_begin, size_t f_end, DbTestRecordPointersCollection& f_chunkOutput) {
+            f_zoneMap.forEachMatchingZone(f_lowerBound, f_upperBound, f_begin, f_end, [&](size_t f_zoneBegin, size_t f_zoneEnd) {
+                f_scanZone(f_zoneBegin, f_zoneEnd, f_chunkOutput);
+            });
+        }, f_output);
+    }
+
+    bool InMemoryDb::findMatchingRecordsInZones(const std::string& f_columnName,
+        const std::string& f_matchString, DbTestRecordPointersCollection& f_output) const
+    {
+        // The deleted records are not in the zone maps, but they might be inside the bounds of a zone
+        if (f_columnName == "column0")
+        {
+            // Deleted records have ID 0, so they cannot match any other ID
+            uint64_t matchValue = parseColumnValue<uint64_t>(f_matchString);
+            if (matchValue == 0)
+            {
+                return true;
+            }
+            scanMatchingZones(m_idZoneMap, matchValue, matchValue, [&](size_t f_begin, size_t f_end, DbTestRecordPointersCollection& f_zoneOutput) {
+                for (size_t index = f_begin; index < f_end; ++index)
+                {
+                    if (m_records[index].id == matchValue)
+                    {
+                        f_zoneOutput.emplace_back(&m_records[index]);
+                    }
+                }
+            }, f_output);
+            return true;
+        }
+        if (f_columnName == "column2")
+        {
+            int32_t matchValue = parseColumnValue<int32_t>(f_matchString);
+            scanMatchingZones(m_balanceZoneMap, matchValue, matchValue, [&](size_t f_begin, size_t f_end, DbTestRecordPointersCollection& f_zoneOutput) {
+                for (size_t index = f_begin; index < f_end; ++index)
+                {
+                    const auto& rec = m_records[index];
+                    if (rec.balance == matchValue && rec.id != 0)
+                    {
+                        f_zoneOutput.emplace_back(&rec);
+                    }
+                }
+            }, f_output);
+            return true;
+        }
+        return false;
+    }
+
+    void InMemoryDb::findMatchingRecordsInColumns(const std::string& f_columnName,
+        const std::string& f_matchString, DbTestRecordPointersCollection& f_output) const
+    {
+        // This will decrease the execution time by several milliseconds 
+        // but the used memory might be increased unnecessarely.
+        f_output.reserve(m_records.size());
+
+        const auto& ids = m_columns.getIds();
+
+        // Each branch reads only the array of the searched column and the id array
+        // which tells if the record is deleted
+        if (f_columnName == "column0")
+        {
+            // Deleted records have ID 0, so they cannot match any other ID
+            uint64_t matchValue = parseColumnValue<uint64_t>(f_matchString);
+            if (matchValue != 0)
+            {
+                scanMatchingZones(m_idZoneMap, matchValue, matchValue, [&](size_t f_begin, size_t f_end, DbTestRecordPointersCollection& f_chunkOutput) {
+                    DbRecordIndexesCollection matchingIndexes{};
+                    ids.findEqual(m_scanKernels, matchValue, f_begin, f_end, matchingIndexes);
+                    for (auto index : matchingIndexes)
+                    {
+                        f_chunkOutput.emplace_back(&m_records[index]);
+                    }
+                }, f_output);
+            }
+        }
+        else if (f_columnName == "column1")
+        {
+            findMatchingRecordsInStringColumn(m_columns.getNames(), f_matchString, f_output);
+        }
+        else if (f_columnName == "column2")
+        {
+            int32_t matchValue = parseColumnValue<int32_t>(f_matchString);
+            const auto& balances = m_columns.getBalances();
+            scanMatchingZones(m_balanceZoneMap, matchValue, matchValue, [&](size_t f_begin, size_t f_end, DbTestRecordPointersCollection& f_chunkOutput) {
+                DbRecordIndexesCollection matchingIndexes{};
+                balances.findEqual(m_scanKernels, matchValue, f_begin, f_end, matchingIndexes);
+                for (auto index : matchingIndexes)
+                {
+                    if (ids.getValue(index) != 0)
+                    {
+                        f_chunkOutput.emplace_back(&m_records[index]);
+                    }
+                }
+            }, f_output);
+        }
+        else if (f_columnName == "column3")
+        {
+            findMatchingRecordsInStringColumn(m_columns.getAddresses(), f_matchString, f_output);
+        }
+    }
+
+    void InMemoryDb::findMatchingRecordsInStringColumn(const DbStringColumn& f_column,
+        const std::string& f_matchString, DbTestRecordPointersCollection& f_output) const
+    {
+        const auto& ids = m_columns.getIds();
+        DbSubstringSearcher substringSearcher{ f_matchString };
+        if (!f_column.isDictionaryEncoded())
+        {
+            collectMatchingRecords([&](size_t index) {
+                if (ids.getValue(index) == 0)
+                {
+                    return false;
+                }
+                auto value = f_column.getString(index);
+                return substringSearcher.isFoundIn(value.data(), value.size());
+            }, f_output);
+            return;
+        }
+
+        // Search every distinct string once, so that the records are checked only by their code
+        std::vector<uint8_t> isMatchingCode(f_column.getDictionarySize(), 0);
+        bool isAnyCodeMatching{ false };
+        for (uint32_t code = 0; code < isMatchingCode.size(); ++code)
+        {
+            auto value = f_column.getDictionaryString(code);
+            isMatchingCode[code] = substringSearcher.isFoundIn(value.data(), value.size()) ? 1 : 0;
+            isAnyCodeMatching = isAnyCodeMatching || isMatchingCode[code] != 0;
+        }
+        if (!isAnyCodeMatching)
+        {
+            return;
+        }
+
+        const auto& codes = f_column.getCodes();
+        collectMatchingRecords([&](size_t index) {
+            return isMatchingCode[codes[index]] != 0 && ids.getValue(index) != 0;
+        }, f_output);
+    }
+
+    void InMemoryDb::enableTrigramIndex(const std::string& f_columnName)
+    {
+        // Build the index from all the records, which are not deleted
+        if (f_columnName == "column1" && !m_nameTrigramIndex.has_value())
+        {
+            m_nameTrigramIndex.emplace();
+            for (size_t index = 0; index < m_records.size(); ++index)
+            {
+                if (m_records[index].id != 0)
+                {
+                    m_nameTrigramIndex->addString(index, m_records[index].name);
+                }
+            }
+        }
+        else if (f_columnName == "column3" && !m_addressTrigramIndex.has_value())
+        {
+            m_addressTrigramIndex.emplace();
+            for (size_t index = 0; index < m_records.size(); ++index)
+            {
+                if (m_records[index].id != 0)
+                {
+                    m_addressTrigramIndex->addString(index, m_records[index].address);
+                }
+            }
+        }
+    }
+
+    bool InMemoryDb::hasTrigramIndex(const std::string& f_columnName) const
+    {
+        return (f_columnName == "column1" && m_nameTrigramIndex.has_value()) ||
+            (f_columnName == "column3" && m_addressTrigramIndex.has_value());
+    }
+
+    void InMemoryDb::enableDictionaryEncoding(const std::string& f_columnName)
+    {
+        if (m_storageLayout != DbStorageLayout::Column)
+        {
+            return;
+        }
+
+        if (f_columnName == "column1")
+        {
+            m_columns.enableNameDictionaryEncoding();
+        }
+        else if (f_columnName == "column3")
+        {
+            m_columns.enableAddressDictionaryEncoding();
+        }
+    }
+
+    bool InMemoryDb::hasDictionaryEncoding(const std::string& f_columnName) const
+    {
+        return m_storageLayout == DbStorageLayout::Column &&
+            ((f_columnName == "column1" && m_columns.getNames().isDictionaryEncoded()) ||
+            (f_columnName == "column3" && m_columns.getAddresses().isDictionaryEncoded()));
+    }
+
+    void InMemoryDb::enableIntegerCompression(const std::string& f_columnName)
+    {
+        if (m_storageLayout != DbStorageLayout::Column)
+        {
+            return;
+        }
+
+        if (f_columnName == "column0")
+        {
+            m_columns.enableIdCompression();
+        }
+        else if (f_columnName == "column2")
+        {
+            m_columns.enableBalanceCompression();
+        }
+    }
+
+    bool InMemoryDb::hasIntegerCompression(const std::string& f_columnName) const
+    {
+        return m_storageLayout == DbStorageLayout::Column &&
+            ((f_columnName == "column0" && m_columns.getIds().isCompressed()) ||
+            (f_columnName == "column2" && m_columns.getBalances().isCompressed()));
+    }
+
+    bool InMemoryDb::findMatchingIndexesInSecondaryIndexes(const std::string& f_columnName,
+        const std::string& f_matchString, DbRecordIndexesCollection& f_output) const
+    {
+        // The records with an exact balance are a range of the balance index
+        if (f_columnName == "column2" && m_balanceIndex.has_value())
+        {
+            int32_t matchValue = parseColumnValue<int32_t>(f_matchString);
+            m_balanceIndex->findRange(matchValue, matchValue, f_output);
+            return true;
+        }
+
+        if (!hasTrigramIndex(f_columnName))
+        {
+            return false;
+        }
+
+        // Searched strings shorter than a trigram cannot use the index
+        const bool isNameColumn = f_columnName == "column1";
+        const auto& trigramIndex = isNameColumn ? *m_nameTrigramIndex : *m_addressTrigramIndex;
+        DbRecordIndexesCollection candidateIndexes{};
+        if (!trigramIndex.findCandidates(f_matchString, candidateIndexes))
+        {
+            return false;
+        }
+
+        // The candidates contain all the trigrams, but not necessarily in the searched order
+        DbSubstringSearcher substringSearcher{ f_matchString };
+        for (auto index : candidateIndexes)
+        {
+            const auto& rec = m_records[index];
+            if (substringSearcher.isFoundIn(isNameColumn ? rec.name : rec.address))
+            {
+                f_output.emplace_back(index);
+            }
+        }
+        return true;
+    }
+
+    bool InMemoryDb::prepareQuery(const DbQuery& f_query, DbRecordIndexesCollection& f_candidateIndexes,
+        DbTableTestMatchersCollection& f_matchers) const
+    {
+        // Rank the predicates, which can be answered by an index. The lower the rank, the fewer records are expected.
+        const auto& predicates = f_query.getPredicates();
+        const DbQueryPredicate* indexedPredicate{ nullptr };
+        size_t indexedPredicateRank{ 0 };
+        for (const auto& predicate : predicates)
+        {
+            size_t rank{ 0 };
+            if (predicate.columnName == "column0")
+            {
+                rank = 1;
+            }
+            else if (predicate.columnName == "column2" && m_balanceIndex.has_value())
+            {
+                rank = 2;
+            }
+            else if (hasTrigramIndex(predicate.columnName) && predicate.matchString.size() >= 3)
+            {
+                // Longer strings contain more trigrams and so match fewer records
+                rank = std::numeric_limits<size_t>::max() - predicate.matchString.size();
+            }
+            else
+            {
+                continue;
+            }
+
+            if (indexedPredicate == nullptr || rank < indexedPredicateRank)
+            {
+                indexedPredicate = &predicate;
+                indexedPredicateRank = rank;
+            }
+        }
+
+        if (indexedPredicate != nullptr)
+        {
+            if (indexedPredicate->columnName == "column0")
+            {
+                auto foundIndexIter = m_idIndex.find(parseColumnValue<uint64_t>(indexedPredicate->matchString));
+                if (foundIndexIter != m_idIndex.end())
+                {
+                    f_candidateIndexes.emplace_back(foundIndexIter->second);
+                }
+            }
+            else
+            {
+                // The records with an exact balance and the trigram candidates are in the order of the records
+                findMatchingIndexesInSecondaryIndexes(indexedPredicate->columnName,
+                    indexedPredicate->matchString, f_candidateIndexes);
+            }
+        }
+
+        f_matchers.reserve(predicates.size());
+        for (const auto& predicate : predicates)
+        {
+            if (&predicate != indexedPredicate)
+            {
+                f_matchers.emplace_back(predicate.columnName, predicate.matchString);
+            }
+        }
+
+        // Check the cheap predicates first, so that the expensive ones are checked only for the records matching them
+        std::stable_sort(f_matchers.begin(), f_matchers.end(),
+            [](const DbTableTestStringMatcher& f_left, const DbTableTestStringMatcher& f_right) {
+                return f_left.getEvaluationCost() < f_right.getEvaluationCost();
+            });
+        return indexedPredicate != nullptr;
+    }
+
+    void InMemoryDb::appendRecords(const DbRecordIndexesCollection& f_indexes, DbTestRecordPointersCollection& f_output) const
+    {
+        f_output.reserve(f_output.size() + f_indexes.size());
+        for (auto index : f_indexes)
+        {
+            f_output.emplace_back(&m_records[index]);
+        }
+    }
+
+    void InMemoryDb::enableBalanceIndex()
+    {
+        if (m_balanceIndex.has_value())
+        {
+            return;
+        }
+
+        // Build the index at once from all the records, which are not deleted
+        DbBalanceIndexEntriesCollection entries{};
+        entries.reserve(m_records.size());
+        for (size_t index = 0; index < m_records.size(); ++index)
+        {
+            if (m_records[index].id != 0)
+            {
+                entries.push_back({ m_records[index].balance, index });
+            }
+        }
+        m_balanceIndex.emplace();
+        m_balanceIndex->build(std::move(entries));
+    }
+
+    bool InMemoryDb::hasBalanceIndex() const
+    {
+        return m_balanceIndex.has_value();
+    }
+
+    void InMemoryDb::findRecordsByBalanceRange(int32_t f_lowerBound, int32_t f_upperBound, DbTestRecordPointersCollection& f_output) const
+    {
+        if (m_balanceIndex.has_value())
+        {
+            DbRecordIndexesCollection foundIndexes{};
+            m_balanceIndex->findRange(f_lowerBound, f_upperBound, foundIndexes);
+            appendRecords(foundIndexes, f_output);
+            return;
+        }
+
+        // Without the index, check every record which is not deleted
+        if (m_storageLayout == DbStorageLayout::Column)
+        {
+            const auto& ids = m_columns.getIds();
+            const auto& balances = m_columns.getBalances();
+            scanMatchingZones(m_balanceZoneMap, f_lowerBound, f_upperBound, [&](size_t f_begin, size_t f_end, DbTestRecordPointersCollection& f_chunkOutput) {
+                DbRecordIndexesCollection matchingIndexes{};
+                balances.findInRange(f_lowerBound, f_upperBound, f_begin, f_end, matchingIndexes);
+                for (auto index : matchingIndexes)
+                {
+                    if (ids.getValue(index) != 0)
+                    {
+                        f_chunkOutput.emplace_back(&m_records[index]);
+                    }
+                }
+            }, f_output);
+        }
+        else
+        {
+            scanMatchingZones(m_balanceZoneMap, f_lowerBound, f_upperBound, [&](size_t f_begin, size_t f_end, DbTestRecordPointersCollection& f_zoneOutput) {
+                for (size_t index = f_begin; index < f_end; ++index)
+                {
+                    const auto& rec = m_records[index];
+                    if (rec.balance >= f_lowerBound && rec.balance <= f_upperBound && rec.id != 0)
+                    {
+                        f_zoneOutput.emplace_back(&rec);
+                    }
+                }
+            }, f_output);
+        }
+    }
+
+    void InMemoryDb::findTopRecords(const DbQuery& f_query, const std::string& f_orderColumnName, DbSortOrder f_sortOrder,
+        size_t f_limit, DbTestRecordPointersCollection& f_output) const
+    {
+        if (f_limit == 0)
+        {
+            return;
+        }
+
+        DbRecordIndexesCollection candidateIndexes{};
+        DbTableTestMatchersCollection matchers{};
+        bool hasCandidates = prepareQuery(f_query, candidateIndexes, matchers);
+        bool isDescending = f_sortOrder == DbSortOrder::Descending;
+
+        // The balance index is already in the requested order, so only the first matching records are checked
+        if (!hasCandidates && m_balanceIndex.has_value() && f_orderColumnName == "column2")
+        {
+            size_t numberOfFoundRecords{ 0 };
+            m_balanceIndex->forEachEntry(isDescending, [&](const DbBalanceIndexEntry& f_entry) {
+                const auto& rec = m_records[f_entry.index];
+                if (matchesAll(matchers, rec))
+                {
+                    f_output.emplace_back(&rec);
+                    ++numberOfFoundRecords;
+                }
+                return numberOfFoundRecords < f_limit;
+            });
+            return;
+        }
+
+        DbTableTestColumns::visitColumn(f_orderColumnName, [&](auto f_column) {
+            typedef decltype(f_column) TColumn;
+
+            // A record is before another one in the ascending order by value and then by position
+            auto isAscendingBefore = [&](size_t f_first, size_t f_second) {
+                const auto& firstValue = TColumn::getValue(m_records[f_first]);
+                const auto& secondValue = TColumn::getValue(m_records[f_second]);
+                return firstValue < secondValue || (!(secondValue < firstValue) && f_first < f_second);
+            };
+            auto isBefore = [&](size_t f_first, size_t f_second) {
+                return isDescending ? isAscendingBefore(f_second, f_first) : isAscendingBefore(f_first, f_second);
+            };
+
+            // The heap keeps the best records found so far with the last of them on top
+            DbRecordIndexesCollection heap{};
+            heap.reserve(std::min(f_limit, m_records.size()));
+            auto offerRecord = [&](size_t f_index) {
+                if (!matchesAll(matchers, m_records[f_index]))
+                {
+                    return;
+                }
+                if (heap.size() < f_limit)
+                {
+                    heap.emplace_back(f_index);
+                    std::push_heap(heap.begin(), heap.end(), isBefore);
+                }
+                else if (isBefore(f_index, heap.front()))
+                {
+                    std::pop_heap(heap.begin(), heap.end(), isBefore);
+                    heap.back() = f_index;
+                    std::push_heap(heap.begin(), heap.end(), isBefore);
+                }
+            };
+
+            if (hasCandidates)
+            {
+                std::for_each(candidateIndexes.begin(), candidateIndexes.end(), offerRecord);
+            }
+            else
+            {
+                for (size_t index = 0; index < m_records.size(); ++index)
+                {
+                    offerRecord(index);
+                }
+            }
+
+            std::sort_heap(heap.begin(), heap.end(), isBefore);
+            appendRecords(heap, f_output);
+        });
+    }
+
+    bool InMemoryDb::aggregate(const DbQuery& f_query, const std::string& f_valueColumnName, DbAggregate& f_output) const
+    {
+        bool isAggregated{ false };
+        DbTableTestColumns::visitColumn(f_valueColumnName, [&](auto f_valueColumn) {
+            typedef decltype(f_valueColumn) TValueColumn;
+            if constexpr (std::is_integral<typename TValueColumn::ValueType>::value)
+            {
+                isAggregated = true;
+                DbRecordIndexesCollection candidateIndexes{};
+                DbTableTestMatchersCollection matchers{};
+                if (prepareQuery(f_query, candidateIndexes, matchers))
+                {
+                    for (auto index : candidateIndexes)
+                    {
+                        const auto& rec = m_records[index];
+                        if (matchesAll(matchers, rec))
+                        {
+                            f_output.addValue(static_cast<int64_t>(TValueColumn::getValue(rec)));
+                        }
+                    }
+                    return;
+                }
+
+                // Without predicates the balance array is aggregated directly, masking the deleted records by their ID
+                const int32_t* balances = m_columns.getBalances().getPlainValues();
+                const uint64_t* ids = m_columns.getIds().getPlainValues();
+                bool isVectorized = matchers.empty() && m_storageLayout == DbStorageLayout::Column &&
+                    f_valueColumnName == "column2" && balances != nullptr && ids != nullptr;
+
+                // Every chunk has its own partial aggregate, so that the threads don't need any synchronization
+                size_t numberOfPartitions = getNumberOfPartitions();
+                std::vector<DbAggregate> partialAggregates(numberOfPartitions);
+                runInPartitions(numberOfPartitions, 1, [&](size_t f_partition, size_t f_begin, size_t f_end) {
+                    DbAggregate partialAggregate{};
+                    if (isVectorized)
+                    {
+                        m_scanKernels.aggregate(balances + f_begin, ids + f_begin, f_end - f_begin, partialAggregate);
+                    }
+                    else
+                    {
+                        for (size_t index = f_begin; index < f_end; ++index)
+                        {
+                            const auto& rec = m_records[index];
+                            if (matchesAll(matchers, rec))
+                            {
+                                partialAggregate.addValue(static_cast<int64_t>(TValueColumn::getValue(rec)));
+                            }
+                        }
+                    }
+                    partialAggregates[f_partition] = partialAggregate;
+                });
+                for (const auto& partialAggregate : partialAggregates)
+                {
+                    f_output.merge(partialAggregate);
+                }
+            }
+        });
+        return isAggregated;
+    }
+
+    bool InMemoryDb::aggregateByGroup(const DbQuery& f_query, const std::string& f_groupColumnName,
+        const std::string& f_valueColumnName, DbAggregateGroupsCollection& f_output) const
+    {
+        bool isAggregated{ false };
+        DbTableTestColumns::visitColumn(f_valueColumnName, [&](auto f_valueColumn) {
+            typedef decltype(f_valueColumn) TValueColumn;
+            if constexpr (std::is_integral<typename TValueColumn::ValueType>::value)
+            {
+                isAggregated = true;
+                DbTableTestColumns::visitColumn(f_groupColumnName, [&](auto f_groupColumn) {
+                    typedef decltype(f_groupColumn) TGroupColumn;
+                    typedef typename TGroupColumn::ValueType TGroupValue;
+                    // The strings are keyed by views of the records, which don't change during the search
+                    typedef std::conditional_t<std::is_integral<TGroupValue>::value, TGroupValue, std::string_view> TGroupKey;
+                    typedef std::unordered_map<TGroupKey, DbAggregate> TGroupsCollection;
+
+                    DbRecordIndexesCollection candidateIndexes{};
+                    DbTableTestMatchersCollection matchers{};
+                    bool hasCandidates = prepareQuery(f_query, candidateIndexes, matchers);
+
+                    // Every chunk has its own hash table, so that the threads don't need any synchronization
+                    size_t numberOfPartitions = hasCandidates ? 1 : getNumberOfPartitions();
+                    std::vector<TGroupsCollection> partialGroups(numberOfPartitions);
+                    auto aggregateRecord = [&](TGroupsCollection& f_groups, const DbTableTest& f_record) {
+                        if (matchesAll(matchers, f_record))
+                        {
+                            f_groups[TGroupKey{ TGroupColumn::getValue(f_record) }].addValue(
+                                static_cast<int64_t>(TValueColumn::getValue(f_record)));
+                        }
+                    };
+                    if (hasCandidates)
+                    {
+                        for (auto index : candidateIndexes)
+                        {
+                            aggregateRecord(partialGroups.front(), m_records[index]);
+                        }
+                    }
+                    else
+                    {
+                        runInPartitions(numberOfPartitions, 1, [&](size_t f_partition, size_t f_begin, size_t f_end) {
+                            for (size_t index = f_begin; index < f_end; ++index)
+                            {
+                                aggregateRecord(partialGroups[f_partition], m_records[index]);
+                            }
+                        });
+                    }
+
+                    for (const auto& groups : partialGroups)
+                    {
+                        for (const auto& group : groups)
+                        {
+                            f_output[toGroupKey(group.first)].merge(group.second);
+                        }
+                    }
+                });
+            }
+        });
+        return isAggregated;
+    }
+
+    void InMemoryDb::addToIndexes(size_t f_index)
+    {
+        // Every modification of the records passes through the indexes
+        ++m_recordsVersion;
+        const auto& rec = m_records[f_index];
+        m_idIndex[rec.id] = f_index;
+        m_idZoneMap.addValue(f_index, rec.id);
+        m_balanceZoneMap.addValue(f_index, rec.balance);
+        if (m_nameTrigramIndex.has_value())
+        {
+            m_nameTrigramIndex->addString(f_index, rec.name);
+        }
+        if (m_addressTrigramIndex.has_value())
+        {
+            m_addressTrigramIndex->addString(f_index, rec.address);
+        }
+        if (m_balanceIndex.has_value())
+        {
+            m_balanceIndex->addEntry(rec.balance, f_index);
+        }
+    }
+
+    void InMemoryDb::removeFromIndexes(size_t f_index)
+    {
+        ++m_recordsVersion;
+        const auto& rec = m_records[f_index];
+        m_idIndex.erase(rec.id);
+        if (m_nameTrigramIndex.has_value())
+        {
+            m_nameTrigramIndex->removeString(f_index, rec.name);
+        }
+        if (m_addressTrigramIndex.has_value())
+        {
+            m_addressTrigramIndex->removeString(f_index, rec.address);
+        }
+        if (m_balanceIndex.has_value())
+        {
+            m_balanceIndex->removeEntry(rec.balance, f_index);
+        }
+
+        // Both zone maps count the same records, so they ask for a rebuild at the same time
+        bool isIdZoneToRebuild = m_idZoneMap.removeValue(f_index);
+        bool isBalanceZoneToRebuild = m_balanceZoneMap.removeValue(f_index);
+        if (isIdZoneToRebuild || isBalanceZoneToRebuild)
+        {
+            rebuildZone(f_index);
+        }
+    }
+
+    void InMemoryDb::rebuildZone(size_t f_removedIndex)
+    {
+        m_idZoneMap.resetZone(f_removedIndex);
+        m_balanceZoneMap.resetZone(f_removedIndex);
+        size_t zoneBegin = f_removedIndex - f_removedIndex % DbZoneMap<uint64_t>::cRecordsPerZone;
+        size_t zoneEnd = std::min(zoneBegin + DbZoneMap<uint64_t>::cRecordsPerZone, m_records.size());
+        for (size_t index = zoneBegin; index < zoneEnd; ++index)
+        {
+            if (index != f_removedIndex && m_records[index].id != 0)
+            {
+                m_idZoneMap.addValue(index, m_records[index].id);
+                m_balanceZoneMap.addValue(index, m_records[index].balance);
+            }
+        }
+    }
+
+    void InMemoryDb::rebuildIndexes()
+    {
+        ++m_recordsVersion;
+        m_freeSlots.clear();
+        m_numberOfDeletedRecords = 0;
+        m_idIndex.clear();
+        m_idIndex.reserve(m_records.size());
+        m_idZoneMap.clear();
+        m_balanceZoneMap.clear();
+        if (m_nameTrigramIndex.has_value())
+        {
+            m_nameTrigramIndex->clear();
+        }
+        if (m_addressTrigramIndex.has_value())
+        {
+            m_addressTrigramIndex->clear();
+        }
+        if (m_balanceIndex.has_value())
+        {
+            m_balanceIndex->clear();
+        }
+
+        for (size_t index = 0; index < m_records.size(); ++index)
+        {
+            // Deleted records have ID 0 and shall not be found by any index
+            if (m_records[index].id != 0)
+            {
+                addToIndexes(index);
+            }
+            else
+            {
+                m_freeSlots.push_back(index);
+                ++m_numberOfDeletedRecords;
+            }
+        }
+    }
+
+    void InMemoryDb::markRecordDeleted(size_t f_index)
+    {
+        removeFromIndexes(f_index);
+
+        // Save the index of the deleted record for a later use
+        m_freeSlots.push_back(f_index);
+        ++m_numberOfDeletedRecords;
+
+        // Replace the record that has to be deleted with an empty one
+        m_records[f_index] = DbTableTest{};
+        if (m_storageLayout == DbStorageLayout::Column)
+        {
+            m_columns.deleteRecord(f_index);
+        }
+    }
+
+    bool InMemoryDb::takeFreeSlot(size_t& f_slot)
+    {
+        while (!m_freeSlots.empty())
+        {
+            auto freeSlot = m_freeSlots.back();
+            m_freeSlots.pop_back();
+            // The compaction doesn't search the stack for the slots it removes or fills, so skip them here
+            if (freeSlot < m_records.size() && m_records[freeSlot].id == 0)
+            {
+                f_slot = freeSlot;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void InMemoryDb::compactRecords(size_t f_maximumRelocations)
+    {
+        size_t initialNumberOfRecords = m_records.size();
+        size_t numberOfRelocations{ 0 };
+        while (m_numberOfDeletedRecords > 0)
+        {
+            // Deleted records at the end are simply dropped
+            while (!m_records.empty() && m_records.back().id == 0)
+            {
+                removeLastRecord();
+                --m_numberOfDeletedRecords;
+            }
+
+            size_t freeSlot{ 0 };
+            if (numberOfRelocations == f_maximumRelocations || !takeFreeSlot(freeSlot))
+            {
+                break;
+            }
+
+            // Move the last record, which is not deleted, into the free slot
+            auto lastIndex = m_records.size() - 1;
+            removeFromIndexes(lastIndex);
+            m_records[freeSlot] = std::move(m_records[lastIndex]);
+            if (m_storageLayout == DbStorageLayout::Column)
+            {
+                m_columns.setRecord(freeSlot, m_records[freeSlot]);
+            }
+            removeLastRecord();
+            --m_numberOfDeletedRecords;
+            addToIndexes(freeSlot);
+            ++numberOfRelocations;
+        }
+
+        // The remaining entries refer only to slots, which don't exist or are used again
+        if (m_numberOfDeletedRecords == 0)
+        {
+            m_freeSlots.clear();
+        }
+        else if (m_records.size() < initialNumberOfRecords)
+        {
+            // The dropped slots would be found again, once new records are added at their positions and deleted
+            m_freeSlots.erase(std::remove_if(m_freeSlots.begin(), m_freeSlots.end(), [&](size_t freeSlot) {
+                return freeSlot >= m_records.size();
+                }), m_freeSlots.end());
+        }
+    }
+
+    void InMemoryDb::removeLastRecord()
+    {
+        m_records.pop_back();
+        if (m_storageLayout == DbStorageLayout::Column)
+        {
+            m_columns.eraseRecord(m_records.size());
+        }
     }
-} /// namespace xq
\ No newline at end of file
+} /// namespace xq
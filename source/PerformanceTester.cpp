@@ -8,19 +8,46 @@
 /// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
 /// @license No license required at all. Use it as you wish.
 
+#include "AllocationMeasurement.hpp"
+#include "ConcurrentInMemoryDb.hpp"
+#include "DbScanKernels.hpp"
+#include "DbSnapshot.hpp"
 #include "InMemoryDb.hpp"
 #include "PerformanceTester.hpp"
+#include "ShardedInMemoryDb.hpp"
 #include "TimeMeasurement.hpp"
 
 #include <algorithm>
 #include <assert.h>
+#include <atomic>
+#include <filesystem>
 #include <iostream>
 #include <iterator>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
 
 using namespace std::chrono;
 
 namespace xq
 {
+    // The number of reader threads of the concurrency test
+    constexpr uint32_t const cNumberOfConcurrentReaders{ 4 };
+    // The number of lookups of every reader of the concurrency test
+    constexpr uint64_t const cNumberOfConcurrentLookups{ 500000 };
+    // The number of added and then deleted records of the writer of the concurrency test
+    constexpr uint64_t const cNumberOfConcurrentWrites{ 20000 };
+    // The numbers of writer threads of the sharding test
+    constexpr uint32_t const cNumberOfShardingWriterThreads[]{ 1, 2, 4, 8 };
+    // The number of shards of the sharding test
+    constexpr uint32_t const cNumberOfShards{ 8 };
+    // The number of records fetched at once from a cursor
+    constexpr size_t const cCursorBatchSize{ 1024 };
+    // The number of records found by the Top-K test
+    constexpr size_t const cNumberOfTopRecords{ 100 };
+    // The number of times the same searches are repeated by the query cache test
+    constexpr uint32_t const cNumberOfRepeatedSearches{ 20 };
+
     void PerformanceTester::measureFindMatchingRecordsPerformanceOneRecord(uint64_t f_numberOfRecords) const
     {
         auto testData = generateTestData("testdata", f_numberOfRecords);
@@ -141,14 +168,1218 @@ namespace xq
         assert(database.getNumberOfRecords() == f_numberOfRecords + 1);
     }
 
+    void PerformanceTester::measureFindRecordByIdPerformance(uint64_t f_numberOfRecords, uint32_t f_id) const
+    {
+        auto testData = generateTestData("testdata", f_numberOfRecords);
+        std::cout << "Test data generated\n";
+
+        // Test traversing all the records in search for the ID
+        TimeMeasurement timer{};
+        InMemoryDb database{ testData };
+        DbTestRecordPointersCollection resultCollection{};
+        timer.startTimer();
+        database.findMatchingRecords("column0", std::to_string(f_id), resultCollection);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFindMatchingRecordsById");
+        timer.printTimeInSeconds("AKFindMatchingRecordsById");
+        timer.resetTimer();
+
+        // Test the lookup in the primary-key index
+        timer.startTimer();
+        auto foundRecord = database.findById(f_id);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFindById");
+        timer.printTimeInSeconds("AKFindById");
+        timer.resetTimer();
+
+        // Make sure that both return the same record
+        assert(resultCollection.size() == 1);
+        assert(foundRecord == resultCollection.at(0));
+        (void)foundRecord;
+    }
+
+    void PerformanceTester::measureStorageLayoutPerformance(uint64_t f_numberOfRecords) const
+    {
+        auto testData = generateTestData("testdata", f_numberOfRecords);
+        std::cout << "Test data generated\n";
+
+        auto numberOfRowRecords = measureFindMatchingRecordsWithLayout(testData, DbStorageLayout::Row, "Row");
+        auto numberOfColumnRecords = measureFindMatchingRecordsWithLayout(testData, DbStorageLayout::Column, "Column");
+
+        // Make sure that both layouts find the same records
+        assert(numberOfRowRecords == numberOfColumnRecords);
+        (void)numberOfRowRecords;
+        (void)numberOfColumnRecords;
+    }
+
+    uint64_t PerformanceTester::measureFindMatchingRecordsWithLayout(const DbTestRecordCollection& f_testData,
+        DbStorageLayout f_storageLayout, const std::string& f_layoutName) const
+    {
+        TimeMeasurement timer{};
+        InMemoryDb database{ f_testData, f_storageLayout };
+        DbTestRecordPointersCollection balanceCollection{};
+        DbTestRecordPointersCollection idCollection{};
+        DbTestRecordPointersCollection nameCollection{};
+
+        timer.startTimer();
+        database.findMatchingRecordsOptimized("column2", "24", balanceCollection);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFindMatchingRecords" + f_layoutName + "Balance");
+        timer.resetTimer();
+
+        // The generic algorithm traverses the id column instead of using the primary-key index
+        timer.startTimer();
+        database.findMatchingRecords("column0", std::to_string(f_testData.size() / 2), idCollection);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFindMatchingRecords" + f_layoutName + "Id");
+        timer.resetTimer();
+
+        timer.startTimer();
+        database.findMatchingRecordsOptimized("column1", "testdata", nameCollection);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFindMatchingRecords" + f_layoutName + "Name");
+        timer.resetTimer();
+
+        return balanceCollection.size() + idCollection.size() + nameCollection.size();
+    }
+
+    void PerformanceTester::measureScanKernelsPerformance(uint64_t f_numberOfRecords) const
+    {
+        std::vector<uint64_t> ids{};
+        std::vector<int32_t> balances{};
+        ids.reserve(f_numberOfRecords);
+        balances.reserve(f_numberOfRecords);
+        for (uint64_t i = 1; i <= f_numberOfRecords; ++i)
+        {
+            ids.emplace_back(i);
+            balances.emplace_back(static_cast<int32_t>(i % 100));
+        }
+        std::cout << "Test data generated\n";
+
+        const std::pair<DbScanKernelType, std::string> kernels[] = {
+            { DbScanKernelType::Scalar, "Scalar" },
+            { DbScanKernelType::Sse42, "Sse42" },
+            { DbScanKernelType::Avx2, "Avx2" } };
+
+        TimeMeasurement timer{};
+        for (const auto& kernel : kernels)
+        {
+            if (!DbScanKernels::isKernelSupported(kernel.first))
+            {
+                std::cout << "The scan kernel " << kernel.second << " is not supported\n";
+                continue;
+            }
+
+            DbScanKernels scanKernels{ kernel.first };
+            DbRecordIndexesCollection idIndexes{};
+            DbRecordIndexesCollection balanceIndexes{};
+
+            timer.startTimer();
+            scanKernels.findEqual(ids.data(), ids.size(), f_numberOfRecords / 2, idIndexes);
+            timer.stopTimer();
+            timer.printTimeInMilliseconds("AKScanKernel" + kernel.second + "Id");
+            timer.resetTimer();
+
+            timer.startTimer();
+            scanKernels.findEqual(balances.data(), balances.size(), 24, balanceIndexes);
+            timer.stopTimer();
+            timer.printTimeInMilliseconds("AKScanKernel" + kernel.second + "Balance");
+            timer.resetTimer();
+
+            // Make sure that every kernel finds the same values
+            assert(idIndexes.size() == 1);
+            assert(balanceIndexes.size() == f_numberOfRecords / 100);
+        }
+    }
+
+    void PerformanceTester::measureFindMatchingRecordsParallelPerformance(uint64_t f_numberOfRecords, uint32_t f_numberOfThreads) const
+    {
+        auto testData = generateTestData("testdata", f_numberOfRecords);
+        std::cout << "Test data generated\n";
+
+        // Test with a single thread
+        TimeMeasurement timer{};
+        InMemoryDb database{ testData };
+        DbTestRecordPointersCollection serialCollection{};
+        timer.startTimer();
+        database.findMatchingRecords("column1", "testdata", serialCollection);
+        database.findMatchingRecords("column3", "99", serialCollection);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFindMatchingRecords1Thread");
+        timer.resetTimer();
+
+        // Test with the given number of threads
+        database.setNumberOfThreads(f_numberOfThreads);
+        DbTestRecordPointersCollection parallelCollection{};
+        timer.startTimer();
+        database.findMatchingRecords("column1", "testdata", parallelCollection);
+        database.findMatchingRecords("column3", "99", parallelCollection);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFindMatchingRecords" + std::to_string(f_numberOfThreads) + "Threads");
+        timer.resetTimer();
+
+        // Make sure that the threads find the same records in the same order
+        assert(serialCollection == parallelCollection);
+    }
+
+    void PerformanceTester::measureTrigramIndexPerformance(uint64_t f_numberOfRecords) const
+    {
+        auto testData = generateTestData("testdata", f_numberOfRecords);
+        std::cout << "Test data generated\n";
+
+        // Set the search string to be unique
+        auto searchString = "testdata" + std::to_string(f_numberOfRecords / 2);
+
+        // Test traversing all the records
+        TimeMeasurement timer{};
+        InMemoryDb database{ testData };
+        DbTestRecordPointersCollection scanCollection{};
+        timer.startTimer();
+        database.findMatchingRecords("column1", searchString, scanCollection);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFindMatchingRecordsScan");
+        timer.resetTimer();
+
+        // Test building the index and searching with it
+        timer.startTimer();
+        database.enableTrigramIndex("column1");
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKEnableTrigramIndex");
+        timer.resetTimer();
+
+        DbTestRecordPointersCollection indexCollection{};
+        timer.startTimer();
+        database.findMatchingRecords("column1", searchString, indexCollection);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFindMatchingRecordsTrigramIndex");
+        timer.printTimeInSeconds("AKFindMatchingRecordsTrigramIndex");
+        timer.resetTimer();
+
+        // Make sure that the function is correct
+        assert(scanCollection.size() == 1);
+        assert(scanCollection == indexCollection);
+    }
+
+    void PerformanceTester::measureBalanceRangePerformance(uint64_t f_numberOfRecords) const
+    {
+        auto testData = generateTestData("testdata", f_numberOfRecords);
+        std::cout << "Test data generated\n";
+
+        // The generated balances are between 0 and 99, so search for a narrow range of them
+        constexpr int32_t lowerBound{ 10 };
+        constexpr int32_t upperBound{ 11 };
+
+        // Test traversing all the records
+        TimeMeasurement timer{};
+        InMemoryDb database{ testData };
+        DbTestRecordPointersCollection scanCollection{};
+        timer.startTimer();
+        database.findRecordsByBalanceRange(lowerBound, upperBound, scanCollection);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFindRecordsByBalanceRangeScan");
+        timer.resetTimer();
+
+        // Test building the index and searching with it
+        timer.startTimer();
+        database.enableBalanceIndex();
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKEnableBalanceIndex");
+        timer.resetTimer();
+
+        DbTestRecordPointersCollection indexCollection{};
+        timer.startTimer();
+        database.findRecordsByBalanceRange(lowerBound, upperBound, indexCollection);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFindRecordsByBalanceRangeIndex");
+        timer.resetTimer();
+
+        // Make sure that the function is correct. The index returns the records ordered by balance.
+        assert(scanCollection.size() == indexCollection.size());
+        assert(std::is_permutation(scanCollection.begin(), scanCollection.end(), indexCollection.begin()));
+    }
+
+    void PerformanceTester::measureResultSetPerformance(uint64_t f_numberOfRecords) const
+    {
+        auto testData = generateTestData("testdata", f_numberOfRecords);
+        std::cout << "Test data generated\n";
+
+        // Test combining two searches with collections of pointers to the records
+        TimeMeasurement timer{};
+        InMemoryDb database{ testData };
+        DbTestRecordPointersCollection nameCollection{};
+        DbTestRecordPointersCollection balanceCollection{};
+        DbTestRecordPointersCollection andCollection{};
+        timer.startTimer();
+        database.findMatchingRecords("column1", "testdata", nameCollection);
+        database.findMatchingRecords("column2", "24", balanceCollection);
+        // The found records are in the order of the records, so the pointers are sorted
+        std::set_intersection(nameCollection.begin(), nameCollection.end(),
+            balanceCollection.begin(), balanceCollection.end(), std::back_inserter(andCollection));
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFindMatchingRecordsAndPointers");
+        timer.resetTimer();
+
+        // Test combining the same searches with result sets
+        DbResultSet nameResultSet{};
+        DbResultSet balanceResultSet{};
+        timer.startTimer();
+        database.findMatchingRecords("column1", "testdata", nameResultSet);
+        database.findMatchingRecords("column2", "24", balanceResultSet);
+        nameResultSet.intersectWith(balanceResultSet);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFindMatchingRecordsAndResultSet");
+        timer.resetTimer();
+
+        // Test the same searches again, reusing the memory of the result sets
+        timer.startTimer();
+        database.findMatchingRecords("column1", "testdata", nameResultSet);
+        database.findMatchingRecords("column2", "24", balanceResultSet);
+        nameResultSet.intersectWith(balanceResultSet);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFindMatchingRecordsAndResultSetReused");
+        timer.resetTimer();
+
+        // Make sure that the function is correct
+        assert(andCollection.size() == f_numberOfRecords / 100);
+        assert(nameResultSet.count() == andCollection.size());
+    }
+
+    void PerformanceTester::measureQueryPerformance(uint64_t f_numberOfRecords) const
+    {
+        auto testData = generateTestData("testdata", f_numberOfRecords);
+        std::cout << "Test data generated\n";
+
+        // Test two searches, each one traversing all the records, combined with result sets
+        TimeMeasurement timer{};
+        InMemoryDb database{ testData };
+        DbResultSet nameResultSet{};
+        DbResultSet balanceResultSet{};
+        timer.startTimer();
+        database.findMatchingRecords("column1", "testdata", nameResultSet);
+        database.findMatchingRecords("column2", "24", balanceResultSet);
+        nameResultSet.intersectWith(balanceResultSet);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFindMatchingRecordsTwoSearches");
+        timer.resetTimer();
+
+        // Test a single query checking the balance before the name
+        DbQuery query{};
+        query.addPredicate("column1", "testdata").addPredicate("column2", "24");
+        DbResultSet queryResultSet{};
+        timer.startTimer();
+        database.findMatchingRecords(query, queryResultSet);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFindMatchingRecordsQuery");
+        timer.resetTimer();
+
+        // Test the same query using the balance index
+        database.enableBalanceIndex();
+        DbResultSet indexResultSet{};
+        timer.startTimer();
+        database.findMatchingRecords(query, indexResultSet);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFindMatchingRecordsQueryBalanceIndex");
+        timer.resetTimer();
+
+        // Make sure that the function is correct
+        assert(nameResultSet.count() == f_numberOfRecords / 100);
+        assert(queryResultSet.count() == nameResultSet.count());
+        assert(indexResultSet.count() == nameResultSet.count());
+    }
+
+    void PerformanceTester::measureCompactionPerformance(uint64_t f_numberOfRecords) const
+    {
+        auto testData = generateTestData("testdata", f_numberOfRecords);
+        std::cout << "Test data generated\n";
+
+        // Delete most of the records without and with the compaction
+        TimeMeasurement timer{};
+        InMemoryDb database{ testData };
+        InMemoryDb compactedDatabase{ testData };
+        compactedDatabase.setCompactionThreshold(0.5);
+        for (uint64_t id = 1; id <= f_numberOfRecords; ++id)
+        {
+            if (id % 5 != 0)
+            {
+                database.deleteRecordByID(static_cast<uint32_t>(id));
+            }
+        }
+
+        timer.startTimer();
+        for (uint64_t id = 1; id <= f_numberOfRecords; ++id)
+        {
+            if (id % 5 != 0)
+            {
+                compactedDatabase.deleteRecordByID(static_cast<uint32_t>(id));
+            }
+        }
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKDeleteRecordsWithCompaction");
+        timer.resetTimer();
+
+        // Test searching among the deleted records and among the compacted records
+        DbTestRecordPointersCollection resultCollection{};
+        timer.startTimer();
+        database.findMatchingRecordsOptimized("column2", "24", resultCollection);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFindMatchingRecordsWithDeletedRecords");
+        timer.resetTimer();
+
+        DbTestRecordPointersCollection compactedCollection{};
+        timer.startTimer();
+        compactedDatabase.findMatchingRecordsOptimized("column2", "24", compactedCollection);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFindMatchingRecordsCompacted");
+        timer.resetTimer();
+
+        // Make sure that the function is correct
+        assert(database.getNumberOfRecords() == compactedDatabase.getNumberOfRecords());
+        assert(compactedDatabase.getNumberOfDeletedRecords() <= compactedDatabase.getNumberOfRecords());
+        assert(resultCollection.size() == compactedCollection.size());
+    }
+
+    void PerformanceTester::measureBatchOperationsPerformance(uint64_t f_numberOfRecords) const
+    {
+        auto testData = generateTestData("testdata", f_numberOfRecords);
+        auto newData = generateTestData("newdata", f_numberOfRecords);
+        for (auto& rec : newData)
+        {
+            rec.id += f_numberOfRecords;
+        }
+        std::cout << "Test data generated\n";
+
+        // Test copying and moving the records into the database
+        TimeMeasurement timer{};
+        timer.startTimer();
+        InMemoryDb database{ testData };
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKConstructCopy");
+        timer.resetTimer();
+
+        auto bulkData = testData;
+        timer.startTimer();
+        InMemoryDb bulkDatabase{ std::move(bulkData) };
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKConstructBulkLoad");
+        timer.resetTimer();
+
+        // Test adding the new records one by one and at once
+        timer.startTimer();
+        for (const auto& rec : newData)
+        {
+            database.addRecord(rec);
+        }
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKAddRecordLoop");
+        timer.resetTimer();
+
+        timer.startTimer();
+        bulkDatabase.addRecords(std::move(newData));
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKAddRecords");
+        timer.resetTimer();
+
+        // Test deleting every tenth record one by one and at once
+        DbRecordIdsCollection ids{};
+        for (uint64_t id = 1; id <= 2 * f_numberOfRecords; id += 10)
+        {
+            ids.emplace_back(static_cast<uint32_t>(id));
+        }
+        timer.startTimer();
+        for (auto id : ids)
+        {
+            database.deleteRecordByID(id);
+        }
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKDeleteRecordByIdLoop");
+        timer.resetTimer();
+
+        timer.startTimer();
+        bulkDatabase.deleteRecordsByIds(ids);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKDeleteRecordsByIds");
+        timer.resetTimer();
+
+        // Make sure that the function is correct
+        assert(database.getNumberOfRecords() == 2 * f_numberOfRecords - ids.size());
+        assert(bulkDatabase.getNumberOfRecords() == database.getNumberOfRecords());
+    }
+
+    void PerformanceTester::measureLoadPerformance(uint64_t f_numberOfRecords) const
+    {
+        TimeMeasurement timer{};
+        AllocationMeasurement allocations{};
+
+        // Test building the records by copying them into the collection and by constructing them in place
+        DbTestRecordCollection copiedData{};
+        copiedData.reserve(f_numberOfRecords);
+        timer.startTimer();
+        allocations.startMeasurement();
+        for (uint64_t i = 1; i <= f_numberOfRecords; ++i)
+        {
+            DbTableTest rec{ i, "testdata" + std::to_string(i), static_cast<int32_t>(i % 100), std::to_string(i) + "testdata" };
+            copiedData.emplace_back(rec);
+        }
+        allocations.stopMeasurement();
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKGenerateCopy");
+        allocations.printAllocations("AKGenerateCopy");
+        timer.resetTimer();
+
+        timer.startTimer();
+        allocations.startMeasurement();
+        auto testData = generateTestData("testdata", f_numberOfRecords);
+        allocations.stopMeasurement();
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKGenerateInPlace");
+        allocations.printAllocations("AKGenerateInPlace");
+        timer.resetTimer();
+
+        // Test loading the records into the database by copying and by moving them
+        timer.startTimer();
+        allocations.startMeasurement();
+        InMemoryDb database{ copiedData };
+        allocations.stopMeasurement();
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKLoadCopy");
+        allocations.printAllocations("AKLoadCopy");
+        timer.resetTimer();
+        copiedData = DbTestRecordCollection{};
+
+        timer.startTimer();
+        allocations.startMeasurement();
+        InMemoryDb movedDatabase{ std::move(testData) };
+        allocations.stopMeasurement();
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKLoadMove");
+        allocations.printAllocations("AKLoadMove");
+        timer.resetTimer();
+
+        // Test adding new records by copying them and by constructing them in place
+        timer.startTimer();
+        allocations.startMeasurement();
+        for (uint64_t i = f_numberOfRecords + 1; i <= 2 * f_numberOfRecords; ++i)
+        {
+            DbTableTest rec{ i, "newdata" + std::to_string(i), static_cast<int32_t>(i % 100), std::to_string(i) + "newdata" };
+            database.addRecord(rec);
+        }
+        allocations.stopMeasurement();
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKAddRecordCopy");
+        allocations.printAllocations("AKAddRecordCopy");
+        timer.resetTimer();
+
+        timer.startTimer();
+        allocations.startMeasurement();
+        for (uint64_t i = f_numberOfRecords + 1; i <= 2 * f_numberOfRecords; ++i)
+        {
+            movedDatabase.emplaceRecord(i, "newdata" + std::to_string(i), static_cast<int32_t>(i % 100), std::to_string(i) + "newdata");
+        }
+        allocations.stopMeasurement();
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKEmplaceRecord");
+        allocations.printAllocations("AKEmplaceRecord");
+        timer.resetTimer();
+
+        // Make sure that the function is correct
+        assert(database.getNumberOfRecords() == 2 * f_numberOfRecords);
+        assert(movedDatabase.getNumberOfRecords() == database.getNumberOfRecords());
+        assert(movedDatabase.findById(2 * f_numberOfRecords) != nullptr);
+    }
+
+    void PerformanceTester::measureStringArenaPerformance(uint64_t f_numberOfRecords) const
+    {
+        // The long prefix makes every string allocate its own memory in the std::string
+        auto testData = generateTestData("streetaddressname", f_numberOfRecords);
+        std::cout << "Test data generated\n";
+
+        AllocationMeasurement allocations{};
+        allocations.startMeasurement();
+        InMemoryDb rowDatabase{ testData, DbStorageLayout::Row };
+        allocations.stopMeasurement();
+        allocations.printAllocations("AKConstructRow");
+        auto rowBytes = allocations.getNumberOfAllocatedBytes();
+
+        allocations.startMeasurement();
+        InMemoryDb columnDatabase{ testData, DbStorageLayout::Column };
+        allocations.stopMeasurement();
+        allocations.printAllocations("AKConstructColumn");
+        if (AllocationMeasurement::isEnabled())
+        {
+            std::cout << "The columns take " << (allocations.getNumberOfAllocatedBytes() - rowBytes) / 1024 << " KB\n";
+        }
+
+        // Test searching both string columns in both layouts
+        TimeMeasurement timer{};
+        DbTestRecordPointersCollection rowCollection{};
+        DbTestRecordPointersCollection columnCollection{};
+        timer.startTimer();
+        rowDatabase.findMatchingRecordsOptimized("column1", "name12345", rowCollection);
+        rowDatabase.findMatchingRecordsOptimized("column3", "5streetaddress", rowCollection);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFindMatchingRecordsRowStrings");
+        timer.resetTimer();
+
+        timer.startTimer();
+        columnDatabase.findMatchingRecordsOptimized("column1", "name12345", columnCollection);
+        columnDatabase.findMatchingRecordsOptimized("column3", "5streetaddress", columnCollection);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFindMatchingRecordsColumnStrings");
+        timer.resetTimer();
+
+        // Make sure that both layouts find the same records
+        assert(rowCollection.size() == columnCollection.size());
+    }
+
+    void PerformanceTester::measureDictionaryEncodingPerformance(uint64_t f_numberOfRecords) const
+    {
+        // Real addresses repeat, so give every record one of a small number of cities
+        auto testData = generateTestData("testdata", f_numberOfRecords);
+        for (auto& rec : testData)
+        {
+            rec.address = "streetaddresscity" + std::to_string(rec.id % 1000);
+        }
+        std::cout << "Test data generated\n";
+
+        AllocationMeasurement allocations{};
+        allocations.startMeasurement();
+        InMemoryDb plainDatabase{ testData, DbStorageLayout::Column };
+        allocations.stopMeasurement();
+        allocations.printAllocations("AKConstructPlain");
+
+        // The encoding allocates only the codes and the distinct strings, and frees the plain column
+        InMemoryDb encodedDatabase{ testData, DbStorageLayout::Column };
+        allocations.startMeasurement();
+        encodedDatabase.enableDictionaryEncoding("column3");
+        allocations.stopMeasurement();
+        allocations.printAllocations("AKEnableDictionaryEncoding");
+
+        // Test searching the address column with and without the encoding
+        TimeMeasurement timer{};
+        DbTestRecordPointersCollection plainCollection{};
+        DbTestRecordPointersCollection encodedCollection{};
+        timer.startTimer();
+        plainDatabase.findMatchingRecordsOptimized("column3", "city12", plainCollection);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFindMatchingRecordsPlain");
+        timer.resetTimer();
+
+        timer.startTimer();
+        encodedDatabase.findMatchingRecordsOptimized("column3", "city12", encodedCollection);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFindMatchingRecordsDictionaryEncoded");
+        timer.resetTimer();
+
+        // Make sure that both columns find the same records
+        assert(plainCollection.size() == encodedCollection.size());
+    }
+
+    void PerformanceTester::measureIntegerCompressionPerformance(uint64_t f_numberOfRecords) const
+    {
+        auto testData = generateTestData("testdata", f_numberOfRecords);
+        std::cout << "Test data generated\n";
+
+        InMemoryDb plainDatabase{ testData, DbStorageLayout::Column };
+        InMemoryDb compressedDatabase{ testData, DbStorageLayout::Column };
+        AllocationMeasurement allocations{};
+        allocations.startMeasurement();
+        compressedDatabase.enableIntegerCompression("column0");
+        compressedDatabase.enableIntegerCompression("column2");
+        allocations.stopMeasurement();
+        allocations.printAllocations("AKEnableIntegerCompression");
+        std::cout << "The plain integer columns take " << f_numberOfRecords * (sizeof(uint64_t) + sizeof(int32_t)) / 1024 << " KB\n";
+
+        // Test the equality and range searches on both kinds of columns
+        const std::pair<InMemoryDb*, std::string> databases[] = {
+            { &plainDatabase, "Plain" },
+            { &compressedDatabase, "Compressed" } };
+        size_t numberOfFoundRecords[2]{ 0, 0 };
+        TimeMeasurement timer{};
+        for (size_t i = 0; i < 2; ++i)
+        {
+            DbTestRecordPointersCollection idCollection{};
+            DbTestRecordPointersCollection balanceCollection{};
+            DbTestRecordPointersCollection rangeCollection{};
+
+            timer.startTimer();
+            databases[i].first->findMatchingRecords("column0", std::to_string(f_numberOfRecords / 2), idCollection);
+            timer.stopTimer();
+            timer.printTimeInMilliseconds("AKFindMatchingRecords" + databases[i].second + "Id");
+            timer.resetTimer();
+
+            timer.startTimer();
+            databases[i].first->findMatchingRecords("column2", "24", balanceCollection);
+            timer.stopTimer();
+            timer.printTimeInMilliseconds("AKFindMatchingRecords" + databases[i].second + "Balance");
+            timer.resetTimer();
+
+            timer.startTimer();
+            databases[i].first->findRecordsByBalanceRange(10, 19, rangeCollection);
+            timer.stopTimer();
+            timer.printTimeInMilliseconds("AKFindRecordsByBalanceRange" + databases[i].second);
+            timer.resetTimer();
+
+            numberOfFoundRecords[i] = idCollection.size() + balanceCollection.size() + rangeCollection.size();
+        }
+
+        // Make sure that both kinds of columns find the same records
+        assert(numberOfFoundRecords[0] == numberOfFoundRecords[1]);
+        (void)numberOfFoundRecords;
+    }
+
+    void PerformanceTester::measureZoneMapsPerformance(uint64_t f_numberOfRecords) const
+    {
+        // The ids are ascending and the balances grow with them, so both columns are clustered
+        auto testData = generateTestData("testdata", f_numberOfRecords);
+        for (auto& rec : testData)
+        {
+            rec.balance = static_cast<int32_t>(rec.id / 100);
+        }
+        std::cout << "Test data generated\n";
+
+        InMemoryDb database{ testData };
+        TimeMeasurement timer{};
+        DbTestRecordPointersCollection idCollection{};
+        DbTestRecordPointersCollection balanceCollection{};
+        DbTestRecordPointersCollection rangeCollection{};
+
+        // The generic algorithm doesn't use the primary-key index
+        timer.startTimer();
+        database.findMatchingRecords("column0", std::to_string(f_numberOfRecords / 2), idCollection);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFindMatchingRecordsZoneMapsId");
+        timer.resetTimer();
+
+        timer.startTimer();
+        database.findMatchingRecordsOptimized("column2", "2424", balanceCollection);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFindMatchingRecordsZoneMapsBalance");
+        timer.resetTimer();
+
+        timer.startTimer();
+        database.findRecordsByBalanceRange(1000, 1099, rangeCollection);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFindRecordsByBalanceRangeZoneMaps");
+        timer.resetTimer();
+
+        // Make sure that the function is correct
+        assert(idCollection.size() == 1);
+        assert(balanceCollection.size() == 100);
+        assert(rangeCollection.size() == 10000);
+    }
+
+    void PerformanceTester::measureSnapshotPerformance(uint64_t f_numberOfRecords) const
+    {
+        std::string path = (std::filesystem::temp_directory_path() / "InMemoryDbPerformance.xqdb").string();
+        TimeMeasurement timer{};
+
+        // The usual startup generates the records and constructs the database from them
+        timer.startTimer();
+        InMemoryDb database{ generateTestData("testdata", f_numberOfRecords) };
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKConstructFromGeneratedData");
+        timer.resetTimer();
+
+        timer.startTimer();
+        bool isSaved = database.saveSnapshot(path);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKSaveSnapshot");
+        timer.resetTimer();
+
+        // Opening only maps the file, the columns are used in place
+        DbSnapshot snapshot{};
+        timer.startTimer();
+        bool isOpened = snapshot.open(path);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKOpenSnapshot");
+        timer.resetTimer();
+
+        InMemoryDb loadedDatabase{ DbTestRecordCollection{} };
+        timer.startTimer();
+        bool isLoaded = loadedDatabase.loadSnapshot(path);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKLoadSnapshot");
+        timer.resetTimer();
+
+        // Make sure that the function is correct
+        assert(isSaved && isOpened && isLoaded);
+        assert(snapshot.getNumberOfRecords() == f_numberOfRecords);
+        assert(loadedDatabase.getNumberOfRecords() == f_numberOfRecords);
+        (void)isSaved;
+        (void)isOpened;
+        (void)isLoaded;
+        std::filesystem::remove(path);
+    }
+
+    void PerformanceTester::measureWriteAheadLogPerformance(uint64_t f_numberOfMutations) const
+    {
+        auto testData = generateTestData("testdata", f_numberOfMutations);
+        std::cout << "Test data generated\n";
+        std::string logPath = (std::filesystem::temp_directory_path() / "InMemoryDbPerformance.wal").string();
+
+        measureMutations(testData, std::string{}, DbWalSyncPolicy::NoSync, "AKMutationsWithoutWriteAheadLog");
+        measureMutations(testData, logPath, DbWalSyncPolicy::EveryCommit, "AKMutationsWriteAheadLogEveryCommit");
+        measureMutations(testData, logPath, DbWalSyncPolicy::GroupCommit, "AKMutationsWriteAheadLogGroupCommit");
+        measureMutations(testData, logPath, DbWalSyncPolicy::NoSync, "AKMutationsWriteAheadLogNoSync");
+
+        // The log of the last run is replayed
+        InMemoryDb database{ DbTestRecordCollection{} };
+        TimeMeasurement timer{};
+        timer.startTimer();
+        bool isReplayed = database.replayWriteAheadLog(logPath);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKReplayWriteAheadLog");
+        timer.resetTimer();
+
+        // Make sure that the function is correct
+        assert(isReplayed);
+        assert(database.getNumberOfRecords() == 0);
+        assert(database.getNumberOfDeletedRecords() == 0);
+        (void)isReplayed;
+        std::filesystem::remove(logPath);
+    }
+
+    void PerformanceTester::measureMutations(const DbTestRecordCollection& f_testData, const std::string& f_logPath,
+        DbWalSyncPolicy f_syncPolicy, const std::string& f_operationName) const
+    {
+        InMemoryDb database{ DbTestRecordCollection{} };
+        if (!f_logPath.empty())
+        {
+            std::filesystem::remove(f_logPath);
+            database.enableWriteAheadLog(f_logPath, f_syncPolicy);
+        }
+
+        TimeMeasurement timer{};
+        timer.startTimer();
+        for (const auto& rec : f_testData)
+        {
+            database.addRecord(rec);
+        }
+        for (const auto& rec : f_testData)
+        {
+            database.deleteRecordByID(static_cast<uint32_t>(rec.id));
+        }
+        database.syncWriteAheadLog();
+        timer.stopTimer();
+        timer.printTimeInMilliseconds(f_operationName);
+        timer.resetTimer();
+
+        // Make sure that the function is correct
+        assert(database.getNumberOfRecords() == 0);
+    }
+
+    void PerformanceTester::measureConcurrencyPerformance(uint64_t f_numberOfRecords) const
+    {
+        auto testData = generateTestData("testdata", f_numberOfRecords);
+        std::cout << "Test data generated\n";
+
+        // Runs the readers and the writer at the same time and returns the number of found records
+        auto runMixedWorkload = [&](const auto& f_findById, const auto& f_addRecord, const auto& f_deleteRecord) {
+            std::atomic<uint64_t> numberOfFoundRecords{ 0 };
+            std::vector<std::thread> readers{};
+            for (uint32_t readerIndex = 0; readerIndex < cNumberOfConcurrentReaders; ++readerIndex)
+            {
+                readers.emplace_back([&, readerIndex]() {
+                    uint64_t numberOfFound{ 0 };
+                    for (uint64_t lookup = 0; lookup < cNumberOfConcurrentLookups; ++lookup)
+                    {
+                        uint64_t id = (lookup * 7919 + readerIndex) % f_numberOfRecords + 1;
+                        numberOfFound += f_findById(id) ? 1 : 0;
+                    }
+                    numberOfFoundRecords += numberOfFound;
+                });
+            }
+            for (uint64_t write = 0; write < cNumberOfConcurrentWrites; ++write)
+            {
+                uint64_t id = f_numberOfRecords + write + 1;
+                f_addRecord(DbTableTest{ id, "newdata", 1, "newdata" });
+                f_deleteRecord(static_cast<uint32_t>(id));
+            }
+            for (auto& reader : readers)
+            {
+                reader.join();
+            }
+            return numberOfFoundRecords.load();
+        };
+
+        // Reader/writer lock - the readers wait while a record is written
+        InMemoryDb lockedDatabase{ testData };
+        std::shared_mutex databaseMutex{};
+        TimeMeasurement timer{};
+        timer.startTimer();
+        uint64_t numberOfLockedFound = runMixedWorkload(
+            [&](uint64_t f_id) {
+                std::shared_lock<std::shared_mutex> lock{ databaseMutex };
+                return lockedDatabase.findById(f_id) != nullptr;
+            },
+            [&](const DbTableTest& f_record) {
+                std::unique_lock<std::shared_mutex> lock{ databaseMutex };
+                lockedDatabase.addRecord(f_record);
+            },
+            [&](uint32_t f_id) {
+                std::unique_lock<std::shared_mutex> lock{ databaseMutex };
+                lockedDatabase.deleteRecordByID(f_id);
+            });
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKMixedReadWriteSharedMutex");
+        timer.resetTimer();
+
+        // Two copies - the readers never wait
+        ConcurrentInMemoryDb concurrentDatabase{ testData };
+        timer.startTimer();
+        uint64_t numberOfConcurrentFound = runMixedWorkload(
+            [&](uint64_t f_id) {
+                return concurrentDatabase.read([&](const InMemoryDb& f_database) { return f_database.findById(f_id) != nullptr; });
+            },
+            [&](const DbTableTest& f_record) { concurrentDatabase.addRecord(f_record); },
+            [&](uint32_t f_id) { concurrentDatabase.deleteRecordByID(f_id); });
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKMixedReadWriteConcurrentInMemoryDb");
+        timer.resetTimer();
+
+        // Make sure that the function is correct
+        assert(numberOfLockedFound == cNumberOfConcurrentReaders * cNumberOfConcurrentLookups);
+        assert(numberOfConcurrentFound == numberOfLockedFound);
+        assert(concurrentDatabase.getNumberOfRecords() == f_numberOfRecords);
+        (void)numberOfLockedFound;
+        (void)numberOfConcurrentFound;
+    }
+
+    void PerformanceTester::measureShardingPerformance(uint64_t f_numberOfWrites) const
+    {
+        auto testData = generateTestData("testdata", f_numberOfWrites);
+        std::cout << "Test data generated\n";
+
+        // Every thread writes its own part of the records
+        auto runWriters = [&](uint32_t f_numberOfThreads, const auto& f_addRecord, const auto& f_deleteRecord) {
+            std::vector<std::thread> writers{};
+            uint64_t recordsPerThread = f_numberOfWrites / f_numberOfThreads;
+            for (uint32_t threadIndex = 0; threadIndex < f_numberOfThreads; ++threadIndex)
+            {
+                writers.emplace_back([&, threadIndex]() {
+                    auto begin = testData.begin() + static_cast<std::ptrdiff_t>(threadIndex * recordsPerThread);
+                    auto end = begin + static_cast<std::ptrdiff_t>(recordsPerThread);
+                    for (auto iter = begin; iter != end; ++iter)
+                    {
+                        f_addRecord(*iter);
+                    }
+                    for (auto iter = begin; iter != end; ++iter)
+                    {
+                        f_deleteRecord(static_cast<uint32_t>(iter->id));
+                    }
+                });
+            }
+            for (auto& writer : writers)
+            {
+                writer.join();
+            }
+        };
+
+        for (uint32_t numberOfThreads : cNumberOfShardingWriterThreads)
+        {
+            // A single database - the writers wait for each other
+            InMemoryDb lockedDatabase{ DbTestRecordCollection{} };
+            std::mutex databaseMutex{};
+            TimeMeasurement timer{};
+            timer.startTimer();
+            runWriters(numberOfThreads,
+                [&](const DbTableTest& f_record) {
+                    std::lock_guard<std::mutex> lock{ databaseMutex };
+                    lockedDatabase.addRecord(f_record);
+                },
+                [&](uint32_t f_id) {
+                    std::lock_guard<std::mutex> lock{ databaseMutex };
+                    lockedDatabase.deleteRecordByID(f_id);
+                });
+            timer.stopTimer();
+            timer.printTimeInMilliseconds("AKWritesSingleLockThreads" + std::to_string(numberOfThreads));
+            timer.resetTimer();
+
+            // One shard per possible writer thread - the writers of different shards don't wait
+            ShardedInMemoryDb shardedDatabase{ DbTestRecordCollection{}, cNumberOfShards };
+            timer.startTimer();
+            runWriters(numberOfThreads,
+                [&](const DbTableTest& f_record) { shardedDatabase.addRecord(f_record); },
+                [&](uint32_t f_id) { shardedDatabase.deleteRecordByID(f_id); });
+            timer.stopTimer();
+            timer.printTimeInMilliseconds("AKWritesShardedThreads" + std::to_string(numberOfThreads));
+            timer.resetTimer();
+
+            // Make sure that the function is correct
+            assert(lockedDatabase.getNumberOfRecords() == 0);
+            assert(shardedDatabase.getNumberOfRecords() == 0);
+        }
+    }
+
+    void PerformanceTester::measureCursorPerformance(uint64_t f_numberOfRecords) const
+    {
+        auto testData = generateTestData("testdata", f_numberOfRecords);
+        std::cout << "Test data generated\n";
+
+        // Every record matches, so the whole result is walked
+        InMemoryDb database{ testData };
+        TimeMeasurement timer{};
+        AllocationMeasurement allocations{};
+        int64_t collectedBalance{ 0 };
+        timer.startTimer();
+        allocations.startMeasurement();
+        DbTestRecordPointersCollection collectedRecords{};
+        database.findMatchingRecords("column1", "testdata", collectedRecords);
+        for (auto rec : collectedRecords)
+        {
+            collectedBalance += rec->balance;
+        }
+        allocations.stopMeasurement();
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKWalkAllMatchingRecordsVector");
+        allocations.printAllocations("AKWalkAllMatchingRecordsVector");
+        timer.resetTimer();
+
+        int64_t fetchedBalance{ 0 };
+        timer.startTimer();
+        allocations.startMeasurement();
+        auto cursor = database.openCursor("column1", "testdata");
+        DbTestRecordPointersCollection batch{};
+        while (cursor.fetch(batch, cCursorBatchSize) > 0)
+        {
+            for (auto rec : batch)
+            {
+                fetchedBalance += rec->balance;
+            }
+        }
+        allocations.stopMeasurement();
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKWalkAllMatchingRecordsCursor");
+        allocations.printAllocations("AKWalkAllMatchingRecordsCursor");
+        timer.resetTimer();
+
+        // The first record, once from the whole result and once from a cursor
+        timer.startTimer();
+        DbTestRecordPointersCollection firstRecords{};
+        database.findMatchingRecords("column3", "testdata", firstRecords);
+        const DbTableTest* firstCollectedRecord = firstRecords.front();
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFirstRecordVector");
+        timer.resetTimer();
+
+        timer.startTimer();
+        const DbTableTest* firstFetchedRecord = database.openCursor("column3", "testdata").next();
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFirstRecordCursor");
+        timer.resetTimer();
+
+        // The first ten of many matching records
+        timer.startTimer();
+        DbTestRecordPointersCollection allRecords{};
+        database.findMatchingRecords("column1", "testdata9", allRecords);
+        DbTestRecordPointersCollection firstTenRecords{ allRecords.begin(), allRecords.begin() + 10 };
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFirstTenRecordsVector");
+        timer.resetTimer();
+
+        timer.startTimer();
+        auto limitedCursor = database.openCursor("column1", "testdata9", 10);
+        size_t numberOfLimitedRecords = limitedCursor.fetch(batch, cCursorBatchSize);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKFirstTenRecordsCursor");
+        timer.resetTimer();
+
+        // Make sure that the function is correct
+        assert(collectedBalance == fetchedBalance);
+        assert(firstCollectedRecord == firstFetchedRecord);
+        assert(numberOfLimitedRecords == 10);
+        assert(std::equal(firstTenRecords.begin(), firstTenRecords.end(), batch.begin()));
+        (void)firstCollectedRecord;
+        (void)firstFetchedRecord;
+        (void)numberOfLimitedRecords;
+    }
+
+    void PerformanceTester::measureTopRecordsPerformance(uint64_t f_numberOfRecords) const
+    {
+        auto testData = generateTestData("testdata", f_numberOfRecords);
+        std::cout << "Test data generated\n";
+
+        // Every record matches, the largest balances are first and the later records are first among equal balances
+        InMemoryDb database{ testData };
+        DbQuery query{};
+        query.addPredicate("column3", "testdata");
+        TimeMeasurement timer{};
+        AllocationMeasurement allocations{};
+        timer.startTimer();
+        allocations.startMeasurement();
+        DbTestRecordPointersCollection sortedRecords{};
+        database.findMatchingRecords(query, sortedRecords);
+        std::sort(sortedRecords.begin(), sortedRecords.end(), [](const DbTableTest* f_first, const DbTableTest* f_second) {
+            return f_first->balance > f_second->balance || (f_first->balance == f_second->balance && f_first > f_second);
+        });
+        sortedRecords.resize(std::min(sortedRecords.size(), cNumberOfTopRecords));
+        allocations.stopMeasurement();
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKTopRecordsFullSort");
+        allocations.printAllocations("AKTopRecordsFullSort");
+        timer.resetTimer();
+
+        timer.startTimer();
+        allocations.startMeasurement();
+        DbTestRecordPointersCollection heapRecords{};
+        database.findTopRecords(query, "column2", DbSortOrder::Descending, cNumberOfTopRecords, heapRecords);
+        allocations.stopMeasurement();
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKTopRecordsHeap");
+        allocations.printAllocations("AKTopRecordsHeap");
+        timer.resetTimer();
+
+        database.enableBalanceIndex();
+        timer.startTimer();
+        allocations.startMeasurement();
+        DbTestRecordPointersCollection indexRecords{};
+        database.findTopRecords(query, "column2", DbSortOrder::Descending, cNumberOfTopRecords, indexRecords);
+        allocations.stopMeasurement();
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKTopRecordsBalanceIndex");
+        allocations.printAllocations("AKTopRecordsBalanceIndex");
+        timer.resetTimer();
+
+        // Make sure that the function is correct
+        assert(sortedRecords == heapRecords);
+        assert(sortedRecords == indexRecords);
+    }
+
+    void PerformanceTester::measureAggregationPerformance(uint64_t f_numberOfRecords) const
+    {
+        auto testData = generateTestData("testdata", f_numberOfRecords);
+        std::cout << "Test data generated\n";
+
+        // Sum the balances of all the records, as a dashboard would do
+        InMemoryDb rowDatabase{ testData };
+        InMemoryDb columnDatabase{ testData, DbStorageLayout::Column };
+        TimeMeasurement timer{};
+        AllocationMeasurement allocations{};
+        timer.startTimer();
+        allocations.startMeasurement();
+        DbTestRecordPointersCollection collectedRecords{};
+        rowDatabase.findMatchingRecords(DbQuery{}, collectedRecords);
+        int64_t collectedSum{ 0 };
+        for (auto rec : collectedRecords)
+        {
+            collectedSum += rec->balance;
+        }
+        allocations.stopMeasurement();
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKSumCollectedRecords");
+        allocations.printAllocations("AKSumCollectedRecords");
+        timer.resetTimer();
+
+        timer.startTimer();
+        allocations.startMeasurement();
+        DbAggregate rowAggregate{};
+        rowDatabase.aggregate(DbQuery{}, "column2", rowAggregate);
+        allocations.stopMeasurement();
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKAggregateRowLayout");
+        allocations.printAllocations("AKAggregateRowLayout");
+        timer.resetTimer();
+
+        timer.startTimer();
+        allocations.startMeasurement();
+        DbAggregate columnAggregate{};
+        columnDatabase.aggregate(DbQuery{}, "column2", columnAggregate);
+        allocations.stopMeasurement();
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKAggregateColumnLayout");
+        allocations.printAllocations("AKAggregateColumnLayout");
+        timer.resetTimer();
+
+        // Group the matching records by balance
+        DbQuery query{};
+        query.addPredicate("column3", "testdata");
+        timer.startTimer();
+        DbTestRecordPointersCollection groupedRecords{};
+        rowDatabase.findMatchingRecords(query, groupedRecords);
+        DbAggregateGroupsCollection collectedGroups{};
+        for (auto rec : groupedRecords)
+        {
+            collectedGroups[std::to_string(rec->balance)].addValue(static_cast<int64_t>(rec->id));
+        }
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKGroupCollectedRecords");
+        timer.resetTimer();
+
+        timer.startTimer();
+        DbAggregateGroupsCollection aggregatedGroups{};
+        rowDatabase.aggregateByGroup(query, "column2", "column0", aggregatedGroups);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKAggregateByGroup");
+        timer.resetTimer();
+
+        // Make sure that the function is correct
+        assert(collectedSum == rowAggregate.sum);
+        assert(collectedSum == columnAggregate.sum);
+        assert(rowAggregate.count == columnAggregate.count);
+        assert(collectedGroups.size() == aggregatedGroups.size());
+        assert(collectedGroups.at("42").sum == aggregatedGroups.at("42").sum);
+        (void)collectedSum;
+    }
+
+    void PerformanceTester::measureQueryCachePerformance(uint64_t f_numberOfRecords) const
+    {
+        auto testData = generateTestData("testdata", f_numberOfRecords);
+        std::cout << "Test data generated\n";
+
+        // A few searches repeated many times between two modifications
+        auto repeatSearches = [](const InMemoryDb& f_database) {
+            size_t numberOfFoundRecords{ 0 };
+            for (uint32_t i = 0; i < cNumberOfRepeatedSearches; ++i)
+            {
+                DbTestRecordPointersCollection foundRecords{};
+                f_database.findMatchingRecords("column1", "testdata12345", foundRecords);
+                f_database.findMatchingRecords("column2", "42", foundRecords);
+                numberOfFoundRecords += foundRecords.size();
+            }
+            return numberOfFoundRecords;
+        };
+
+        InMemoryDb database{ testData };
+        TimeMeasurement timer{};
+        timer.startTimer();
+        size_t numberOfUncachedRecords = repeatSearches(database);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKRepeatedSearchesWithoutCache");
+        timer.resetTimer();
+
+        database.enableQueryCache();
+        timer.startTimer();
+        size_t numberOfCachedRecords = repeatSearches(database);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKRepeatedSearchesWithCache");
+        timer.resetTimer();
+        std::cout << "The query cache had " << database.getNumberOfQueryCacheHits() << " hits and "
+            << database.getNumberOfQueryCacheMisses() << " misses\n";
+
+        // The first search after a modification scans the records again
+        database.addRecord({ f_numberOfRecords + 1, "testdata12345", 42, "testdata" });
+        timer.startTimer();
+        DbTestRecordPointersCollection foundRecords{};
+        database.findMatchingRecords("column2", "42", foundRecords);
+        timer.stopTimer();
+        timer.printTimeInMilliseconds("AKSearchAfterModification");
+        timer.resetTimer();
+
+        // Make sure that the function is correct
+        assert(numberOfUncachedRecords == numberOfCachedRecords);
+        assert(foundRecords.size() == f_numberOfRecords / 100 + 1);
+        (void)numberOfUncachedRecords;
+        (void)numberOfCachedRecords;
+    }
+
     DbTestRecordCollection PerformanceTester::generateTestData(const std::string& f_prefixSuffix, uint64_t f_numberOfRecords) const
     {
         DbTestRecordCollection data;
         data.reserve(f_numberOfRecords);
         for (uint64_t i = 1; i <= f_numberOfRecords; ++i)
         {
-            DbTableTest rec{i, f_prefixSuffix + std::to_string(i), static_cast<int32_t>(i % 100), std::to_string(i) + f_prefixSuffix};
-            data.emplace_back(rec);
+            // Construct the record directly in the collection instead of copying it there
+            data.push_back({ i, f_prefixSuffix + std::to_string(i), static_cast<int32_t>(i % 100), std::to_string(i) + f_prefixSuffix });
         }
         return data;
     }
@@ -157,7 +1388,7 @@ namespace xq
         const std::string& f_columnName, const std::string& f_matchString) const
     {
         DbTestRecordCollection result;
-        std::copy_if(f_records.begin(), f_records.end(), std::back_inserter(result), [&](DbTableTest rec) {
+        std::copy_if(f_records.begin(), f_records.end(), std::back_inserter(result), [&](const DbTableTest& rec) {
             if (f_columnName == "column0") {
                 uint64_t matchValue = std::stoul(f_matchString);
                 return matchValue == rec.id;
@@ -0,0 +1,187 @@
+/// @file ShardedInMemoryDb.cpp
+///
+/// @brief Implementation of the in-memory database class ShardedInMemoryDb.
+/// @details Splits the records by the hash of their id into several independent databases,
+/// so that writers of different records don't wait for each other.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "ShardedInMemoryDb.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+#include <thread>
+
+namespace xq
+{
+    // The minimum number of records in all the shards, with which the shards are searched in parallel
+    constexpr uint64_t const cMinimumRecordsForParallelSearch{ 65536 };
+    // Multiplier of the Fibonacci hashing, which spreads consecutive ids among all the shards
+    constexpr uint64_t const cShardHashMultiplier{ 0x9E3779B97F4A7C15ull };
+
+    ShardedInMemoryDb::ShardedInMemoryDb(const DbTestRecordCollection& f_records, uint32_t f_numberOfShards,
+        DbStorageLayout f_storageLayout)
+    {
+        if (f_numberOfShards == 0)
+        {
+            // The number of hardware threads might not be available on every platform
+            f_numberOfShards = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+
+        // Construct the shards only after their final size is known, so that every shard is built once
+        m_shards.resize(f_numberOfShards);
+        std::vector<DbTestRecordCollection> shardRecords(f_numberOfShards);
+        for (const auto& rec : f_records)
+        {
+            shardRecords[getShardIndex(rec.id)].push_back(rec);
+        }
+        for (size_t shardIndex = 0; shardIndex < m_shards.size(); ++shardIndex)
+        {
+            m_shards[shardIndex].reset(new DbShard{ {}, InMemoryDb{ std::move(shardRecords[shardIndex]), f_storageLayout } });
+        }
+    }
+
+    void ShardedInMemoryDb::addRecord(const DbTableTest& f_newRecord)
+    {
+        auto& shard = *m_shards[getShardIndex(f_newRecord.id)];
+        std::unique_lock<std::shared_mutex> lock{ shard.mutex };
+        shard.database.addRecord(f_newRecord);
+    }
+
+    void ShardedInMemoryDb::addRecords(const DbTestRecordCollection& f_newRecords)
+    {
+        std::vector<DbTestRecordCollection> shardRecords(m_shards.size());
+        for (const auto& newRecord : f_newRecords)
+        {
+            shardRecords[getShardIndex(newRecord.id)].push_back(newRecord);
+        }
+        for (size_t shardIndex = 0; shardIndex < m_shards.size(); ++shardIndex)
+        {
+            if (!shardRecords[shardIndex].empty())
+            {
+                std::unique_lock<std::shared_mutex> lock{ m_shards[shardIndex]->mutex };
+                m_shards[shardIndex]->database.addRecords(std::move(shardRecords[shardIndex]));
+            }
+        }
+    }
+
+    void ShardedInMemoryDb::deleteRecordByID(uint32_t f_id)
+    {
+        auto& shard = *m_shards[getShardIndex(f_id)];
+        std::unique_lock<std::shared_mutex> lock{ shard.mutex };
+        shard.database.deleteRecordByID(f_id);
+    }
+
+    void ShardedInMemoryDb::deleteRecordsByIds(const DbRecordIdsCollection& f_ids)
+    {
+        std::vector<DbRecordIdsCollection> shardIds(m_shards.size());
+        for (auto id : f_ids)
+        {
+            shardIds[getShardIndex(id)].emplace_back(id);
+        }
+        for (size_t shardIndex = 0; shardIndex < m_shards.size(); ++shardIndex)
+        {
+            if (!shardIds[shardIndex].empty())
+            {
+                std::unique_lock<std::shared_mutex> lock{ m_shards[shardIndex]->mutex };
+                m_shards[shardIndex]->database.deleteRecordsByIds(shardIds[shardIndex]);
+            }
+        }
+    }
+
+    bool ShardedInMemoryDb::findById(uint64_t f_id, DbTableTest& f_record) const
+    {
+        const auto& shard = *m_shards[getShardIndex(f_id)];
+        std::shared_lock<std::shared_mutex> lock{ shard.mutex };
+        auto foundRecord = shard.database.findById(f_id);
+        if (foundRecord == nullptr)
+        {
+            return false;
+        }
+        f_record = *foundRecord;
+        return true;
+    }
+
+    void ShardedInMemoryDb::findMatchingRecords(const std::string& f_columnName, const std::string& f_matchString,
+        DbTestRecordCollection& f_output) const
+    {
+        // The found records are copied while the shard is locked, the pointers are not valid after unlocking it
+        std::vector<DbTestRecordCollection> shardOutputs(m_shards.size());
+        auto searchShard = [&](size_t f_shardIndex) {
+            const auto& shard = *m_shards[f_shardIndex];
+            std::shared_lock<std::shared_mutex> lock{ shard.mutex };
+            DbTestRecordPointersCollection foundRecords{};
+            shard.database.findMatchingRecords(f_columnName, f_matchString, foundRecords);
+            shardOutputs[f_shardIndex].reserve(foundRecords.size());
+            for (auto foundRecord : foundRecords)
+            {
+                shardOutputs[f_shardIndex].push_back(*foundRecord);
+            }
+        };
+
+        if (m_shards.size() > 1 && getNumberOfRecords() >= cMinimumRecordsForParallelSearch)
+        {
+            std::vector<std::thread> threads{};
+            threads.reserve(m_shards.size() - 1);
+            for (size_t shardIndex = 1; shardIndex < m_shards.size(); ++shardIndex)
+            {
+                threads.emplace_back(searchShard, shardIndex);
+            }
+
+            // The current thread takes care of the first shard
+            searchShard(0);
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+        }
+        else
+        {
+            for (size_t shardIndex = 0; shardIndex < m_shards.size(); ++shardIndex)
+            {
+                searchShard(shardIndex);
+            }
+        }
+
+        for (auto& shardOutput : shardOutputs)
+        {
+            f_output.insert(f_output.end(), std::make_move_iterator(shardOutput.begin()),
+                std::make_move_iterator(shardOutput.end()));
+        }
+    }
+
+    void ShardedInMemoryDb::writeAllShards(const DbMutationFunction& f_mutation)
+    {
+        for (auto& shard : m_shards)
+        {
+            std::unique_lock<std::shared_mutex> lock{ shard->mutex };
+            f_mutation(shard->database);
+        }
+    }
+
+    uint64_t ShardedInMemoryDb::getNumberOfRecords() const
+    {
+        uint64_t numberOfRecords{ 0 };
+        for (const auto& shard : m_shards)
+        {
+            std::shared_lock<std::shared_mutex> lock{ shard->mutex };
+            numberOfRecords += shard->database.getNumberOfRecords();
+        }
+        return numberOfRecords;
+    }
+
+    uint32_t ShardedInMemoryDb::getNumberOfShards() const
+    {
+        return static_cast<uint32_t>(m_shards.size());
+    }
+
+    size_t ShardedInMemoryDb::getShardIndex(uint64_t f_id) const
+    {
+        // The upper bits of the product are the best mixed ones
+        return static_cast<size_t>(((f_id * cShardHashMultiplier) >> 32) % m_shards.size());
+    }
+} /// namespace xq
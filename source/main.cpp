@@ -11,6 +11,7 @@
 
 #include <iostream>
 #include <math.h>
+#include <thread>
 
 // Settings for the performance tests
 constexpr uint64_t const cNumberOfTestRecordsSameAmount{ 1000000 };
@@ -19,6 +20,9 @@ constexpr uint32_t const cNumberOfTestRecordsDifferentAmountPower{ 10 };
 constexpr uint32_t const cNumberOfTestExecutionsdifferentAmount{ 6 };
 constexpr uint32_t const cIfDeleteRecords{ 10 };
 constexpr uint32_t const cNumberOfTestExecutionsDeleteRecords{ 5 };
+constexpr uint64_t const cNumberOfTestRecordsScanKernels[]{ 1000000, 100000000 };
+constexpr uint64_t const cNumberOfTestRecordsLoad[]{ 1000000, 10000000 };
+constexpr uint64_t const cNumberOfTestMutationsWriteAheadLog{ 10000 };
 
 void testFindMatchingRecord()
 {
@@ -75,10 +79,357 @@ void testAddNewRecord()
 	std::cout << "\n";
 }
 
+void testFindRecordById()
+{
+	xq::PerformanceTester tester{};
+	// Test finding a record by its ID in the database
+	std::cout << "Testing Find Record By ID\n";
+	for (uint32_t i = 0; i < cNumberOfTestExecutionsDeleteRecords; ++i)
+	{
+		auto recordsIdToFind = static_cast<uint32_t>(pow(static_cast<double>(cIfDeleteRecords), static_cast<double>(i + 1)));
+		std::cout << "Starting test #" << i + 1 << " with record id = " << recordsIdToFind << " records\n";
+		tester.measureFindRecordByIdPerformance(cNumberOfTestRecordsSameAmount, recordsIdToFind);
+		std::cout << "\n";
+	}
+	std::cout << "\n";
+}
+
+void testStorageLayout()
+{
+	xq::PerformanceTester tester{};
+	// Test searching with the row and the column layout several times
+	std::cout << "Testing Find Matching Records with row and column layout\n";
+	for (uint32_t i = 0; i < cNumberOfTestExecutionsSameAmount; ++i)
+	{
+		std::cout << "Starting test #" << i + 1 << " with " << cNumberOfTestRecordsSameAmount << " records\n";
+		tester.measureStorageLayoutPerformance(cNumberOfTestRecordsSameAmount);
+		std::cout << "\n";
+	}
+	std::cout << "\n";
+}
+
+void testScanKernels()
+{
+	xq::PerformanceTester tester{};
+	// Test the scan kernels with small and large amounts of records
+	std::cout << "Testing Scan Kernels for the integer columns\n";
+	for (auto numberOfRecords : cNumberOfTestRecordsScanKernels)
+	{
+		std::cout << "Starting test with " << numberOfRecords << " records\n";
+		tester.measureScanKernelsPerformance(numberOfRecords);
+		std::cout << "\n";
+	}
+	std::cout << "\n";
+}
+
+void testParallelScan()
+{
+	xq::PerformanceTester tester{};
+	// Test searching with every number of threads up to the number of hardware threads
+	std::cout << "Testing Find Matching Records with several threads\n";
+	auto maxNumberOfThreads = std::max(std::thread::hardware_concurrency(), 1u);
+	for (uint32_t numberOfThreads = 1; numberOfThreads <= maxNumberOfThreads; ++numberOfThreads)
+	{
+		std::cout << "Starting test with " << numberOfThreads << " threads and " << cNumberOfTestRecordsSameAmount << " records\n";
+		tester.measureFindMatchingRecordsParallelPerformance(cNumberOfTestRecordsSameAmount, numberOfThreads);
+		std::cout << "\n";
+	}
+	std::cout << "\n";
+}
+
+void testTrigramIndex()
+{
+	xq::PerformanceTester tester{};
+	// Test searching for a unique name with a trigram index several times
+	std::cout << "Testing Find Matching Records with a trigram index\n";
+	for (uint32_t i = 0; i < cNumberOfTestExecutionsSameAmount; ++i)
+	{
+		std::cout << "Starting test #" << i + 1 << " with " << cNumberOfTestRecordsSameAmount << " records\n";
+		tester.measureTrigramIndexPerformance(cNumberOfTestRecordsSameAmount);
+		std::cout << "\n";
+	}
+	std::cout << "\n";
+}
+
+void testBalanceIndex()
+{
+	xq::PerformanceTester tester{};
+	// Test searching for a balance range with an ordered index several times
+	std::cout << "Testing Find Records By Balance Range with a balance index\n";
+	for (uint32_t i = 0; i < cNumberOfTestExecutionsSameAmount; ++i)
+	{
+		std::cout << "Starting test #" << i + 1 << " with " << cNumberOfTestRecordsSameAmount << " records\n";
+		tester.measureBalanceRangePerformance(cNumberOfTestRecordsSameAmount);
+		std::cout << "\n";
+	}
+	std::cout << "\n";
+}
+
+void testResultSet()
+{
+	xq::PerformanceTester tester{};
+	// Test combining two searches with result sets several times
+	std::cout << "Testing Find Matching Records with result sets\n";
+	for (uint32_t i = 0; i < cNumberOfTestExecutionsSameAmount; ++i)
+	{
+		std::cout << "Starting test #" << i + 1 << " with " << cNumberOfTestRecordsSameAmount << " records\n";
+		tester.measureResultSetPerformance(cNumberOfTestRecordsSameAmount);
+		std::cout << "\n";
+	}
+	std::cout << "\n";
+}
+
+void testQuery()
+{
+	xq::PerformanceTester tester{};
+	// Test searching with a query of several predicates several times
+	std::cout << "Testing Find Matching Records with a query\n";
+	for (uint32_t i = 0; i < cNumberOfTestExecutionsSameAmount; ++i)
+	{
+		std::cout << "Starting test #" << i + 1 << " with " << cNumberOfTestRecordsSameAmount << " records\n";
+		tester.measureQueryPerformance(cNumberOfTestRecordsSameAmount);
+		std::cout << "\n";
+	}
+	std::cout << "\n";
+}
+
+void testCompaction()
+{
+	xq::PerformanceTester tester{};
+	// Test deleting most of the records with compaction several times
+	std::cout << "Testing Delete Records with compaction\n";
+	for (uint32_t i = 0; i < cNumberOfTestExecutionsSameAmount; ++i)
+	{
+		std::cout << "Starting test #" << i + 1 << " with " << cNumberOfTestRecordsSameAmount << " records\n";
+		tester.measureCompactionPerformance(cNumberOfTestRecordsSameAmount);
+		std::cout << "\n";
+	}
+	std::cout << "\n";
+}
+
+void testBatchOperations()
+{
+	xq::PerformanceTester tester{};
+	// Test adding and deleting records in batches several times
+	std::cout << "Testing Batch Operations\n";
+	for (uint32_t i = 0; i < cNumberOfTestExecutionsSameAmount; ++i)
+	{
+		std::cout << "Starting test #" << i + 1 << " with " << cNumberOfTestRecordsSameAmount << " records\n";
+		tester.measureBatchOperationsPerformance(cNumberOfTestRecordsSameAmount);
+		std::cout << "\n";
+	}
+	std::cout << "\n";
+}
+
+void testLoad()
+{
+	xq::PerformanceTester tester{};
+	// Test loading small and large amounts of records
+	std::cout << "Testing Load of the records\n";
+	for (auto numberOfRecords : cNumberOfTestRecordsLoad)
+	{
+		std::cout << "Starting test with " << numberOfRecords << " records\n";
+		tester.measureLoadPerformance(numberOfRecords);
+		std::cout << "\n";
+	}
+	std::cout << "\n";
+}
+
+void testStringArena()
+{
+	xq::PerformanceTester tester{};
+	// Test the string arena several times
+	std::cout << "Testing String Arena\n";
+	for (uint32_t i = 0; i < cNumberOfTestExecutionsSameAmount; ++i)
+	{
+		std::cout << "Starting test #" << i + 1 << " with " << cNumberOfTestRecordsSameAmount << " records\n";
+		tester.measureStringArenaPerformance(cNumberOfTestRecordsSameAmount);
+		std::cout << "\n";
+	}
+	std::cout << "\n";
+}
+
+void testDictionaryEncoding()
+{
+	xq::PerformanceTester tester{};
+	// Test the dictionary encoding several times
+	std::cout << "Testing Dictionary Encoding\n";
+	for (uint32_t i = 0; i < cNumberOfTestExecutionsSameAmount; ++i)
+	{
+		std::cout << "Starting test #" << i + 1 << " with " << cNumberOfTestRecordsSameAmount << " records\n";
+		tester.measureDictionaryEncodingPerformance(cNumberOfTestRecordsSameAmount);
+		std::cout << "\n";
+	}
+	std::cout << "\n";
+}
+
+void testIntegerCompression()
+{
+	xq::PerformanceTester tester{};
+	// Test the integer compression several times
+	std::cout << "Testing Integer Compression\n";
+	for (uint32_t i = 0; i < cNumberOfTestExecutionsSameAmount; ++i)
+	{
+		std::cout << "Starting test #" << i + 1 << " with " << cNumberOfTestRecordsSameAmount << " records\n";
+		tester.measureIntegerCompressionPerformance(cNumberOfTestRecordsSameAmount);
+		std::cout << "\n";
+	}
+	std::cout << "\n";
+}
+
+void testZoneMaps()
+{
+	xq::PerformanceTester tester{};
+	// Test the zone maps several times
+	std::cout << "Testing Zone Maps\n";
+	for (uint32_t i = 0; i < cNumberOfTestExecutionsSameAmount; ++i)
+	{
+		std::cout << "Starting test #" << i + 1 << " with " << cNumberOfTestRecordsSameAmount << " records\n";
+		tester.measureZoneMapsPerformance(cNumberOfTestRecordsSameAmount);
+		std::cout << "\n";
+	}
+	std::cout << "\n";
+}
+
+void testSnapshot()
+{
+	xq::PerformanceTester tester{};
+	// Test the binary snapshots several times
+	std::cout << "Testing Snapshot\n";
+	for (uint32_t i = 0; i < cNumberOfTestExecutionsSameAmount; ++i)
+	{
+		std::cout << "Starting test #" << i + 1 << " with " << cNumberOfTestRecordsSameAmount << " records\n";
+		tester.measureSnapshotPerformance(cNumberOfTestRecordsSameAmount);
+		std::cout << "\n";
+	}
+	std::cout << "\n";
+}
+
+void testWriteAheadLog()
+{
+	xq::PerformanceTester tester{};
+	// Test the write-ahead log several times. Every mutation is synced with one of the sync policies, so fewer are made.
+	std::cout << "Testing Write-Ahead Log\n";
+	for (uint32_t i = 0; i < cNumberOfTestExecutionsSameAmount; ++i)
+	{
+		std::cout << "Starting test #" << i + 1 << " with " << cNumberOfTestMutationsWriteAheadLog << " records\n";
+		tester.measureWriteAheadLogPerformance(cNumberOfTestMutationsWriteAheadLog);
+		std::cout << "\n";
+	}
+	std::cout << "\n";
+}
+
+void testConcurrency()
+{
+	xq::PerformanceTester tester{};
+	// Test the concurrent reads and writes several times
+	std::cout << "Testing Concurrency\n";
+	for (uint32_t i = 0; i < cNumberOfTestExecutionsSameAmount; ++i)
+	{
+		std::cout << "Starting test #" << i + 1 << " with " << cNumberOfTestRecordsSameAmount << " records\n";
+		tester.measureConcurrencyPerformance(cNumberOfTestRecordsSameAmount);
+		std::cout << "\n";
+	}
+	std::cout << "\n";
+}
+
+void testSharding()
+{
+	xq::PerformanceTester tester{};
+	// Test the scaling of the writes several times
+	std::cout << "Testing Sharding\n";
+	for (uint32_t i = 0; i < cNumberOfTestExecutionsSameAmount; ++i)
+	{
+		std::cout << "Starting test #" << i + 1 << " with " << cNumberOfTestRecordsSameAmount << " records\n";
+		tester.measureShardingPerformance(cNumberOfTestRecordsSameAmount);
+		std::cout << "\n";
+	}
+	std::cout << "\n";
+}
+
+void testCursor()
+{
+	xq::PerformanceTester tester{};
+	// Test the cursors several times
+	std::cout << "Testing Cursor\n";
+	for (uint32_t i = 0; i < cNumberOfTestExecutionsSameAmount; ++i)
+	{
+		std::cout << "Starting test #" << i + 1 << " with " << cNumberOfTestRecordsSameAmount << " records\n";
+		tester.measureCursorPerformance(cNumberOfTestRecordsSameAmount);
+		std::cout << "\n";
+	}
+	std::cout << "\n";
+}
+
+void testTopRecords()
+{
+	xq::PerformanceTester tester{};
+	// Test the Top-K searches several times
+	std::cout << "Testing Top Records\n";
+	for (uint32_t i = 0; i < cNumberOfTestExecutionsSameAmount; ++i)
+	{
+		std::cout << "Starting test #" << i + 1 << " with " << cNumberOfTestRecordsSameAmount << " records\n";
+		tester.measureTopRecordsPerformance(cNumberOfTestRecordsSameAmount);
+		std::cout << "\n";
+	}
+	std::cout << "\n";
+}
+
+void testAggregation()
+{
+	xq::PerformanceTester tester{};
+	// Test the aggregations several times
+	std::cout << "Testing Aggregation\n";
+	for (uint32_t i = 0; i < cNumberOfTestExecutionsSameAmount; ++i)
+	{
+		std::cout << "Starting test #" << i + 1 << " with " << cNumberOfTestRecordsSameAmount << " records\n";
+		tester.measureAggregationPerformance(cNumberOfTestRecordsSameAmount);
+		std::cout << "\n";
+	}
+	std::cout << "\n";
+}
+
+void testQueryCache()
+{
+	xq::PerformanceTester tester{};
+	// Test the query cache several times
+	std::cout << "Testing Query Cache\n";
+	for (uint32_t i = 0; i < cNumberOfTestExecutionsSameAmount; ++i)
+	{
+		std::cout << "Starting test #" << i + 1 << " with " << cNumberOfTestRecordsSameAmount << " records\n";
+		tester.measureQueryCachePerformance(cNumberOfTestRecordsSameAmount);
+		std::cout << "\n";
+	}
+	std::cout << "\n";
+}
+
 int main()
 {
 	testFindMatchingRecord();
 	testRemoveRecordById();
 	testAddNewRecord();
+	testFindRecordById();
+	testStorageLayout();
+	testScanKernels();
+	testParallelScan();
+	testTrigramIndex();
+	testBalanceIndex();
+	testResultSet();
+	testQuery();
+	testCompaction();
+	testBatchOperations();
+	testLoad();
+	testStringArena();
+	testDictionaryEncoding();
+	testIntegerCompression();
+	testZoneMaps();
+	testSnapshot();
+	testWriteAheadLog();
+	testConcurrency();
+	testSharding();
+	testCursor();
+	testTopRecords();
+	testAggregation();
+	testQueryCache();
 	return 0;
 }
\ No newline at end of file
@@ -22,7 +22,8 @@ namespace xq
 
         /// @brief Setup the required data for the test.
         /// @param[]in f_numberOfRecords The number of records to be created for the test.
-        void setupTest(uint32_t f_numberOfRecords);
+        /// @param[in] f_storageLayout The storage layout of the database.
+        void setupTest(uint32_t f_numberOfRecords, DbStorageLayout f_storageLayout = DbStorageLayout::Row);
 
         std::shared_ptr<InMemoryDb> m_inMemoryDb; ///< Handle for the In-memory database
 
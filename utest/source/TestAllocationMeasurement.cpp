@@ -0,0 +1,57 @@
+/// @file TestAllocationMeasurement.cpp
+///
+/// @brief Unit tests for the AllocationMeasurement class.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "gtest/gtest.h"
+#include "AllocationMeasurement.hpp"
+
+#include <new>
+
+/// @brief Test that the allocations between the start and the stop are counted
+TEST(AllocationMeasurement, CountAllocationsSuccess)
+{
+	xq::AllocationMeasurement measurement{};
+	measurement.startMeasurement();
+	// Call the allocation functions directly, so that the compiler cannot remove the allocations
+	void* firstMemory = ::operator new(16);
+	void* secondMemory = ::operator new[](100);
+	measurement.stopMeasurement();
+	::operator delete(firstMemory);
+	::operator delete[](secondMemory);
+
+	EXPECT_EQ(measurement.getNumberOfAllocations(), 2);
+	EXPECT_EQ(measurement.getNumberOfAllocatedBytes(), 116);
+}
+
+/// @brief Test that the allocations of over-aligned memory are counted too
+TEST(AllocationMeasurement, CountAlignedAllocationsSuccess)
+{
+	ASSERT_EQ(xq::AllocationMeasurement::isEnabled(), true);
+	xq::AllocationMeasurement measurement{};
+	measurement.startMeasurement();
+	void* memory = ::operator new(100, std::align_val_t{ 64 });
+	measurement.stopMeasurement();
+	EXPECT_EQ(reinterpret_cast<uintptr_t>(memory) % 64, 0);
+	::operator delete(memory, std::align_val_t{ 64 });
+
+	EXPECT_EQ(measurement.getNumberOfAllocations(), 1);
+	EXPECT_EQ(measurement.getNumberOfAllocatedBytes(), 100);
+}
+
+/// @brief Test that nothing is counted without allocations
+TEST(AllocationMeasurement, CountNoAllocations)
+{
+	xq::AllocationMeasurement measurement{};
+	measurement.startMeasurement();
+	measurement.stopMeasurement();
+
+	EXPECT_EQ(measurement.getNumberOfAllocations(), 0);
+	testing::internal::CaptureStdout();
+	measurement.printAllocations("Nothing");
+	EXPECT_EQ(testing::internal::GetCapturedStdout(), "The operation Nothing made 0 allocations of 0 bytes\n");
+}
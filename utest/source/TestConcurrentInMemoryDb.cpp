@@ -0,0 +1,84 @@
+/// @file TestConcurrentInMemoryDb.cpp
+///
+/// @brief Unit tests for the ConcurrentInMemoryDb class.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "gtest/gtest.h"
+#include "ConcurrentInMemoryDb.hpp"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// @brief Test that the mutations are seen by the following reads
+TEST(ConcurrentInMemoryDb, ReadAndWriteSuccess)
+{
+	xq::ConcurrentInMemoryDb database{ xq::DbTestRecordCollection{ { 1, "first", 10, "address1" } } };
+	database.addRecord({ 2, "second", 20, "address2" });
+	database.addRecords({ { 3, "third", 30, "address3" }, { 4, "fourth", 40, "address4" } });
+	database.deleteRecordByID(1);
+	database.deleteRecordsByIds({ 3, 5 });
+	EXPECT_EQ(database.getNumberOfRecords(), 2);
+
+	xq::DbTableTest record{};
+	EXPECT_EQ(database.findById(1, record), false);
+	ASSERT_EQ(database.findById(4, record), true);
+	EXPECT_EQ(record.name, "fourth");
+
+	xq::DbTestRecordCollection foundRecords{};
+	database.findMatchingRecords("column3", "address", foundRecords);
+	ASSERT_EQ(foundRecords.size(), 2);
+	EXPECT_EQ(foundRecords[0].id, 2);
+
+	// Configuration changes are mutations as well
+	database.write([](xq::InMemoryDb& f_database) { f_database.enableTrigramIndex("column1"); });
+	EXPECT_EQ(database.read([](const xq::InMemoryDb& f_database) { return f_database.hasTrigramIndex("column1"); }), true);
+}
+
+/// @brief Test that concurrent readers always see whole mutations
+TEST(ConcurrentInMemoryDb, ConcurrentReadersSuccess)
+{
+	xq::ConcurrentInMemoryDb database{ xq::DbTestRecordCollection{} };
+	constexpr uint64_t cNumberOfBatches{ 200 };
+	std::atomic<bool> isWriting{ true };
+	std::atomic<uint32_t> numberOfInconsistentReads{ 0 };
+
+	// Every batch adds two records, so a reader has to see an even number of records with consecutive ids
+	std::vector<std::thread> readers{};
+	for (int readerIndex = 0; readerIndex < 4; ++readerIndex)
+	{
+		readers.emplace_back([&]() {
+			while (isWriting.load())
+			{
+				bool isConsistent = database.read([](const xq::InMemoryDb& f_database) {
+					uint64_t numberOfRecords = f_database.getNumberOfRecords();
+					return numberOfRecords % 2 == 0 &&
+						(numberOfRecords == 0 || f_database.findById(numberOfRecords) != nullptr) &&
+						f_database.findById(numberOfRecords + 1) == nullptr;
+				});
+				if (!isConsistent)
+				{
+					++numberOfInconsistentReads;
+				}
+			}
+		});
+	}
+
+	for (uint64_t batch = 0; batch < cNumberOfBatches; ++batch)
+	{
+		database.addRecords({ { 2 * batch + 1, "name", 1, "address" }, { 2 * batch + 2, "name", 2, "address" } });
+	}
+	isWriting.store(false);
+	for (auto& reader : readers)
+	{
+		reader.join();
+	}
+
+	EXPECT_EQ(numberOfInconsistentReads.load(), 0);
+	EXPECT_EQ(database.getNumberOfRecords(), 2 * cNumberOfBatches);
+}
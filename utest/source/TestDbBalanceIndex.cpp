@@ -0,0 +1,137 @@
+/// @file TestDbBalanceIndex.cpp
+///
+/// @brief Unit tests for the DbBalanceIndex class.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "gtest/gtest.h"
+#include "DbBalanceIndex.hpp"
+
+#include <limits>
+
+/// @brief Test that the records in the range are found ordered by balance and then by position
+TEST(DbBalanceIndex, FindRangeSuccess)
+{
+	xq::DbBalanceIndex balanceIndex{};
+	balanceIndex.build({ { 30, 0 }, { 10, 1 }, { 20, 2 }, { 10, 3 }, { 40, 4 } });
+	EXPECT_EQ(balanceIndex.getNumberOfEntries(), 5);
+
+	xq::DbRecordIndexesCollection output{};
+	balanceIndex.findRange(10, 30, output);
+	ASSERT_EQ(output.size(), 4);
+	EXPECT_EQ(output.at(0), 1);
+	EXPECT_EQ(output.at(1), 3);
+	EXPECT_EQ(output.at(2), 2);
+	EXPECT_EQ(output.at(3), 0);
+}
+
+/// @brief Test that nothing is found for an empty range
+TEST(DbBalanceIndex, FindRangeEmpty)
+{
+	xq::DbBalanceIndex balanceIndex{};
+	balanceIndex.build({ { 10, 0 }, { 20, 1 } });
+
+	xq::DbRecordIndexesCollection output{};
+	balanceIndex.findRange(11, 19, output);
+	EXPECT_EQ(output.size(), 0);
+	balanceIndex.findRange(20, 10, output);
+	EXPECT_EQ(output.size(), 0);
+}
+
+/// @brief Test that added and removed entries are taken into account before they are merged
+TEST(DbBalanceIndex, AddAndRemoveEntrySuccess)
+{
+	xq::DbBalanceIndex balanceIndex{};
+	balanceIndex.build({ { 10, 0 }, { 20, 1 }, { 30, 2 } });
+
+	balanceIndex.removeEntry(20, 1);
+	balanceIndex.addEntry(25, 1);
+	balanceIndex.addEntry(5, 3);
+	EXPECT_EQ(balanceIndex.getNumberOfEntries(), 4);
+
+	xq::DbRecordIndexesCollection output{};
+	balanceIndex.findRange(0, 100, output);
+	ASSERT_EQ(output.size(), 4);
+	EXPECT_EQ(output.at(0), 3);
+	EXPECT_EQ(output.at(1), 0);
+	EXPECT_EQ(output.at(2), 1);
+	EXPECT_EQ(output.at(3), 2);
+
+	// Removing an entry added after the last merge and restoring a removed one
+	balanceIndex.removeEntry(5, 3);
+	balanceIndex.removeEntry(25, 1);
+	balanceIndex.addEntry(20, 1);
+	output.clear();
+	balanceIndex.findRange(0, 100, output);
+	ASSERT_EQ(output.size(), 3);
+	EXPECT_EQ(output.at(1), 1);
+}
+
+/// @brief Test that the entries are found after the delta buffers are merged into the sorted array
+TEST(DbBalanceIndex, MergeDeltaBuffersSuccess)
+{
+	xq::DbBalanceIndex balanceIndex{};
+	for (size_t index = 0; index < 5000; ++index)
+	{
+		balanceIndex.addEntry(static_cast<int32_t>(5000 - index), index);
+	}
+	for (size_t index = 0; index < 5000; index += 2)
+	{
+		balanceIndex.removeEntry(static_cast<int32_t>(5000 - index), index);
+	}
+	EXPECT_EQ(balanceIndex.getNumberOfEntries(), 2500);
+
+	xq::DbRecordIndexesCollection output{};
+	balanceIndex.findRange(1, 10, output);
+	ASSERT_EQ(output.size(), 5);
+	EXPECT_EQ(output.at(0), 4999);
+	EXPECT_EQ(output.at(4), 4991);
+}
+
+/// @brief Test that positions beyond the 32-bit range are kept without truncation
+TEST(DbBalanceIndex, LargePositionSuccess)
+{
+	constexpr size_t const largeIndex{ static_cast<size_t>(std::numeric_limits<uint32_t>::max()) + 2 };
+	xq::DbBalanceIndex balanceIndex{};
+	balanceIndex.build({ { 10, 1 } });
+	balanceIndex.addEntry(10, largeIndex);
+
+	xq::DbRecordIndexesCollection output{};
+	balanceIndex.findRange(10, 10, output);
+	ASSERT_EQ(output.size(), 2);
+	EXPECT_EQ(output.at(0), 1);
+	EXPECT_EQ(output.at(1), largeIndex);
+
+	balanceIndex.removeEntry(10, 1);
+	output.clear();
+	balanceIndex.findRange(10, 10, output);
+	ASSERT_EQ(output.size(), 1);
+	EXPECT_EQ(output.at(0), largeIndex);
+}
+
+/// @brief Test that the entries are walked in both directions with the delta buffers and stop when asked
+TEST(DbBalanceIndex, ForEachEntrySuccess)
+{
+	xq::DbBalanceIndex balanceIndex{};
+	balanceIndex.build({ { 10, 0 }, { 20, 1 }, { 30, 2 } });
+	balanceIndex.removeEntry(20, 1);
+	balanceIndex.addEntry(25, 1);
+	balanceIndex.addEntry(5, 3);
+
+	xq::DbRecordIndexesCollection output{};
+	balanceIndex.forEachEntry(false, [&output](const xq::DbBalanceIndexEntry& f_entry) {
+		output.emplace_back(f_entry.index);
+		return true;
+	});
+	EXPECT_EQ(output, (xq::DbRecordIndexesCollection{ 3, 0, 1, 2 }));
+
+	output.clear();
+	balanceIndex.forEachEntry(true, [&output](const xq::DbBalanceIndexEntry& f_entry) {
+		output.emplace_back(f_entry.index);
+		return output.size() < 3;
+	});
+	EXPECT_EQ(output, (xq::DbRecordIndexesCollection{ 2, 1, 0 }));
+}
@@ -0,0 +1,75 @@
+/// @file TestDbColumnMatcher.cpp
+///
+/// @brief Unit tests for the compile-time column descriptors and matchers.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "gtest/gtest.h"
+#include "DbColumnMatcher.hpp"
+
+/// @brief Table with other columns than the Test table
+struct TestProduct
+{
+	std::string title;
+	uint16_t quantity;
+};
+
+typedef xq::DbColumn<TestProduct, std::string, &TestProduct::title> TestProductTitleColumn;
+typedef xq::DbColumn<TestProduct, uint16_t, &TestProduct::quantity> TestProductQuantityColumn;
+typedef xq::DbTableColumns<TestProductTitleColumn, TestProductQuantityColumn> TestProductColumns;
+
+/// @brief Test that the columns are selected by their position
+TEST(DbColumnMatcher, GetColumnIndexSuccess)
+{
+	EXPECT_EQ(TestProductColumns::cNumberOfColumns, 2);
+	EXPECT_EQ(TestProductColumns::getColumnIndex("column0"), 0);
+	EXPECT_EQ(TestProductColumns::getColumnIndex("column1"), 1);
+	// Unknown columns select the last column
+	EXPECT_EQ(TestProductColumns::getColumnIndex("column7"), 1);
+}
+
+/// @brief Test that the function is called only with the selected column
+TEST(DbColumnMatcher, VisitColumnSuccess)
+{
+	uint32_t numberOfCalls{ 0 };
+	bool isQuantityColumn{ false };
+	TestProductColumns::visitColumn("column1", [&](auto f_column) {
+		++numberOfCalls;
+		isQuantityColumn = std::is_same<decltype(f_column), TestProductQuantityColumn>::value;
+	});
+
+	EXPECT_EQ(numberOfCalls, 1);
+	EXPECT_EQ(isQuantityColumn, true);
+}
+
+/// @brief Test that any table describing its columns can be matched
+TEST(DbColumnMatcher, MatchOtherTableSuccess)
+{
+	TestProduct product{ "blue pencil", 12 };
+
+	EXPECT_EQ(xq::DbColumnMatcher<TestProductTitleColumn>{ "pen" }(product), true);
+	EXPECT_EQ(xq::DbColumnMatcher<TestProductQuantityColumn>{ "12" }(product), true);
+	EXPECT_EQ(xq::DbColumnMatcher<TestProductQuantityColumn>{ "13" }(product), false);
+
+	xq::DbTableStringMatcher<TestProductColumns> stringMatcher{ "column0", "red" };
+	EXPECT_EQ(stringMatcher.checkMatching(product), false);
+}
+
+/// @brief Test that the values, which don't fit in the type of the column, are not truncated
+TEST(DbColumnMatcher, ParseColumnValueOutOfRangeFail)
+{
+	EXPECT_EQ(xq::parseColumnValue<int32_t>("-2147483648"), std::numeric_limits<int32_t>::min());
+	EXPECT_EQ(xq::parseColumnValue<uint64_t>("18446744073709551615"), std::numeric_limits<uint64_t>::max());
+	EXPECT_EQ(xq::parseColumnValue<uint16_t>("-0"), 0);
+	EXPECT_THROW(xq::parseColumnValue<int32_t>("4294967296"), std::out_of_range);
+	EXPECT_THROW(xq::parseColumnValue<int32_t>("-2147483649"), std::out_of_range);
+	EXPECT_THROW(xq::parseColumnValue<uint64_t>("-1"), std::out_of_range);
+	EXPECT_THROW(xq::parseColumnValue<uint16_t>("65536"), std::out_of_range);
+	EXPECT_THROW(xq::parseColumnValue<int32_t>("balance"), std::invalid_argument);
+
+	// 65548 would be truncated to 12
+	EXPECT_THROW(xq::DbColumnMatcher<TestProductQuantityColumn>{ "65548" }, std::out_of_range);
+}
@@ -0,0 +1,231 @@
+/// @file TestDbIntegerColumn.cpp
+///
+/// @brief Unit tests for the DbPackedIntegerColumn and DbIntegerColumn classes.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "gtest/gtest.h"
+#include "DbIntegerColumn.hpp"
+
+#include <vector>
+
+/// @brief Test that the packed values are read back and take less memory than the plain ones
+TEST(DbPackedIntegerColumn, AppendValueSuccess)
+{
+	xq::DbPackedIntegerColumn<uint64_t> column{};
+	for (uint64_t id = 1; id <= 5000; ++id)
+	{
+		column.appendValue(id);
+	}
+	ASSERT_EQ(column.size(), 5000);
+	EXPECT_EQ(column.getValue(0), 1);
+	EXPECT_EQ(column.getValue(1023), 1024);
+	EXPECT_EQ(column.getValue(1024), 1025);
+	EXPECT_EQ(column.getValue(4999), 5000);
+	EXPECT_LT(column.getNumberOfBytes(), 5000 * sizeof(uint64_t) / 4);
+}
+
+/// @brief Test that negative values and values not fitting in the block are stored
+TEST(DbPackedIntegerColumn, SetValueSuccess)
+{
+	xq::DbPackedIntegerColumn<int32_t> column{};
+	for (int32_t balance = 0; balance < 2000; ++balance)
+	{
+		column.appendValue(balance % 100);
+	}
+	column.setValue(5, -1000);
+	column.setValue(1500, 2000000000);
+	column.setValue(6, 42);
+	EXPECT_EQ(column.getValue(5), -1000);
+	EXPECT_EQ(column.getValue(6), 42);
+	EXPECT_EQ(column.getValue(7), 7);
+	EXPECT_EQ(column.getValue(1500), 2000000000);
+	EXPECT_EQ(column.getValue(1501), 1);
+}
+
+/// @brief Test that the values after the erased one are shifted
+TEST(DbPackedIntegerColumn, EraseValueSuccess)
+{
+	xq::DbPackedIntegerColumn<uint64_t> column{};
+	for (uint64_t id = 1; id <= 3000; ++id)
+	{
+		column.appendValue(id);
+	}
+	column.eraseValue(10);
+	column.eraseValue(column.size() - 1);
+	ASSERT_EQ(column.size(), 2998);
+	EXPECT_EQ(column.getValue(9), 10);
+	EXPECT_EQ(column.getValue(10), 12);
+	EXPECT_EQ(column.getValue(1023), 1025);
+	EXPECT_EQ(column.getValue(2997), 2999);
+}
+
+/// @brief Test that the blocks after an erased value keep their values and are still scanned at the shifted positions
+TEST(DbPackedIntegerColumn, EraseValueInnerBlockSuccess)
+{
+	xq::DbPackedIntegerColumn<uint64_t> column{};
+	for (uint64_t id = 1; id <= 3000; ++id)
+	{
+		column.appendValue(id);
+	}
+	column.eraseValue(1030);
+	column.eraseValue(0);
+	ASSERT_EQ(column.size(), 2998);
+	EXPECT_EQ(column.getValue(0), 2);
+	EXPECT_EQ(column.getValue(1022), 1024);
+	EXPECT_EQ(column.getValue(1023), 1025);
+	EXPECT_EQ(column.getValue(1029), 1032);
+	EXPECT_EQ(column.getValue(2997), 3000);
+
+	xq::DbRecordIndexesCollection indexes{};
+	column.findInRange(1023, 1026, 0, column.size(), indexes);
+	EXPECT_EQ(indexes, (xq::DbRecordIndexesCollection{ 1021, 1022, 1023, 1024 }));
+	indexes.clear();
+	column.findEqual(2500, 2000, column.size(), indexes);
+	EXPECT_EQ(indexes, (xq::DbRecordIndexesCollection{ 2497 }));
+
+	column.appendValue(3001);
+	column.setValue(1500, 7);
+	EXPECT_EQ(column.getValue(2998), 3001);
+	EXPECT_EQ(column.getValue(1500), 7);
+}
+
+/// @brief Test that the cleared values read as 0 without packing their block again
+TEST(DbPackedIntegerColumn, ClearValueSuccess)
+{
+	xq::DbPackedIntegerColumn<uint64_t> column{};
+	for (uint64_t id = 1; id <= 3000; ++id)
+	{
+		column.appendValue(id);
+	}
+	size_t numberOfBytes = column.getNumberOfBytes();
+	column.clearValue(5);
+	column.clearValue(2000);
+	EXPECT_EQ(column.getValue(5), 0);
+	EXPECT_EQ(column.getValue(6), 7);
+	// Only the bitmaps of the two blocks are added, the offsets keep their width
+	EXPECT_EQ(column.getNumberOfBytes(), numberOfBytes + 2 * xq::DbPackedIntegerColumn<uint64_t>::cValuesPerBlock / 8);
+
+	xq::DbRecordIndexesCollection indexes{};
+	column.findInRange(0, 10, 0, column.size(), indexes);
+	EXPECT_EQ(indexes, (xq::DbRecordIndexesCollection{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 2000 }));
+	indexes.clear();
+	column.findEqual(6, 0, column.size(), indexes);
+	EXPECT_EQ(indexes.empty(), true);
+	indexes.clear();
+	column.findEqual(0, 1024, column.size(), indexes);
+	EXPECT_EQ(indexes, (xq::DbRecordIndexesCollection{ 2000 }));
+
+	column.setValue(5, 6);
+	column.eraseValue(4);
+	EXPECT_EQ(column.getValue(4), 6);
+	EXPECT_EQ(column.getValue(1999), 0);
+	EXPECT_EQ(column.getValue(2000), 2002);
+}
+
+/// @brief Test that the equality and range scans find the values in the checked positions
+TEST(DbPackedIntegerColumn, FindSuccess)
+{
+	xq::DbPackedIntegerColumn<int32_t> column{};
+	for (int32_t balance = 0; balance < 3000; ++balance)
+	{
+		column.appendValue(balance % 100 - 50);
+	}
+
+	xq::DbRecordIndexesCollection indexes{};
+	column.findEqual(-26, 0, column.size(), indexes);
+	EXPECT_EQ(indexes.size(), 30);
+	EXPECT_EQ(indexes.at(0), 24);
+
+	indexes.clear();
+	column.findEqual(-26, 100, 1100, indexes);
+	ASSERT_EQ(indexes.size(), 10);
+	EXPECT_EQ(indexes.at(0), 124);
+
+	indexes.clear();
+	column.findInRange(45, 1000, 0, 200, indexes);
+	EXPECT_EQ(indexes, (xq::DbRecordIndexesCollection{ 95, 96, 97, 98, 99, 195, 196, 197, 198, 199 }));
+
+	indexes.clear();
+	column.findEqual(77, 0, column.size(), indexes);
+	EXPECT_EQ(indexes.empty(), true);
+}
+
+/// @brief Test that the plain and the compressed column find the same positions
+TEST(DbIntegerColumn, EnableCompressionSuccess)
+{
+	xq::DbIntegerColumn<int32_t> column{};
+	for (int32_t balance = 0; balance < 3000; ++balance)
+	{
+		column.appendValue(balance % 100);
+	}
+	xq::DbScanKernels scanKernels{};
+	xq::DbRecordIndexesCollection plainIndexes{};
+	column.findEqual(scanKernels, 24, 1000, 3000, plainIndexes);
+
+	column.enableCompression();
+	EXPECT_EQ(column.isCompressed(), true);
+	column.appendValue(24);
+	xq::DbRecordIndexesCollection packedIndexes{};
+	column.findEqual(scanKernels, 24, 1000, 3000, packedIndexes);
+	EXPECT_EQ(packedIndexes, plainIndexes);
+	EXPECT_EQ(plainIndexes.at(0), 1024);
+	EXPECT_EQ(column.getValue(3000), 24);
+	EXPECT_EQ(column.size(), 3001);
+}
+
+/// @brief Test that the positions cleared before the compression are not packed
+TEST(DbIntegerColumn, EnableCompressionClearedSuccess)
+{
+	xq::DbIntegerColumn<uint64_t> column{};
+	for (uint64_t id = 1; id <= 2000; ++id)
+	{
+		column.appendValue(id);
+	}
+	column.clearValue(10);
+	EXPECT_EQ(column.getValue(10), 0);
+
+	column.enableCompression({ 10 });
+	EXPECT_EQ(column.getValue(10), 0);
+	EXPECT_EQ(column.getValue(11), 12);
+	column.clearValue(11);
+	EXPECT_EQ(column.getValue(11), 0);
+
+	xq::DbScanKernels scanKernels{};
+	xq::DbRecordIndexesCollection indexes{};
+	column.findEqual(scanKernels, 0, 0, column.size(), indexes);
+	EXPECT_EQ(indexes, (xq::DbRecordIndexesCollection{ 10, 11 }));
+}
+
+/// @brief Test that the mapped values are used in place until the first modification
+TEST(DbIntegerColumn, MapValuesSuccess)
+{
+	std::vector<int32_t> balances{ 7, 3, 7, 1 };
+	xq::DbIntegerColumn<int32_t> column{};
+	column.appendValue(42);
+	column.mapValues(balances.data(), balances.size());
+	EXPECT_EQ(column.size(), 4);
+	EXPECT_EQ(column.getPlainValues(), balances.data());
+	EXPECT_EQ(column.getNumberOfBytes(), 0);
+
+	xq::DbScanKernels scanKernels{};
+	xq::DbRecordIndexesCollection indexes{};
+	column.findEqual(scanKernels, 7, 0, column.size(), indexes);
+	EXPECT_EQ(indexes, (xq::DbRecordIndexesCollection{ 0, 2 }));
+
+	column.setValue(1, 7);
+	EXPECT_NE(column.getPlainValues(), balances.data());
+	EXPECT_EQ(balances.at(1), 3);
+	EXPECT_EQ(column.getValue(1), 7);
+	EXPECT_EQ(column.getValue(3), 1);
+
+	// A compressed column packs the mapped values
+	xq::DbIntegerColumn<int32_t> compressedColumn{};
+	compressedColumn.enableCompression();
+	compressedColumn.mapValues(balances.data(), balances.size());
+	EXPECT_EQ(compressedColumn.size(), 4);
+	EXPECT_EQ(compressedColumn.getValue(2), 7);
+}
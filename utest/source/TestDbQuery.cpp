@@ -0,0 +1,25 @@
+/// @file TestDbQuery.cpp
+///
+/// @brief Unit tests for the DbQuery class.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "gtest/gtest.h"
+#include "DbQuery.hpp"
+
+/// @brief Test that the predicates are kept in the order they were added
+TEST(DbQuery, AddPredicateSuccess)
+{
+	xq::DbQuery query{};
+	EXPECT_EQ(query.getPredicates().empty(), true);
+
+	query.addPredicate("column1", "testdata").addPredicate("column2", "88");
+	ASSERT_EQ(query.getPredicates().size(), 2);
+	EXPECT_EQ(query.getPredicates().at(0).columnName, "column1");
+	EXPECT_EQ(query.getPredicates().at(0).matchString, "testdata");
+	EXPECT_EQ(query.getPredicates().at(1).columnName, "column2");
+	EXPECT_EQ(query.getPredicates().at(1).matchString, "88");
+}
@@ -0,0 +1,69 @@
+/// @file TestDbQueryCache.cpp
+///
+/// @brief Unit tests for the DbQueryCache class.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "gtest/gtest.h"
+#include "DbQueryCache.hpp"
+
+#include <memory>
+
+/// @brief Test that the stored results are found and counted as hits and misses
+TEST(DbQueryCache, FindResultSuccess)
+{
+	xq::DbQueryCache queryCache{ 100 };
+	xq::DbCachedResult result{};
+	EXPECT_EQ(queryCache.findResult("1:name", 1, result), false);
+
+	queryCache.storeResult("1:name", 1, std::make_shared<xq::DbRecordIndexesCollection>(xq::DbRecordIndexesCollection{ 3, 5 }));
+	ASSERT_EQ(queryCache.findResult("1:name", 1, result), true);
+	EXPECT_EQ(*result, (xq::DbRecordIndexesCollection{ 3, 5 }));
+	EXPECT_EQ(queryCache.getNumberOfHits(), 1);
+	EXPECT_EQ(queryCache.getNumberOfMisses(), 1);
+	EXPECT_EQ(queryCache.getNumberOfEntries(), 1);
+}
+
+/// @brief Test that a newer version of the records drops all the results
+TEST(DbQueryCache, NewerVersionInvalidates)
+{
+	xq::DbQueryCache queryCache{ 100 };
+	queryCache.storeResult("1:name", 1, std::make_shared<xq::DbRecordIndexesCollection>(xq::DbRecordIndexesCollection{ 3 }));
+	queryCache.storeResult("2:7", 1, std::make_shared<xq::DbRecordIndexesCollection>());
+
+	xq::DbCachedResult result{};
+	EXPECT_EQ(queryCache.findResult("1:name", 2, result), false);
+	EXPECT_EQ(queryCache.getNumberOfEntries(), 0);
+
+	// A result of the older version is not stored anymore
+	queryCache.storeResult("1:name", 1, std::make_shared<xq::DbRecordIndexesCollection>(xq::DbRecordIndexesCollection{ 3 }));
+	EXPECT_EQ(queryCache.findResult("1:name", 2, result), false);
+	EXPECT_EQ(queryCache.getNumberOfMisses(), 2);
+}
+
+/// @brief Test that the least recently used results are dropped when the cache is full
+TEST(DbQueryCache, LeastRecentlyUsedEvicted)
+{
+	// Every result takes its positions plus one
+	xq::DbQueryCache queryCache{ 6 };
+	queryCache.storeResult("a", 1, std::make_shared<xq::DbRecordIndexesCollection>(xq::DbRecordIndexesCollection{ 1 }));
+	queryCache.storeResult("b", 1, std::make_shared<xq::DbRecordIndexesCollection>(xq::DbRecordIndexesCollection{ 2 }));
+	queryCache.storeResult("c", 1, std::make_shared<xq::DbRecordIndexesCollection>(xq::DbRecordIndexesCollection{ 3 }));
+
+	xq::DbCachedResult result{};
+	EXPECT_EQ(queryCache.findResult("a", 1, result), true);
+	queryCache.storeResult("d", 1, std::make_shared<xq::DbRecordIndexesCollection>(xq::DbRecordIndexesCollection{ 4 }));
+	EXPECT_EQ(queryCache.getNumberOfEntries(), 3);
+	EXPECT_EQ(queryCache.findResult("b", 1, result), false);
+	EXPECT_EQ(queryCache.findResult("a", 1, result), true);
+	EXPECT_EQ(queryCache.findResult("c", 1, result), true);
+	EXPECT_EQ(queryCache.findResult("d", 1, result), true);
+
+	// A result larger than the whole cache is not stored
+	queryCache.storeResult("e", 1, std::make_shared<xq::DbRecordIndexesCollection>(xq::DbRecordIndexesCollection(6, 0)));
+	EXPECT_EQ(queryCache.findResult("e", 1, result), false);
+	EXPECT_EQ(queryCache.getNumberOfEntries(), 3);
+}
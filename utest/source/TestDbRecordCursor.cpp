@@ -0,0 +1,53 @@
+/// @file TestDbRecordCursor.cpp
+///
+/// @brief Unit tests for the DbRecordCursor class.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "gtest/gtest.h"
+#include "DbRecordCursor.hpp"
+
+/// @brief Test that the cursor returns the matching records one by one and skips the deleted ones
+TEST(DbRecordCursor, NextSuccess)
+{
+	xq::DbTestRecordCollection records{
+		{ 1, "match", 1, "address" },
+		{ 0, "match", 2, "address" },
+		{ 3, "other", 3, "address" },
+		{ 4, "match", 4, "address" } };
+	xq::DbTableTestMatchersCollection matchers{};
+	matchers.emplace_back("column1", "match");
+	xq::DbRecordCursor cursor{ records, std::move(matchers), xq::DbRecordIndexesCollection{}, false, xq::DbRecordCursor::cNoLimit };
+
+	const xq::DbTableTest* record = cursor.next();
+	ASSERT_NE(record, nullptr);
+	EXPECT_EQ(record->id, 1);
+	record = cursor.next();
+	ASSERT_NE(record, nullptr);
+	EXPECT_EQ(record->id, 4);
+	EXPECT_EQ(cursor.isExhausted(), true);
+	EXPECT_EQ(cursor.next(), nullptr);
+}
+
+/// @brief Test that the cursor walks only the candidates and stops at the limit
+TEST(DbRecordCursor, FetchCandidatesWithLimitSuccess)
+{
+	xq::DbTestRecordCollection records{};
+	for (uint64_t id = 1; id <= 10; ++id)
+	{
+		records.push_back({ id, "name", static_cast<int32_t>(id), "address" });
+	}
+	xq::DbRecordCursor cursor{ records, xq::DbTableTestMatchersCollection{}, xq::DbRecordIndexesCollection{ 1, 3, 5, 7 }, true, 3 };
+
+	xq::DbTestRecordPointersCollection batch{};
+	ASSERT_EQ(cursor.fetch(batch, 2), 2);
+	EXPECT_EQ(batch[0]->id, 2);
+	EXPECT_EQ(batch[1]->id, 4);
+	ASSERT_EQ(cursor.fetch(batch, 2), 1);
+	EXPECT_EQ(batch[0]->id, 6);
+	EXPECT_EQ(cursor.isExhausted(), true);
+	EXPECT_EQ(cursor.fetch(batch, 2), 0);
+}
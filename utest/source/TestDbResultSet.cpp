@@ -0,0 +1,76 @@
+/// @file TestDbResultSet.cpp
+///
+/// @brief Unit tests for the DbResultSet class.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "gtest/gtest.h"
+#include "DbResultSet.hpp"
+
+#include <vector>
+
+/// @brief Test that the added records are counted and iterated in ascending order
+TEST(DbResultSet, AddRecordSuccess)
+{
+	xq::DbResultSet resultSet{ 200 };
+	EXPECT_EQ(resultSet.empty(), true);
+
+	resultSet.addRecord(130);
+	resultSet.addRecord(0);
+	resultSet.addRecord(63);
+	resultSet.addRecord(64);
+	resultSet.addRecord(199);
+	EXPECT_EQ(resultSet.count(), 5);
+	EXPECT_EQ(resultSet.containsRecord(63), true);
+	EXPECT_EQ(resultSet.containsRecord(65), false);
+	EXPECT_EQ(resultSet.containsRecord(1000), false);
+
+	std::vector<size_t> indexes(resultSet.begin(), resultSet.end());
+	EXPECT_EQ(indexes, (std::vector<size_t>{ 0, 63, 64, 130, 199 }));
+}
+
+/// @brief Test that resetting removes all the records
+TEST(DbResultSet, ResetSuccess)
+{
+	xq::DbResultSet resultSet{ 100 };
+	resultSet.addRecord(10);
+	resultSet.reset(50);
+
+	EXPECT_EQ(resultSet.empty(), true);
+	EXPECT_EQ(resultSet.getNumberOfRecords(), 50);
+	EXPECT_EQ(resultSet.begin() == resultSet.end(), true);
+}
+
+/// @brief Test that only the records found in both result sets are kept after an intersection
+TEST(DbResultSet, IntersectWithSuccess)
+{
+	xq::DbResultSet firstResultSet{ 300 };
+	firstResultSet.addRecord(5);
+	firstResultSet.addRecord(100);
+	firstResultSet.addRecord(250);
+	xq::DbResultSet secondResultSet{ 200 };
+	secondResultSet.addRecord(100);
+	secondResultSet.addRecord(150);
+
+	firstResultSet.intersectWith(secondResultSet);
+	std::vector<size_t> indexes(firstResultSet.begin(), firstResultSet.end());
+	EXPECT_EQ(indexes, (std::vector<size_t>{ 100 }));
+}
+
+/// @brief Test that the records of both result sets are kept after a union
+TEST(DbResultSet, UniteWithSuccess)
+{
+	xq::DbResultSet firstResultSet{ 100 };
+	firstResultSet.addRecord(5);
+	xq::DbResultSet secondResultSet{ 300 };
+	secondResultSet.addRecord(5);
+	secondResultSet.addRecord(250);
+
+	firstResultSet.uniteWith(secondResultSet);
+	EXPECT_EQ(firstResultSet.getNumberOfRecords(), 300);
+	std::vector<size_t> indexes(firstResultSet.begin(), firstResultSet.end());
+	EXPECT_EQ(indexes, (std::vector<size_t>{ 5, 250 }));
+}
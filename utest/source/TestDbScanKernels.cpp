@@ -0,0 +1,101 @@
+/// @file TestDbScanKernels.cpp
+///
+/// @brief Unit tests for the DbScanKernels class.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "gtest/gtest.h"
+#include "DbScanKernels.hpp"
+
+/// @brief Test that the scalar kernel is always supported and selected when requested
+TEST(DbScanKernels, ScalarKernelSupported)
+{
+	EXPECT_EQ(xq::DbScanKernels::isKernelSupported(xq::DbScanKernelType::Scalar), true);
+
+	xq::DbScanKernels scanKernels{ xq::DbScanKernelType::Scalar };
+	EXPECT_EQ(scanKernels.getKernelType(), xq::DbScanKernelType::Scalar);
+}
+
+/// @brief Test that every supported kernel finds the same balances, including the ones
+/// after the last complete block of values
+TEST(DbScanKernels, FindEqualBalanceAllKernels)
+{
+	std::vector<int32_t> balances{};
+	for (int32_t i = 0; i < 1000; ++i)
+	{
+		balances.emplace_back(i % 7);
+	}
+
+	for (auto kernelType : { xq::DbScanKernelType::Scalar, xq::DbScanKernelType::Sse42, xq::DbScanKernelType::Avx2 })
+	{
+		xq::DbScanKernels scanKernels{ kernelType };
+		xq::DbRecordIndexesCollection output{};
+		scanKernels.findEqual(balances.data(), balances.size(), 3, output);
+
+		ASSERT_EQ(output.size(), 143);
+		for (size_t i = 0; i < output.size(); ++i)
+		{
+			EXPECT_EQ(output.at(i), i * 7 + 3);
+		}
+	}
+}
+
+/// @brief Test that every supported kernel finds a single id in the last incomplete block
+TEST(DbScanKernels, FindEqualIdAllKernels)
+{
+	std::vector<uint64_t> ids{};
+	for (uint64_t i = 1; i <= 1000; ++i)
+	{
+		ids.emplace_back(i);
+	}
+
+	for (auto kernelType : { xq::DbScanKernelType::Scalar, xq::DbScanKernelType::Sse42, xq::DbScanKernelType::Avx2 })
+	{
+		xq::DbScanKernels scanKernels{ kernelType };
+		xq::DbRecordIndexesCollection output{};
+		scanKernels.findEqual(ids.data(), ids.size(), 999, output);
+
+		ASSERT_EQ(output.size(), 1);
+		EXPECT_EQ(output.at(0), 998);
+	}
+}
+
+/// @brief Test that no positions are found if no value matches
+TEST(DbScanKernels, FindEqualNotFound)
+{
+	std::vector<uint64_t> ids(100, 1);
+	xq::DbScanKernels scanKernels{};
+	xq::DbRecordIndexesCollection output{};
+	scanKernels.findEqual(ids.data(), ids.size(), 2, output);
+
+	EXPECT_EQ(output.size(), 0);
+}
+
+/// @brief Test that every supported kernel aggregates the same balances, skipping the deleted records
+/// and including the ones after the last complete block of values
+TEST(DbScanKernels, AggregateAllKernels)
+{
+	std::vector<int32_t> balances{};
+	std::vector<uint64_t> ids{};
+	for (int32_t i = 0; i < 1001; ++i)
+	{
+		balances.emplace_back(i - 500);
+		// Every third record is deleted, including the one with the smallest balance
+		ids.emplace_back(i % 3 == 0 ? 0 : static_cast<uint64_t>(i) + 1);
+	}
+
+	for (auto kernelType : { xq::DbScanKernelType::Scalar, xq::DbScanKernelType::Sse42, xq::DbScanKernelType::Avx2 })
+	{
+		xq::DbScanKernels scanKernels{ kernelType };
+		xq::DbAggregate aggregate{};
+		scanKernels.aggregate(balances.data(), ids.data(), balances.size(), aggregate);
+
+		EXPECT_EQ(aggregate.count, 667);
+		EXPECT_EQ(aggregate.sum, 167);
+		EXPECT_EQ(aggregate.minimum, -499);
+		EXPECT_EQ(aggregate.maximum, 500);
+	}
+}
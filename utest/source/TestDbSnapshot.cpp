@@ -0,0 +1,92 @@
+/// @file TestDbSnapshot.cpp
+///
+/// @brief Unit tests for the DbSnapshot class.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "gtest/gtest.h"
+#include "DbSnapshot.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+/// @brief Test that the columns of a written snapshot are read in place and deleted records are skipped
+TEST(DbSnapshot, WriteAndOpenSuccess)
+{
+	xq::DbTestRecordCollection records{
+		{ 1, "first", -10, "first address" },
+		{ 0, "deleted", 0, "deleted address" },
+		{ 3, "", 30, "third address" } };
+	std::string path = testing::TempDir() + "DbSnapshotWriteAndOpen.xqdb";
+	ASSERT_EQ(xq::DbSnapshot::write(path, records), true);
+
+	xq::DbSnapshot snapshot{};
+	ASSERT_EQ(snapshot.open(path), true);
+	ASSERT_EQ(snapshot.getNumberOfRecords(), 2);
+	EXPECT_EQ(snapshot.getIds()[0], 1);
+	EXPECT_EQ(snapshot.getIds()[1], 3);
+	EXPECT_EQ(snapshot.getBalances()[0], -10);
+	EXPECT_EQ(snapshot.getBalances()[1], 30);
+	EXPECT_EQ(snapshot.getName(0), "first");
+	EXPECT_EQ(snapshot.getName(1), "");
+	EXPECT_EQ(snapshot.getAddress(1), "third address");
+
+	xq::DbTestRecordCollection readRecords{};
+	ASSERT_EQ(snapshot.readRecords(readRecords), true);
+	ASSERT_EQ(readRecords.size(), 2);
+	EXPECT_EQ(readRecords[0].id, 1);
+	EXPECT_EQ(readRecords[0].name, "first");
+	EXPECT_EQ(readRecords[0].address, "first address");
+	EXPECT_EQ(readRecords[1].balance, 30);
+	std::remove(path.c_str());
+}
+
+/// @brief Test that an empty collection gives a valid snapshot
+TEST(DbSnapshot, WriteEmptySuccess)
+{
+	std::string path = testing::TempDir() + "DbSnapshotWriteEmpty.xqdb";
+	ASSERT_EQ(xq::DbSnapshot::write(path, xq::DbTestRecordCollection{}), true);
+
+	xq::DbSnapshot snapshot{};
+	ASSERT_EQ(snapshot.open(path), true);
+	EXPECT_EQ(snapshot.getNumberOfRecords(), 0);
+	xq::DbTestRecordCollection readRecords{};
+	EXPECT_EQ(snapshot.readRecords(readRecords), true);
+	EXPECT_EQ(readRecords.size(), 0);
+	std::remove(path.c_str());
+}
+
+/// @brief Test that missing, foreign and truncated files are not opened
+TEST(DbSnapshot, OpenInvalidFileFail)
+{
+	xq::DbSnapshot snapshot{};
+	std::string path = testing::TempDir() + "DbSnapshotOpenInvalidFile.xqdb";
+	std::remove(path.c_str());
+	EXPECT_EQ(snapshot.open(path), false);
+
+	{
+		std::ofstream file{ path, std::ios::binary };
+		file << "Not a snapshot, but long enough to contain a header of a snapshot";
+	}
+	EXPECT_EQ(snapshot.open(path), false);
+
+	// Cut off the last array of a valid snapshot
+	xq::DbTestRecordCollection records{ { 1, "name", 1, "address" } };
+	ASSERT_EQ(xq::DbSnapshot::write(path, records), true);
+	std::string content{};
+	{
+		std::ifstream file{ path, std::ios::binary };
+		content.assign(std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{});
+	}
+	{
+		std::ofstream file{ path, std::ios::binary | std::ios::trunc };
+		file.write(content.data(), static_cast<std::streamsize>(content.size() - 8));
+	}
+	EXPECT_EQ(snapshot.open(path), false);
+	EXPECT_EQ(snapshot.getNumberOfRecords(), 0);
+	std::remove(path.c_str());
+}
@@ -0,0 +1,143 @@
+/// @file TestDbStringArena.cpp
+///
+/// @brief Unit tests for the DbStringArena and DbStringColumn classes.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "gtest/gtest.h"
+#include "DbStringArena.hpp"
+
+#include <string>
+
+/// @brief Test that the added strings are stored next to each other and can be read back
+TEST(DbStringArena, AddStringSuccess)
+{
+	xq::DbStringArena arena{};
+	auto firstView = arena.addString("testdata1");
+	auto secondView = arena.addString("");
+	auto thirdView = arena.addString("1testdata");
+
+	EXPECT_EQ(arena.getString(firstView), "testdata1");
+	EXPECT_EQ(arena.getString(secondView), "");
+	EXPECT_EQ(arena.getString(thirdView), "1testdata");
+	EXPECT_EQ(thirdView.slab, firstView.slab);
+	EXPECT_EQ(thirdView.offset, firstView.offset + firstView.length);
+	EXPECT_EQ(arena.getNumberOfSlabs(), 1);
+	EXPECT_EQ(arena.getNumberOfUsedBytes(), 18);
+}
+
+/// @brief Test that new slabs are allocated when the current one is full and for long strings
+TEST(DbStringArena, AddStringNewSlabSuccess)
+{
+	xq::DbStringArena arena{};
+	std::string longString(100000, 'a');
+	auto longView = arena.addString(longString);
+	auto shortView = arena.addString("testdata1");
+	EXPECT_EQ(arena.getNumberOfSlabs(), 2);
+	EXPECT_EQ(shortView.slab, 1);
+	EXPECT_EQ(arena.getString(longView), longString);
+	EXPECT_EQ(arena.getString(shortView), "testdata1");
+
+	arena.clear();
+	EXPECT_EQ(arena.getNumberOfSlabs(), 0);
+	EXPECT_EQ(arena.getNumberOfUsedBytes(), 0);
+}
+
+/// @brief Test that the strings of the column are replaced and removed
+TEST(DbStringColumn, SetAndEraseStringSuccess)
+{
+	xq::DbStringColumn column{};
+	column.appendString("testdata1");
+	column.appendString("testdata2");
+	column.appendString("testdata3");
+
+	column.setString(1, "newdata2");
+	column.eraseString(0);
+	ASSERT_EQ(column.size(), 2);
+	EXPECT_EQ(column.getString(0), "newdata2");
+	EXPECT_EQ(column.getString(1), "testdata3");
+
+	column.clear();
+	EXPECT_EQ(column.size(), 0);
+}
+
+/// @brief Test that the unused bytes are freed when they become more than the used ones
+TEST(DbStringColumn, RepackSuccess)
+{
+	xq::DbStringColumn column{};
+	std::string longString(4096, 'a');
+	for (uint32_t i = 0; i < 1000; ++i)
+	{
+		column.appendString(longString + std::to_string(i));
+	}
+	size_t usedBytes = column.getArena().getNumberOfUsedBytes();
+
+	// Replacing all the strings once makes half of the bytes unused
+	for (uint32_t i = 0; i < 1000; ++i)
+	{
+		column.setString(i, "testdata" + std::to_string(i));
+	}
+	EXPECT_LT(column.getArena().getNumberOfUsedBytes(), usedBytes);
+	EXPECT_EQ(column.getString(0), "testdata0");
+	EXPECT_EQ(column.getString(999), "testdata999");
+}
+
+/// @brief Test that the dictionary encoding stores every distinct string once
+TEST(DbStringColumn, DictionaryEncodingSuccess)
+{
+	xq::DbStringColumn column{};
+	column.appendString("Sofia");
+	column.appendString("Plovdiv");
+	column.appendString("Sofia");
+	column.enableDictionaryEncoding();
+	EXPECT_EQ(column.isDictionaryEncoded(), true);
+
+	column.appendString("Varna");
+	column.appendString("Plovdiv");
+	ASSERT_EQ(column.size(), 5);
+	EXPECT_EQ(column.getDictionarySize(), 3);
+	EXPECT_EQ(column.getCodes(), (xq::DbStringCodesCollection{ 0, 1, 0, 2, 1 }));
+	EXPECT_EQ(column.getDictionaryString(2), "Varna");
+	EXPECT_EQ(column.getString(4), "Plovdiv");
+
+	column.setString(0, "Varna");
+	column.eraseString(1);
+	ASSERT_EQ(column.size(), 4);
+	EXPECT_EQ(column.getString(0), "Varna");
+	EXPECT_EQ(column.getString(1), "Sofia");
+	EXPECT_EQ(column.getDictionarySize(), 3);
+}
+
+/// @brief Test that the mapped strings are used in place until the first modification
+TEST(DbStringColumn, MapStringsSuccess)
+{
+	const uint64_t offsets[]{ 0, 5, 12, 17 };
+	const char characters[]{ "SofiaPlovdivVarna" };
+	xq::DbStringColumn column{};
+	column.appendString("Burgas");
+	column.mapStrings(offsets, characters, 3);
+	ASSERT_EQ(column.size(), 3);
+	EXPECT_EQ(column.getString(1), "Plovdiv");
+	EXPECT_EQ(column.getString(1).data(), characters + 5);
+	EXPECT_EQ(column.getArena().getNumberOfUsedBytes(), 0);
+
+	column.setString(0, "Burgas");
+	EXPECT_EQ(column.getString(0), "Burgas");
+	EXPECT_EQ(column.getString(2), "Varna");
+	EXPECT_NE(column.getString(2).data(), characters + 12);
+
+	// A dictionary encoded column encodes the mapped strings
+	xq::DbStringColumn encodedColumn{};
+	encodedColumn.enableDictionaryEncoding();
+	encodedColumn.mapStrings(offsets, characters, 3);
+	EXPECT_EQ(encodedColumn.getDictionarySize(), 3);
+	EXPECT_EQ(encodedColumn.getString(2), "Varna");
+
+	xq::DbStringColumn laterEncodedColumn{};
+	laterEncodedColumn.mapStrings(offsets, characters, 3);
+	laterEncodedColumn.enableDictionaryEncoding();
+	EXPECT_EQ(laterEncodedColumn.getCodes(), (xq::DbStringCodesCollection{ 0, 1, 2 }));
+}
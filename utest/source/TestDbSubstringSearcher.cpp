@@ -0,0 +1,78 @@
+/// @file TestDbSubstringSearcher.cpp
+///
+/// @brief Unit tests for the DbSubstringSearcher class.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "gtest/gtest.h"
+#include "DbSubstringSearcher.hpp"
+
+/// @brief Test that the empty pattern is found in every text
+TEST(DbSubstringSearcher, EmptyPatternFound)
+{
+	xq::DbSubstringSearcher substringSearcher{};
+
+	EXPECT_EQ(substringSearcher.isFoundIn("88testdata"), true);
+	EXPECT_EQ(substringSearcher.isFoundIn(""), true);
+}
+
+/// @brief Test that a short pattern is found at the beginning, in the middle and at the end of a text
+TEST(DbSubstringSearcher, ShortPatternFound)
+{
+	xq::DbSubstringSearcher substringSearcher{ "88" };
+
+	EXPECT_EQ(substringSearcher.isFoundIn("88testdata"), true);
+	EXPECT_EQ(substringSearcher.isFoundIn("testdata88"), true);
+	EXPECT_EQ(substringSearcher.isFoundIn("test88data"), true);
+	EXPECT_EQ(substringSearcher.isFoundIn("88"), true);
+}
+
+/// @brief Test that a short pattern is not found if only its first or last character matches
+TEST(DbSubstringSearcher, ShortPatternNotFound)
+{
+	xq::DbSubstringSearcher substringSearcher{ "tesd" };
+
+	EXPECT_EQ(substringSearcher.isFoundIn("testdata88"), false);
+	EXPECT_EQ(substringSearcher.isFoundIn("tes"), false);
+	EXPECT_EQ(substringSearcher.isFoundIn(""), false);
+}
+
+/// @brief Test that a single character is found
+TEST(DbSubstringSearcher, SingleCharacterFound)
+{
+	xq::DbSubstringSearcher substringSearcher{ "d" };
+
+	EXPECT_EQ(substringSearcher.isFoundIn("testdata88"), true);
+	EXPECT_EQ(substringSearcher.isFoundIn("test88"), false);
+}
+
+/// @brief Test that a long pattern is found with the Boyer-Moore-Horspool algorithm
+TEST(DbSubstringSearcher, LongPatternFound)
+{
+	xq::DbSubstringSearcher substringSearcher{ "testdata1000000street" };
+
+	EXPECT_EQ(substringSearcher.isFoundIn("88testdata1000000street"), true);
+	EXPECT_EQ(substringSearcher.isFoundIn("testdata1000000streettestdata"), true);
+	EXPECT_EQ(substringSearcher.isFoundIn("testdata1000000stree"), false);
+	EXPECT_EQ(substringSearcher.isFoundIn("testdata1000001street testdata1000000streeT"), false);
+}
+
+/// @brief Test that the searcher finds the same as std::string::find for all the substrings of a text
+TEST(DbSubstringSearcher, SameAsStringFind)
+{
+	const std::string text{ "aabaabaaabbbabababaabbaaabbbaaabababbabababbaaaabababa" };
+	const std::string otherText{ "bbabaaababbbbabaabaababbbbabaabaabaaabbbaaabbbabbbababab" };
+	for (size_t begin = 0; begin < text.size(); ++begin)
+	{
+		for (size_t length = 1; begin + length <= text.size(); ++length)
+		{
+			auto pattern = text.substr(begin, length);
+			xq::DbSubstringSearcher substringSearcher{ pattern };
+			EXPECT_EQ(substringSearcher.isFoundIn(text), true);
+			EXPECT_EQ(substringSearcher.isFoundIn(otherText), otherText.find(pattern) != std::string::npos);
+		}
+	}
+}
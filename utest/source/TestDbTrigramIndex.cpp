@@ -0,0 +1,121 @@
+/// @file TestDbTrigramIndex.cpp
+///
+/// @brief Unit tests for the DbTrigramIndex class.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "gtest/gtest.h"
+#include "DbTrigramIndex.hpp"
+
+/// @brief Test that the records containing all the trigrams are found in ascending order
+TEST(DbTrigramIndex, FindCandidatesSuccess)
+{
+	xq::DbTrigramIndex trigramIndex{};
+	trigramIndex.addString(2, "testdata88");
+	trigramIndex.addString(0, "testdata8");
+	trigramIndex.addString(1, "88testdata");
+
+	xq::DbRecordIndexesCollection output{};
+	EXPECT_EQ(trigramIndex.findCandidates("data8", output), true);
+	ASSERT_EQ(output.size(), 2);
+	EXPECT_EQ(output.at(0), 0);
+	EXPECT_EQ(output.at(1), 2);
+}
+
+/// @brief Test that the candidates might contain the trigrams in a different order
+TEST(DbTrigramIndex, FindCandidatesDifferentOrder)
+{
+	xq::DbTrigramIndex trigramIndex{};
+	trigramIndex.addString(0, "abcdbcde");
+
+	xq::DbRecordIndexesCollection output{};
+	EXPECT_EQ(trigramIndex.findCandidates("abcde", output), true);
+	EXPECT_EQ(output.size(), 1);
+}
+
+/// @brief Test that the index cannot be used for strings shorter than a trigram
+TEST(DbTrigramIndex, FindCandidatesShortString)
+{
+	xq::DbTrigramIndex trigramIndex{};
+	trigramIndex.addString(0, "testdata88");
+
+	xq::DbRecordIndexesCollection output{};
+	EXPECT_EQ(trigramIndex.findCandidates("88", output), false);
+}
+
+/// @brief Test that removed strings are not found anymore and their unused trigrams are dropped
+TEST(DbTrigramIndex, RemoveStringSuccess)
+{
+	xq::DbTrigramIndex trigramIndex{};
+	trigramIndex.addString(0, "abcd");
+	trigramIndex.addString(1, "abce");
+	EXPECT_EQ(trigramIndex.getNumberOfTrigrams(), 3);
+
+	trigramIndex.removeString(0, "abcd");
+	EXPECT_EQ(trigramIndex.getNumberOfTrigrams(), 2);
+
+	xq::DbRecordIndexesCollection output{};
+	EXPECT_EQ(trigramIndex.findCandidates("abc", output), true);
+	ASSERT_EQ(output.size(), 1);
+	EXPECT_EQ(output.at(0), 1);
+}
+
+/// @brief Test that a position removed and added again in the middle of the posting lists is found again
+TEST(DbTrigramIndex, ReuseRemovedPositionSuccess)
+{
+	xq::DbTrigramIndex trigramIndex{};
+	trigramIndex.addString(0, "abcd");
+	trigramIndex.addString(1, "abcd");
+	trigramIndex.addString(2, "abcd");
+
+	trigramIndex.removeString(1, "abcd");
+	trigramIndex.addString(1, "xabc");
+	trigramIndex.addString(1, "xabc");
+
+	xq::DbRecordIndexesCollection output{};
+	EXPECT_EQ(trigramIndex.findCandidates("abc", output), true);
+	EXPECT_EQ(output, (xq::DbRecordIndexesCollection{ 0, 1, 2 }));
+
+	output.clear();
+	EXPECT_EQ(trigramIndex.findCandidates("abcd", output), true);
+	EXPECT_EQ(output, (xq::DbRecordIndexesCollection{ 0, 2 }));
+}
+
+/// @brief Test that many changes in the middle of the posting lists, which are merged into them, keep all the positions
+TEST(DbTrigramIndex, ManyMiddleChangesSuccess)
+{
+	constexpr size_t const numberOfRecords{ 1000 };
+	xq::DbTrigramIndex trigramIndex{};
+	for (size_t i = 0; i < numberOfRecords; ++i)
+	{
+		trigramIndex.addString(i, i % 2 == 0 ? "abcd" : "abce");
+	}
+
+	// Swap the strings of every third record
+	xq::DbRecordIndexesCollection expected{};
+	for (size_t i = 0; i < numberOfRecords; ++i)
+	{
+		bool isEven = i % 2 == 0;
+		if (i % 3 == 0)
+		{
+			trigramIndex.removeString(i, isEven ? "abcd" : "abce");
+			trigramIndex.addString(i, isEven ? "abce" : "abcd");
+			isEven = !isEven;
+		}
+		if (isEven)
+		{
+			expected.emplace_back(i);
+		}
+	}
+
+	xq::DbRecordIndexesCollection output{};
+	EXPECT_EQ(trigramIndex.findCandidates("abcd", output), true);
+	EXPECT_EQ(output, expected);
+
+	output.clear();
+	EXPECT_EQ(trigramIndex.findCandidates("abc", output), true);
+	EXPECT_EQ(output.size(), numberOfRecords);
+}
@@ -0,0 +1,115 @@
+/// @file TestDbWriteAheadLog.cpp
+///
+/// @brief Unit tests for the DbWriteAheadLog class.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "gtest/gtest.h"
+#include "DbWriteAheadLog.hpp"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+/// @brief Test that the committed entries are read back in order
+TEST(DbWriteAheadLog, AppendAndReadSuccess)
+{
+	std::string path = testing::TempDir() + "DbWriteAheadLogAppendAndRead.wal";
+	std::remove(path.c_str());
+	{
+		xq::DbWriteAheadLog writeAheadLog{};
+		ASSERT_EQ(writeAheadLog.open(path, xq::DbWalSyncPolicy::EveryCommit, 1), true);
+		writeAheadLog.appendAdd({ 1, "name", -5, "address" });
+		EXPECT_EQ(writeAheadLog.commit(), true);
+		writeAheadLog.appendDelete(1);
+		writeAheadLog.appendAdd({ 2, "", 7, "" });
+		EXPECT_EQ(writeAheadLog.commit(), true);
+		EXPECT_EQ(writeAheadLog.getNumberOfSyncs(), 2);
+	}
+
+	xq::DbWalEntriesCollection entries{};
+	ASSERT_EQ(xq::DbWriteAheadLog::readEntries(path, entries), true);
+	ASSERT_EQ(entries.size(), 3);
+	EXPECT_EQ(entries[0].type, xq::DbWalEntryType::Add);
+	EXPECT_EQ(entries[0].record.id, 1);
+	EXPECT_EQ(entries[0].record.name, "name");
+	EXPECT_EQ(entries[0].record.balance, -5);
+	EXPECT_EQ(entries[0].record.address, "address");
+	EXPECT_EQ(entries[1].type, xq::DbWalEntryType::Delete);
+	EXPECT_EQ(entries[1].record.id, 1);
+	EXPECT_EQ(entries[2].record.id, 2);
+	EXPECT_EQ(entries[2].record.name, "");
+	EXPECT_EQ(entries[2].record.balance, 7);
+	std::remove(path.c_str());
+}
+
+/// @brief Test that the group commit syncs once per group and the pending commits are synced on demand
+TEST(DbWriteAheadLog, GroupCommitSuccess)
+{
+	std::string path = testing::TempDir() + "DbWriteAheadLogGroupCommit.wal";
+	std::remove(path.c_str());
+	xq::DbWriteAheadLog writeAheadLog{};
+	ASSERT_EQ(writeAheadLog.open(path, xq::DbWalSyncPolicy::GroupCommit, 4), true);
+	for (uint64_t id = 1; id <= 10; ++id)
+	{
+		writeAheadLog.appendDelete(id);
+		EXPECT_EQ(writeAheadLog.commit(), true);
+	}
+	EXPECT_EQ(writeAheadLog.getNumberOfSyncs(), 2);
+
+	// The last two commits are not written yet
+	xq::DbWalEntriesCollection entries{};
+	ASSERT_EQ(xq::DbWriteAheadLog::readEntries(path, entries), true);
+	EXPECT_EQ(entries.size(), 8);
+
+	EXPECT_EQ(writeAheadLog.sync(), true);
+	EXPECT_EQ(writeAheadLog.getNumberOfSyncs(), 3);
+	ASSERT_EQ(xq::DbWriteAheadLog::readEntries(path, entries), true);
+	EXPECT_EQ(entries.size(), 10);
+
+	EXPECT_EQ(writeAheadLog.truncate(), true);
+	ASSERT_EQ(xq::DbWriteAheadLog::readEntries(path, entries), true);
+	EXPECT_EQ(entries.size(), 0);
+	writeAheadLog.close();
+	std::remove(path.c_str());
+}
+
+/// @brief Test that a partly written entry is ignored and cut off when the log is opened again
+TEST(DbWriteAheadLog, TornEntrySuccess)
+{
+	std::string path = testing::TempDir() + "DbWriteAheadLogTornEntry.wal";
+	std::remove(path.c_str());
+	{
+		xq::DbWriteAheadLog writeAheadLog{};
+		ASSERT_EQ(writeAheadLog.open(path, xq::DbWalSyncPolicy::NoSync, 1), true);
+		writeAheadLog.appendAdd({ 1, "first", 1, "first" });
+		writeAheadLog.commit();
+		writeAheadLog.appendAdd({ 2, "second", 2, "second" });
+		writeAheadLog.commit();
+	}
+	std::filesystem::resize_file(path, std::filesystem::file_size(path) - 3);
+
+	xq::DbWalEntriesCollection entries{};
+	ASSERT_EQ(xq::DbWriteAheadLog::readEntries(path, entries), true);
+	ASSERT_EQ(entries.size(), 1);
+	EXPECT_EQ(entries[0].record.id, 1);
+
+	{
+		xq::DbWriteAheadLog writeAheadLog{};
+		ASSERT_EQ(writeAheadLog.open(path, xq::DbWalSyncPolicy::NoSync, 1), true);
+		writeAheadLog.appendDelete(1);
+		writeAheadLog.commit();
+	}
+	ASSERT_EQ(xq::DbWriteAheadLog::readEntries(path, entries), true);
+	ASSERT_EQ(entries.size(), 2);
+	EXPECT_EQ(entries[1].type, xq::DbWalEntryType::Delete);
+
+	// A missing log contains no entries
+	std::remove(path.c_str());
+	ASSERT_EQ(xq::DbWriteAheadLog::readEntries(path, entries), true);
+	EXPECT_EQ(entries.size(), 0);
+}
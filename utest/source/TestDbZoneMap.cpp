@@ -0,0 +1,73 @@
+/// @file TestDbZoneMap.cpp
+///
+/// @brief Unit tests for the DbZoneMap class.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "gtest/gtest.h"
+#include "DbZoneMap.hpp"
+
+#include <utility>
+#include <vector>
+
+/// @brief Test that the zones keep the bounds of their values
+TEST(DbZoneMap, AddValueSuccess)
+{
+	xq::DbZoneMap<int32_t> zoneMap{};
+	zoneMap.addValue(0, 10);
+	zoneMap.addValue(100, -5);
+	zoneMap.addValue(5000, 42);
+	ASSERT_EQ(zoneMap.getNumberOfZones(), 2);
+
+	EXPECT_EQ(zoneMap.mightContain(0, 0, 0), true);
+	EXPECT_EQ(zoneMap.mightContain(0, 11, 20), false);
+	EXPECT_EQ(zoneMap.mightContain(0, -10, -6), false);
+	EXPECT_EQ(zoneMap.mightContain(1, 42, 42), true);
+	EXPECT_EQ(zoneMap.mightContain(1, 10, 10), false);
+}
+
+/// @brief Test that only the parts of the range in the matching zones are scanned
+TEST(DbZoneMap, ForEachMatchingZoneSuccess)
+{
+	xq::DbZoneMap<uint64_t> zoneMap{};
+	for (uint64_t id = 1; id <= 10000; ++id)
+	{
+		zoneMap.addValue(id - 1, id);
+	}
+
+	std::vector<std::pair<size_t, size_t>> scannedParts{};
+	zoneMap.forEachMatchingZone(5000, 5000, 0, 10000, [&](size_t f_begin, size_t f_end) {
+		scannedParts.emplace_back(f_begin, f_end);
+	});
+	EXPECT_EQ(scannedParts, (std::vector<std::pair<size_t, size_t>>{ { 4096, 8192 } }));
+
+	scannedParts.clear();
+	zoneMap.forEachMatchingZone(1, 9000, 100, 9000, [&](size_t f_begin, size_t f_end) {
+		scannedParts.emplace_back(f_begin, f_end);
+	});
+	EXPECT_EQ(scannedParts, (std::vector<std::pair<size_t, size_t>>{ { 100, 4096 }, { 4096, 8192 }, { 8192, 9000 } }));
+}
+
+/// @brief Test that a zone asks to be rebuilt after half of its values are removed and is emptied with the last one
+TEST(DbZoneMap, RemoveValueSuccess)
+{
+	xq::DbZoneMap<int32_t> zoneMap{};
+	for (size_t index = 0; index < 4096; ++index)
+	{
+		zoneMap.addValue(index, static_cast<int32_t>(index));
+	}
+	for (size_t index = 0; index < 2047; ++index)
+	{
+		EXPECT_EQ(zoneMap.removeValue(index), false);
+	}
+	EXPECT_EQ(zoneMap.removeValue(2047), true);
+
+	zoneMap.resetZone(0);
+	zoneMap.addValue(4000, 4000);
+	EXPECT_EQ(zoneMap.mightContain(0, 0, 3999), false);
+	EXPECT_EQ(zoneMap.removeValue(4000), false);
+	EXPECT_EQ(zoneMap.mightContain(0, 4000, 4000), false);
+}
@@ -9,12 +9,17 @@
 
 #include "TestInMemoryDb.hpp"
 
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+
 namespace xq
 {
-    void InMemoryDbTest::setupTest(uint32_t f_numberOfRecords)
+    void InMemoryDbTest::setupTest(uint32_t f_numberOfRecords, DbStorageLayout f_storageLayout)
     {
         generateData(f_numberOfRecords);
-        m_inMemoryDb = std::make_shared<InMemoryDb>(m_records);
+        m_inMemoryDb = std::make_shared<InMemoryDb>(m_records, f_storageLayout);
     }
 
 	void InMemoryDbTest::generateData(uint32_t f_numberOfRecords)
@@ -130,6 +135,23 @@ namespace xq
         EXPECT_EQ(f_output.size(), 0);
     }
 
+    /// @brief Test that a balance, which doesn't fit in column2, is rejected by both searches instead of being truncated.
+    TEST_F(InMemoryDbTest, FindMetchingStringColumn2OutOfRange)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100, DbStorageLayout::Column);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        DbTestRecordPointersCollection f_output{};
+
+        // 4294967296 would be truncated to 0, the balance of the first record
+        EXPECT_THROW(m_inMemoryDb->findMatchingRecords("column2", "4294967296", f_output), std::out_of_range);
+        EXPECT_THROW(m_inMemoryDb->findMatchingRecordsOptimized("column2", "4294967296", f_output), std::out_of_range);
+        EXPECT_THROW(m_inMemoryDb->findMatchingRecordsOptimized("column0", "-1", f_output), std::out_of_range);
+        EXPECT_EQ(f_output.size(), 0);
+    }
+
     /// @brief Test that an existing record with matching address in column3 is found.
     TEST_F(InMemoryDbTest, FindMetchingStringOptimizedColumn3Success)
     {
@@ -570,5 +592,1338 @@ namespace xq
         m_inMemoryDb->findMatchingRecords("column1", "testdata101", f_output);
         ASSERT_EQ(f_output.size(), 1);
     }
-}
 
+    //********** FindById **********//
+
+    /// @brief Test that an existing record is found by its ID.
+    TEST_F(InMemoryDbTest, FindByIdSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        auto foundRecord = m_inMemoryDb->findById(88);
+        ASSERT_NE(foundRecord, nullptr);
+        EXPECT_EQ(foundRecord->id, 88);
+        EXPECT_EQ(foundRecord->name, "testdata88");
+    }
+
+    /// @brief Test that a record with non-existing ID is not found.
+    TEST_F(InMemoryDbTest, FindByIdNotFound)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        EXPECT_EQ(m_inMemoryDb->findById(888), nullptr);
+        EXPECT_EQ(m_inMemoryDb->findById(0), nullptr);
+    }
+
+    /// @brief Test that the ID index is kept up to date after deleting and adding records.
+    TEST_F(InMemoryDbTest, FindByIdAfterDeleteAndAdd)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        m_inMemoryDb->deleteRecordByID(88);
+        EXPECT_EQ(m_inMemoryDb->findById(88), nullptr);
+
+        // The new record takes the place of the deleted one and the rest stay untouched
+        DbTableTest testRecord{ 101, "testdata101", 101, "101testdata" };
+        m_inMemoryDb->addRecord(testRecord);
+        auto foundRecord = m_inMemoryDb->findById(101);
+        ASSERT_NE(foundRecord, nullptr);
+        EXPECT_EQ(foundRecord->name, "testdata101");
+        ASSERT_NE(m_inMemoryDb->findById(89), nullptr);
+        EXPECT_EQ(m_inMemoryDb->findById(89)->name, "testdata89");
+    }
+
+    /// @brief Test that the ID index is kept up to date after shifting the records.
+    TEST_F(InMemoryDbTest, FindByIdAfterDeleteNonOptimized)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        m_inMemoryDb->deleteRecordByIDNonOptimized(50);
+        EXPECT_EQ(m_inMemoryDb->findById(50), nullptr);
+
+        auto foundRecord = m_inMemoryDb->findById(100);
+        ASSERT_NE(foundRecord, nullptr);
+        EXPECT_EQ(foundRecord->id, 100);
+    }
+
+    //********** ColumnLayout **********//
+
+    /// @brief Test that both searches find the same records with the column layout.
+    TEST_F(InMemoryDbTest, ColumnLayoutFindMatchingRecordsSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100, DbStorageLayout::Column);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+        EXPECT_EQ(m_inMemoryDb->getStorageLayout(), DbStorageLayout::Column);
+
+        DbTestRecordPointersCollection f_output{};
+
+        m_inMemoryDb->findMatchingRecords("column0", "88", f_output);
+        ASSERT_EQ(f_output.size(), 1);
+        EXPECT_EQ(f_output.at(0)->id, 88);
+
+        f_output.clear();
+        m_inMemoryDb->findMatchingRecordsOptimized("column1", "testdata88", f_output);
+        ASSERT_EQ(f_output.size(), 1);
+        EXPECT_EQ(f_output.at(0)->name, "testdata88");
+
+        f_output.clear();
+        m_inMemoryDb->findMatchingRecords("column2", "88", f_output);
+        ASSERT_EQ(f_output.size(), 1);
+        EXPECT_EQ(f_output.at(0)->balance, 88);
+
+        f_output.clear();
+        m_inMemoryDb->findMatchingRecordsOptimized("column3", "testdata", f_output);
+        ASSERT_EQ(f_output.size(), 100);
+        EXPECT_EQ(f_output.at(0)->address, "1testdata");
+        EXPECT_EQ(f_output.at(f_output.size() - 1)->address, "100testdata");
+    }
+
+    /// @brief Test that the columns are kept in sync when deleting and adding records.
+    TEST_F(InMemoryDbTest, ColumnLayoutDeleteAndAddRecord)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100, DbStorageLayout::Column);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        m_inMemoryDb->deleteRecordByID(88);
+        m_inMemoryDb->deleteRecordByIDNonOptimized(50);
+
+        DbTestRecordPointersCollection f_output{};
+        m_inMemoryDb->findMatchingRecordsOptimized("column1", "testdata88", f_output);
+        EXPECT_EQ(f_output.size(), 0);
+        m_inMemoryDb->findMatchingRecordsOptimized("column2", "50", f_output);
+        EXPECT_EQ(f_output.size(), 0);
+
+        DbTableTest testRecord{ 101, "testdata101", 101, "101testdata" };
+        m_inMemoryDb->addRecord(testRecord);
+        m_inMemoryDb->findMatchingRecordsOptimized("column2", "101", f_output);
+        ASSERT_EQ(f_output.size(), 1);
+        EXPECT_EQ(f_output.at(0)->name, "testdata101");
+    }
+
+    //********** ParallelScan **********//
+
+    /// @brief Test that the number of threads can be selected automatically.
+    TEST_F(InMemoryDbTest, SetNumberOfThreadsAuto)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+        EXPECT_EQ(m_inMemoryDb->getNumberOfThreads(), 1);
+
+        m_inMemoryDb->setNumberOfThreads(0);
+        EXPECT_GE(m_inMemoryDb->getNumberOfThreads(), 1);
+    }
+
+    /// @brief Test that the parallel searches find the same records in the same order as a single thread.
+    TEST_F(InMemoryDbTest, ParallelFindMatchingRecordsSameAsSerial)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100000);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        DbTestRecordPointersCollection serialOutput{};
+        m_inMemoryDb->findMatchingRecords("column3", "99", serialOutput);
+        m_inMemoryDb->findMatchingRecordsOptimized("column1", "testdata", serialOutput);
+
+        m_inMemoryDb->setNumberOfThreads(4);
+        DbTestRecordPointersCollection parallelOutput{};
+        m_inMemoryDb->findMatchingRecords("column3", "99", parallelOutput);
+        m_inMemoryDb->findMatchingRecordsOptimized("column1", "testdata", parallelOutput);
+
+        ASSERT_EQ(parallelOutput.size(), 100000 + 3691);
+        EXPECT_EQ(parallelOutput, serialOutput);
+    }
+
+    /// @brief Test that the parallel searches of the integer columns find the same records with the column layout.
+    TEST_F(InMemoryDbTest, ParallelColumnLayoutSameAsSerial)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100000, DbStorageLayout::Column);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+        m_inMemoryDb->setNumberOfThreads(3);
+
+        DbTestRecordPointersCollection f_output{};
+        m_inMemoryDb->findMatchingRecords("column0", "99999", f_output);
+        m_inMemoryDb->findMatchingRecords("column2", "50000", f_output);
+        ASSERT_EQ(f_output.size(), 2);
+        EXPECT_EQ(f_output.at(0)->id, 99999);
+        EXPECT_EQ(f_output.at(1)->id, 50000);
+    }
+
+    //********** TrigramIndex **********//
+
+    /// @brief Test that both searches find the same records using the trigram index.
+    TEST_F(InMemoryDbTest, TrigramIndexFindMatchingRecordsSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(1000);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        m_inMemoryDb->enableTrigramIndex("column1");
+        m_inMemoryDb->enableTrigramIndex("column3");
+        EXPECT_EQ(m_inMemoryDb->hasTrigramIndex("column1"), true);
+        EXPECT_EQ(m_inMemoryDb->hasTrigramIndex("column3"), true);
+        EXPECT_EQ(m_inMemoryDb->hasTrigramIndex("column2"), false);
+
+        DbTestRecordPointersCollection f_output{};
+        m_inMemoryDb->findMatchingRecords("column1", "testdata500", f_output);
+        ASSERT_EQ(f_output.size(), 1);
+        EXPECT_EQ(f_output.at(0)->name, "testdata500");
+
+        f_output.clear();
+        m_inMemoryDb->findMatchingRecordsOptimized("column3", "99testdata", f_output);
+        ASSERT_EQ(f_output.size(), 10);
+        EXPECT_EQ(f_output.at(0)->address, "99testdata");
+        EXPECT_EQ(f_output.at(9)->address, "999testdata");
+
+        // Searched strings shorter than a trigram traverse all the records
+        f_output.clear();
+        m_inMemoryDb->findMatchingRecordsOptimized("column3", "99", f_output);
+        EXPECT_EQ(f_output.size(), 19);
+    }
+
+    /// @brief Test that the trigram index is kept up to date when deleting and adding records.
+    TEST_F(InMemoryDbTest, TrigramIndexDeleteAndAddRecord)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+        m_inMemoryDb->enableTrigramIndex("column1");
+
+        m_inMemoryDb->deleteRecordByID(88);
+        DbTestRecordPointersCollection f_output{};
+        m_inMemoryDb->findMatchingRecords("column1", "testdata88", f_output);
+        EXPECT_EQ(f_output.size(), 0);
+
+        DbTableTest testRecord{ 101, "newdata101", 101, "101testdata" };
+        m_inMemoryDb->addRecord(testRecord);
+        m_inMemoryDb->findMatchingRecords("column1", "data101", f_output);
+        ASSERT_EQ(f_output.size(), 1);
+        EXPECT_EQ(f_output.at(0)->id, 101);
+
+        // Shifting the records rebuilds the index with the new positions
+        f_output.clear();
+        m_inMemoryDb->deleteRecordByIDNonOptimized(10);
+        m_inMemoryDb->findMatchingRecords("column1", "testdata99", f_output);
+        ASSERT_EQ(f_output.size(), 1);
+        EXPECT_EQ(f_output.at(0)->id, 99);
+    }
+
+    //********** BalanceIndex **********//
+
+    /// @brief Test that the range search finds the same records with and without the balance index.
+    TEST_F(InMemoryDbTest, BalanceIndexFindRecordsByBalanceRangeSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(1000);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        DbTestRecordPointersCollection f_output{};
+        m_inMemoryDb->findRecordsByBalanceRange(100, 199, f_output);
+        ASSERT_EQ(f_output.size(), 100);
+
+        m_inMemoryDb->enableBalanceIndex();
+        EXPECT_EQ(m_inMemoryDb->hasBalanceIndex(), true);
+
+        DbTestRecordPointersCollection f_indexOutput{};
+        m_inMemoryDb->findRecordsByBalanceRange(100, 199, f_indexOutput);
+        EXPECT_EQ(f_indexOutput, f_output);
+
+        // Records with balance below a given value
+        f_indexOutput.clear();
+        m_inMemoryDb->findRecordsByBalanceRange(std::numeric_limits<int32_t>::min(), 9, f_indexOutput);
+        ASSERT_EQ(f_indexOutput.size(), 9);
+        EXPECT_EQ(f_indexOutput.at(0)->balance, 1);
+    }
+
+    /// @brief Test that the searches for an exact balance use the balance index.
+    TEST_F(InMemoryDbTest, BalanceIndexFindMatchingRecordsSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(1000, DbStorageLayout::Column);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+        m_inMemoryDb->enableBalanceIndex();
+
+        DbTestRecordPointersCollection f_output{};
+        m_inMemoryDb->findMatchingRecordsOptimized("column2", "88", f_output);
+        ASSERT_EQ(f_output.size(), 1);
+        EXPECT_EQ(f_output.at(0)->id, 88);
+
+        f_output.clear();
+        m_inMemoryDb->findMatchingRecords("column2", "1888", f_output);
+        EXPECT_EQ(f_output.size(), 0);
+    }
+
+    /// @brief Test that the balance index is kept up to date when deleting and adding records.
+    TEST_F(InMemoryDbTest, BalanceIndexDeleteAndAddRecord)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+        m_inMemoryDb->enableBalanceIndex();
+
+        m_inMemoryDb->deleteRecordByID(50);
+        DbTestRecordPointersCollection f_output{};
+        m_inMemoryDb->findRecordsByBalanceRange(50, 50, f_output);
+        EXPECT_EQ(f_output.size(), 0);
+
+        DbTableTest testRecord{ 101, "newdata101", 50, "101testdata" };
+        m_inMemoryDb->addRecord(testRecord);
+        m_inMemoryDb->findRecordsByBalanceRange(50, 50, f_output);
+        ASSERT_EQ(f_output.size(), 1);
+        EXPECT_EQ(f_output.at(0)->id, 101);
+
+        // Shifting the records rebuilds the index with the new positions
+        f_output.clear();
+        m_inMemoryDb->deleteRecordByIDNonOptimized(10);
+        m_inMemoryDb->findRecordsByBalanceRange(99, 100, f_output);
+        ASSERT_EQ(f_output.size(), 2);
+        EXPECT_EQ(f_output.at(0)->id, 99);
+        EXPECT_EQ(f_output.at(1)->id, 100);
+    }
+
+    //********** ResultSet **********//
+
+    /// @brief Test that the result set contains the same records as the collection of pointers.
+    TEST_F(InMemoryDbTest, ResultSetFindMatchingRecordsSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100000);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+        m_inMemoryDb->setNumberOfThreads(4);
+
+        DbTestRecordPointersCollection f_output{};
+        m_inMemoryDb->findMatchingRecords("column3", "99", f_output);
+
+        DbResultSet f_resultSet{};
+        m_inMemoryDb->findMatchingRecords("column3", "99", f_resultSet);
+        ASSERT_EQ(f_resultSet.count(), f_output.size());
+        size_t i = 0;
+        for (auto index : f_resultSet)
+        {
+            EXPECT_EQ(&m_inMemoryDb->getRecord(index), f_output.at(i++));
+        }
+
+        m_inMemoryDb->findMatchingRecords("column0", "88", f_resultSet);
+        ASSERT_EQ(f_resultSet.count(), 1);
+        EXPECT_EQ(m_inMemoryDb->getRecord(*f_resultSet.begin()).id, 88);
+    }
+
+    /// @brief Test that the results of two searches can be combined.
+    TEST_F(InMemoryDbTest, ResultSetCombineSearchesSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(1000);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+        m_inMemoryDb->enableBalanceIndex();
+
+        DbResultSet f_nameResultSet{};
+        DbResultSet f_balanceResultSet{};
+        m_inMemoryDb->findMatchingRecords("column1", "testdata88", f_nameResultSet);
+        m_inMemoryDb->findMatchingRecords("column2", "885", f_balanceResultSet);
+        EXPECT_EQ(f_nameResultSet.count(), 11);
+
+        // Deleted records are not found
+        m_inMemoryDb->deleteRecordByID(881);
+        DbResultSet f_addressResultSet{};
+        m_inMemoryDb->findMatchingRecords("column3", "881testdata", f_addressResultSet);
+        EXPECT_EQ(f_addressResultSet.empty(), true);
+
+        DbResultSet f_andResultSet{ f_nameResultSet };
+        f_andResultSet.intersectWith(f_balanceResultSet);
+        ASSERT_EQ(f_andResultSet.count(), 1);
+        EXPECT_EQ(m_inMemoryDb->getRecord(*f_andResultSet.begin()).id, 885);
+
+        f_balanceResultSet.uniteWith(f_nameResultSet);
+        EXPECT_EQ(f_balanceResultSet.count(), 11);
+    }
+
+    //********** Query **********//
+
+    /// @brief Test that only the records matching all the predicates are found.
+    TEST_F(InMemoryDbTest, QueryFindMatchingRecordsSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(1000);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        DbQuery f_query{};
+        f_query.addPredicate("column1", "testdata88").addPredicate("column3", "5testdata");
+        DbTestRecordPointersCollection f_output{};
+        m_inMemoryDb->findMatchingRecords(f_query, f_output);
+        ASSERT_EQ(f_output.size(), 1);
+        EXPECT_EQ(f_output.at(0)->id, 885);
+
+        // The same query with a predicate which doesn't match
+        f_query.addPredicate("column2", "1");
+        f_output.clear();
+        m_inMemoryDb->findMatchingRecords(f_query, f_output);
+        EXPECT_EQ(f_output.size(), 0);
+
+        // A query without predicates matches all the records, which are not deleted
+        m_inMemoryDb->deleteRecordByID(500);
+        f_output.clear();
+        m_inMemoryDb->findMatchingRecords(DbQuery{}, f_output);
+        EXPECT_EQ(f_output.size(), 999);
+    }
+
+    /// @brief Test that the query gives the same results with and without indexes.
+    TEST_F(InMemoryDbTest, QueryWithIndexesSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(1000);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        DbQuery f_query{};
+        f_query.addPredicate("column3", "testdata").addPredicate("column1", "data8").addPredicate("column2", "885");
+        DbResultSet f_resultSet{};
+        m_inMemoryDb->findMatchingRecords(f_query, f_resultSet);
+        ASSERT_EQ(f_resultSet.count(), 1);
+        EXPECT_EQ(m_inMemoryDb->getRecord(*f_resultSet.begin()).id, 885);
+
+        m_inMemoryDb->enableBalanceIndex();
+        m_inMemoryDb->enableTrigramIndex("column1");
+        DbResultSet f_indexResultSet{};
+        m_inMemoryDb->findMatchingRecords(f_query, f_indexResultSet);
+        ASSERT_EQ(f_indexResultSet.count(), 1);
+        EXPECT_EQ(*f_indexResultSet.begin(), *f_resultSet.begin());
+
+        // The primary-key index answers a predicate on the ID
+        DbQuery f_idQuery{};
+        f_idQuery.addPredicate("column1", "testdata").addPredicate("column0", "885");
+        DbTestRecordPointersCollection f_output{};
+        m_inMemoryDb->findMatchingRecords(f_idQuery, f_output);
+        ASSERT_EQ(f_output.size(), 1);
+        EXPECT_EQ(f_output.at(0)->id, 885);
+    }
+
+    //********** Compaction **********//
+
+    /// @brief Test that a new record is placed in the slot of the last deleted record.
+    TEST_F(InMemoryDbTest, CompactionReuseFreeSlotSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        m_inMemoryDb->deleteRecordByID(10);
+        m_inMemoryDb->deleteRecordByID(20);
+        EXPECT_EQ(m_inMemoryDb->getNumberOfDeletedRecords(), 2);
+
+        DbTableTest testRecord{ 101, "newdata101", 101, "101testdata" };
+        m_inMemoryDb->addRecord(testRecord);
+        EXPECT_EQ(m_inMemoryDb->getNumberOfDeletedRecords(), 1);
+        EXPECT_EQ(m_inMemoryDb->getRecord(19).id, 101);
+        EXPECT_EQ(m_inMemoryDb->findById(101), &m_inMemoryDb->getRecord(19));
+    }
+
+    /// @brief Test that the deleted records are not found by the searches.
+    TEST_F(InMemoryDbTest, CompactionDeletedRecordsNotFound)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+        m_inMemoryDb->deleteRecordByID(10);
+
+        // The deleted record has a balance of 0 and an empty name
+        DbTestRecordPointersCollection f_output{};
+        m_inMemoryDb->findMatchingRecordsOptimized("column2", "0", f_output);
+        EXPECT_EQ(f_output.size(), 0);
+        m_inMemoryDb->findMatchingRecordsOptimized("column1", "", f_output);
+        EXPECT_EQ(f_output.size(), 99);
+    }
+
+    /// @brief Test that compacting removes all the deleted records and keeps the rest findable.
+    TEST_F(InMemoryDbTest, CompactionCompactSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(1000, DbStorageLayout::Column);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+        m_inMemoryDb->enableBalanceIndex();
+        m_inMemoryDb->enableTrigramIndex("column1");
+        m_inMemoryDb->setCompactionThreshold(1.0);
+
+        for (uint32_t id = 1; id <= 1000; id += 3)
+        {
+            m_inMemoryDb->deleteRecordByID(id);
+        }
+        EXPECT_EQ(m_inMemoryDb->getNumberOfDeletedRecords(), 334);
+
+        m_inMemoryDb->compact();
+        EXPECT_EQ(m_inMemoryDb->getNumberOfDeletedRecords(), 0);
+        EXPECT_EQ(m_inMemoryDb->getNumberOfRecords(), 666);
+
+        DbTestRecordPointersCollection f_output{};
+        m_inMemoryDb->findMatchingRecordsOptimized("column3", "testdata", f_output);
+        EXPECT_EQ(f_output.size(), 666);
+
+        f_output.clear();
+        m_inMemoryDb->findMatchingRecords("column2", "999", f_output);
+        ASSERT_EQ(f_output.size(), 1);
+        EXPECT_EQ(f_output.at(0)->id, 999);
+        EXPECT_EQ(m_inMemoryDb->findById(999), f_output.at(0));
+
+        f_output.clear();
+        m_inMemoryDb->findMatchingRecords("column1", "testdata99", f_output);
+        EXPECT_EQ(f_output.size(), 8);
+
+        // New records are placed at the end
+        DbTableTest testRecord{ 1001, "newdata1001", 1001, "1001testdata" };
+        m_inMemoryDb->addRecord(testRecord);
+        EXPECT_EQ(m_inMemoryDb->getRecord(666).id, 1001);
+    }
+
+    /// @brief Test that the deletions don't move the records, unless the compaction is enabled.
+    TEST_F(InMemoryDbTest, CompactionDisabledByDefaultSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(1000);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+        EXPECT_EQ(m_inMemoryDb->getCompactionThreshold(), 1.0);
+
+        const DbTableTest* lastRecord = m_inMemoryDb->findById(999);
+        ASSERT_NE(lastRecord, nullptr);
+        for (uint32_t id = 1; id <= 998; ++id)
+        {
+            m_inMemoryDb->deleteRecordByID(id);
+        }
+        EXPECT_EQ(m_inMemoryDb->getNumberOfDeletedRecords(), 998);
+        EXPECT_EQ(m_inMemoryDb->findById(999), lastRecord);
+        EXPECT_EQ(lastRecord->name, "testdata999");
+    }
+
+    /// @brief Test that the deletions compact the records after the threshold is reached.
+    TEST_F(InMemoryDbTest, CompactionIncrementalSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(1000);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+        m_inMemoryDb->setCompactionThreshold(0.25);
+
+        for (uint32_t id = 1; id <= 1000; id += 2)
+        {
+            m_inMemoryDb->deleteRecordByID(id);
+        }
+        EXPECT_LT(m_inMemoryDb->getNumberOfDeletedRecords(), 250);
+        EXPECT_EQ(m_inMemoryDb->getNumberOfRecords(), 500);
+
+        DbTestRecordPointersCollection f_output{};
+        m_inMemoryDb->findMatchingRecords("column1", "testdata", f_output);
+        EXPECT_EQ(f_output.size(), 500);
+        for (auto rec : f_output)
+        {
+            EXPECT_EQ(rec->id % 2, 0);
+            EXPECT_EQ(m_inMemoryDb->findById(rec->id), rec);
+        }
+    }
+
+    //********** BatchOperations **********//
+
+    /// @brief Test that the database takes over the records loaded in bulk.
+    TEST_F(InMemoryDbTest, BatchBulkLoadSuccess)
+    {
+        DbTestRecordCollection records{};
+        for (uint64_t i = 1; i <= 100; ++i)
+        {
+            records.push_back({ i, "testdata" + std::to_string(i), static_cast<int32_t>(i), std::to_string(i) + "testdata" });
+        }
+
+        InMemoryDb inMemoryDb{ std::move(records), DbStorageLayout::Column };
+        EXPECT_EQ(inMemoryDb.getNumberOfRecords(), 100);
+        ASSERT_NE(inMemoryDb.findById(88), nullptr);
+        EXPECT_EQ(inMemoryDb.findById(88)->name, "testdata88");
+    }
+
+    /// @brief Test that the new records fill the free slots first and the rest are added at the end.
+    TEST_F(InMemoryDbTest, BatchAddRecordsSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100, DbStorageLayout::Column);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+        m_inMemoryDb->deleteRecordByID(50);
+
+        DbTestRecordCollection newRecords{ { 101, "newdata101", 101, "101testdata" },
+            { 102, "newdata102", 102, "102testdata" }, { 103, "newdata103", 103, "103testdata" } };
+        m_inMemoryDb->addRecords(std::move(newRecords));
+        EXPECT_EQ(m_inMemoryDb->getNumberOfRecords(), 102);
+        EXPECT_EQ(m_inMemoryDb->getNumberOfDeletedRecords(), 0);
+        EXPECT_EQ(m_inMemoryDb->getRecord(49).id, 101);
+        EXPECT_EQ(m_inMemoryDb->getRecord(101).id, 103);
+
+        DbTestRecordPointersCollection f_output{};
+        m_inMemoryDb->findMatchingRecords("column1", "newdata", f_output);
+        ASSERT_EQ(f_output.size(), 3);
+        EXPECT_EQ(m_inMemoryDb->findById(102), f_output.at(1));
+    }
+
+    /// @brief Test that several records are deleted and the unknown ids are ignored.
+    TEST_F(InMemoryDbTest, BatchDeleteRecordsByIdsSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        m_inMemoryDb->deleteRecordsByIds({ 10, 20, 30, 10, 888 });
+        EXPECT_EQ(m_inMemoryDb->getNumberOfRecords(), 97);
+        EXPECT_EQ(m_inMemoryDb->getNumberOfDeletedRecords(), 3);
+        EXPECT_EQ(m_inMemoryDb->findById(20), nullptr);
+
+        // Deleting most of the records compacts them at once
+        m_inMemoryDb->setCompactionThreshold(0.5);
+        DbRecordIdsCollection ids{};
+        for (uint32_t id = 31; id <= 100; ++id)
+        {
+            ids.emplace_back(id);
+        }
+        m_inMemoryDb->deleteRecordsByIds(ids);
+        EXPECT_EQ(m_inMemoryDb->getNumberOfRecords(), 27);
+        EXPECT_EQ(m_inMemoryDb->getNumberOfDeletedRecords(), 0);
+    }
+
+    //********** MoveSemantics **********//
+
+    /// @brief Test that a moved record is added to the database and its strings are taken over.
+    TEST_F(InMemoryDbTest, AddMovedRecordSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        DbTableTest newRecord{ 101, "newdata101", 101, "101testdata" };
+        m_inMemoryDb->addRecord(std::move(newRecord));
+        EXPECT_EQ(m_inMemoryDb->getNumberOfRecords(), 101);
+
+        const DbTableTest* foundRecord = m_inMemoryDb->findById(101);
+        ASSERT_NE(foundRecord, nullptr);
+        EXPECT_EQ(foundRecord->name, "newdata101");
+        EXPECT_EQ(foundRecord->address, "101testdata");
+
+        DbTestRecordPointersCollection f_output{};
+        m_inMemoryDb->findMatchingRecords("column1", "newdata", f_output);
+        ASSERT_EQ(f_output.size(), 1);
+        EXPECT_EQ(f_output.at(0), foundRecord);
+    }
+
+    /// @brief Test that a record constructed in place is added to the database.
+    TEST_F(InMemoryDbTest, EmplaceRecordSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        m_inMemoryDb->deleteRecordByID(50);
+        m_inMemoryDb->emplaceRecord(uint64_t{ 101 }, std::string{ "newdata101" }, 101, std::string{ "101testdata" });
+        EXPECT_EQ(m_inMemoryDb->getNumberOfRecords(), 100);
+        EXPECT_EQ(m_inMemoryDb->getRecord(49).id, 101);
+
+        DbTestRecordPointersCollection f_output{};
+        m_inMemoryDb->findMatchingRecords("column3", "101testdata", f_output);
+        ASSERT_EQ(f_output.size(), 1);
+        EXPECT_EQ(f_output.at(0)->balance, 101);
+    }
+
+    //********** DictionaryEncoding **********//
+
+    /// @brief Test that the dictionary encoded columns find the same records as the plain ones.
+    TEST_F(InMemoryDbTest, DictionaryEncodingFindMatchingRecordsSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100, DbStorageLayout::Column);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        m_inMemoryDb->enableDictionaryEncoding("column3");
+        EXPECT_EQ(m_inMemoryDb->hasDictionaryEncoding("column3"), true);
+        EXPECT_EQ(m_inMemoryDb->hasDictionaryEncoding("column1"), false);
+
+        DbTestRecordPointersCollection f_output{};
+        m_inMemoryDb->findMatchingRecords("column3", "5testdata", f_output);
+        EXPECT_EQ(f_output.size(), 10);
+
+        // The new and the deleted records are taken into account
+        m_inMemoryDb->deleteRecordByID(15);
+        m_inMemoryDb->addRecords(DbTestRecordCollection{ { 101, "newdata101", 101, "Sofia" },
+            { 102, "newdata102", 102, "Sofia" }, { 103, "newdata103", 103, "5testdata" } });
+        f_output.clear();
+        m_inMemoryDb->findMatchingRecords("column3", "5testdata", f_output);
+        EXPECT_EQ(f_output.size(), 10);
+        f_output.clear();
+        m_inMemoryDb->findMatchingRecordsOptimized("column3", "Sof", f_output);
+        ASSERT_EQ(f_output.size(), 2);
+        EXPECT_EQ(f_output.at(1)->id, 102);
+
+        f_output.clear();
+        m_inMemoryDb->findMatchingRecords("column3", "Varna", f_output);
+        EXPECT_EQ(f_output.size(), 0);
+    }
+
+    /// @brief Test that the dictionary encoding is not used with the row layout.
+    TEST_F(InMemoryDbTest, DictionaryEncodingRowLayoutIgnored)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        m_inMemoryDb->enableDictionaryEncoding("column1");
+        EXPECT_EQ(m_inMemoryDb->hasDictionaryEncoding("column1"), false);
+
+        DbTestRecordPointersCollection f_output{};
+        m_inMemoryDb->findMatchingRecords("column1", "testdata1", f_output);
+        EXPECT_EQ(f_output.size(), 12);
+    }
+
+    //********** IntegerCompression **********//
+
+    /// @brief Test that the compressed columns find the same records as the plain ones.
+    TEST_F(InMemoryDbTest, IntegerCompressionFindMatchingRecordsSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(5000, DbStorageLayout::Column);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        m_inMemoryDb->enableIntegerCompression("column0");
+        m_inMemoryDb->enableIntegerCompression("column2");
+        EXPECT_EQ(m_inMemoryDb->hasIntegerCompression("column0"), true);
+        EXPECT_EQ(m_inMemoryDb->hasIntegerCompression("column2"), true);
+
+        DbTestRecordPointersCollection f_output{};
+        m_inMemoryDb->findMatchingRecords("column0", "4321", f_output);
+        ASSERT_EQ(f_output.size(), 1);
+        EXPECT_EQ(f_output.at(0)->id, 4321);
+
+        // The deleted records are skipped and the new ones are found
+        m_inMemoryDb->deleteRecordByID(4321);
+        m_inMemoryDb->addRecord({ 5001, "newdata5001", -7, "5001newdata" });
+        f_output.clear();
+        m_inMemoryDb->findMatchingRecords("column0", "4321", f_output);
+        EXPECT_EQ(f_output.size(), 0);
+        f_output.clear();
+        m_inMemoryDb->findMatchingRecords("column2", "-7", f_output);
+        ASSERT_EQ(f_output.size(), 1);
+        EXPECT_EQ(f_output.at(0)->id, 5001);
+
+        f_output.clear();
+        m_inMemoryDb->findRecordsByBalanceRange(-10, 0, f_output);
+        EXPECT_EQ(f_output.size(), 1);
+    }
+
+    /// @brief Test that the integer compression is not used with the row layout.
+    TEST_F(InMemoryDbTest, IntegerCompressionRowLayoutIgnored)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        m_inMemoryDb->enableIntegerCompression("column2");
+        EXPECT_EQ(m_inMemoryDb->hasIntegerCompression("column2"), false);
+    }
+
+    //********** ZoneMaps **********//
+
+    /// @brief Test that the integer searches using the zone maps find the records after adding and deleting.
+    TEST_F(InMemoryDbTest, ZoneMapsFindMatchingRecordsSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(10000);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        DbTestRecordPointersCollection f_output{};
+        m_inMemoryDb->findMatchingRecords("column0", "9000", f_output);
+        ASSERT_EQ(f_output.size(), 1);
+        EXPECT_EQ(f_output.at(0)->id, 9000);
+
+        // The deleted records are not found and the new ones are found in the zones of their free slots
+        m_inMemoryDb->deleteRecordByID(9000);
+        m_inMemoryDb->deleteRecordByID(20);
+        m_inMemoryDb->addRecord({ 10001, "newdata10001", 777777, "10001newdata" });
+        f_output.clear();
+        m_inMemoryDb->findMatchingRecords("column0", "9000", f_output);
+        EXPECT_EQ(f_output.size(), 0);
+        f_output.clear();
+        m_inMemoryDb->findMatchingRecordsOptimized("column2", "777777", f_output);
+        ASSERT_EQ(f_output.size(), 1);
+        EXPECT_EQ(f_output.at(0)->id, 10001);
+        f_output.clear();
+        m_inMemoryDb->findRecordsByBalanceRange(8990, 9010, f_output);
+        EXPECT_EQ(f_output.size(), 20);
+    }
+
+    /// @brief Test that the zone maps follow the records moved by the compaction.
+    TEST_F(InMemoryDbTest, ZoneMapsCompactionSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(10000, DbStorageLayout::Column);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        m_inMemoryDb->setCompactionThreshold(0.5);
+        DbRecordIdsCollection ids{};
+        for (uint32_t id = 1; id <= 6000; ++id)
+        {
+            ids.emplace_back(id);
+        }
+        m_inMemoryDb->deleteRecordsByIds(ids);
+        ASSERT_EQ(m_inMemoryDb->getNumberOfDeletedRecords(), 0);
+
+        DbTestRecordPointersCollection f_output{};
+        m_inMemoryDb->findMatchingRecords("column0", "9999", f_output);
+        ASSERT_EQ(f_output.size(), 1);
+        EXPECT_EQ(f_output.at(0)->balance, 9999);
+        f_output.clear();
+        m_inMemoryDb->findMatchingRecords("column2", "100", f_output);
+        EXPECT_EQ(f_output.size(), 0);
+        f_output.clear();
+        m_inMemoryDb->findRecordsByBalanceRange(6001, 6100, f_output);
+        EXPECT_EQ(f_output.size(), 100);
+    }
+
+    //********** Snapshot **********//
+
+    /// @brief Test that a saved snapshot loads the records, which are not deleted, into another database.
+    TEST_F(InMemoryDbTest, SnapshotSaveAndLoadSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(1000);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        m_inMemoryDb->setCompactionThreshold(1.0);
+        m_inMemoryDb->deleteRecordByID(500);
+        std::string path = testing::TempDir() + "InMemoryDbSnapshotSaveAndLoad.xqdb";
+        ASSERT_EQ(m_inMemoryDb->saveSnapshot(path), true);
+
+        InMemoryDb loadedDb{ DbTestRecordCollection{}, DbStorageLayout::Column };
+        ASSERT_EQ(loadedDb.loadSnapshot(path), true);
+        EXPECT_EQ(loadedDb.getNumberOfRecords(), 999);
+        EXPECT_EQ(loadedDb.getNumberOfDeletedRecords(), 0);
+
+        DbTestRecordPointersCollection f_output{};
+        loadedDb.findMatchingRecords("column1", "testdata700", f_output);
+        ASSERT_EQ(f_output.size(), 1);
+        EXPECT_EQ(f_output.at(0)->id, 700);
+        EXPECT_EQ(f_output.at(0)->balance, 700);
+        EXPECT_EQ(f_output.at(0)->address, "700testdata");
+        f_output.clear();
+        loadedDb.findMatchingRecords("column0", "500", f_output);
+        EXPECT_EQ(f_output.size(), 0);
+
+        // New records are added after the loaded ones
+        loadedDb.addRecord({ 1001, "newdata", 1001, "newaddress" });
+        EXPECT_EQ(loadedDb.getNumberOfRecords(), 1000);
+        f_output.clear();
+        loadedDb.findMatchingRecords("column3", "newaddress", f_output);
+        EXPECT_EQ(f_output.size(), 1);
+        f_output.clear();
+        loadedDb.findMatchingRecords("column2", "700", f_output);
+        EXPECT_EQ(f_output.size(), 1);
+
+        // Loading again replaces the columns used in place
+        ASSERT_EQ(loadedDb.loadSnapshot(path), true);
+        EXPECT_EQ(loadedDb.getNumberOfRecords(), 999);
+        f_output.clear();
+        loadedDb.findMatchingRecords("column3", "700testdata", f_output);
+        EXPECT_EQ(f_output.size(), 1);
+        std::remove(path.c_str());
+    }
+
+    /// @brief Test that saving over the snapshot used in place by the columns keeps them readable.
+    TEST_F(InMemoryDbTest, SnapshotSaveOverLoadedSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(1000);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        std::string path = testing::TempDir() + "InMemoryDbSnapshotSaveOverLoaded.xqdb";
+        ASSERT_EQ(m_inMemoryDb->saveSnapshot(path), true);
+
+        InMemoryDb loadedDb{ DbTestRecordCollection{}, DbStorageLayout::Column };
+        ASSERT_EQ(loadedDb.loadSnapshot(path), true);
+        ASSERT_EQ(loadedDb.saveSnapshot(path), true);
+        EXPECT_EQ(std::filesystem::exists(path + ".tmp"), false);
+
+        // A smaller snapshot saved by another database doesn't shrink the file mapped by the columns either
+        InMemoryDb smallerDb{ DbTestRecordCollection{ { 1, "smalldata", 1, "smalladdress" } }, DbStorageLayout::Column };
+        ASSERT_EQ(smallerDb.saveSnapshot(path), true);
+
+        DbTestRecordPointersCollection f_output{};
+        loadedDb.findMatchingRecords("column2", "42", f_output);
+        EXPECT_EQ(f_output.size(), 1);
+        f_output.clear();
+        loadedDb.findMatchingRecords("column1", "testdata777", f_output);
+        EXPECT_EQ(f_output.size(), 1);
+        f_output.clear();
+        loadedDb.findMatchingRecords("column3", "777testdata", f_output);
+        EXPECT_EQ(f_output.size(), 1);
+
+        // The saved file is a complete snapshot
+        InMemoryDb reloadedDb{ DbTestRecordCollection{}, DbStorageLayout::Column };
+        ASSERT_EQ(reloadedDb.loadSnapshot(path), true);
+        EXPECT_EQ(reloadedDb.getNumberOfRecords(), 1);
+        std::remove(path.c_str());
+    }
+
+    /// @brief Test that a file, which is not a snapshot, does not change the database.
+    TEST_F(InMemoryDbTest, SnapshotLoadInvalidFileFail)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        std::string path = testing::TempDir() + "InMemoryDbSnapshotLoadInvalidFile.xqdb";
+        {
+            std::ofstream file{ path, std::ios::binary };
+            file << "This is not a snapshot of the database";
+        }
+        EXPECT_EQ(m_inMemoryDb->loadSnapshot(path), false);
+        EXPECT_EQ(m_inMemoryDb->loadSnapshot(path + ".missing"), false);
+        EXPECT_EQ(m_inMemoryDb->getNumberOfRecords(), 100);
+
+        DbTestRecordPointersCollection f_output{};
+        m_inMemoryDb->findMatchingRecords("column0", "42", f_output);
+        EXPECT_EQ(f_output.size(), 1);
+        std::remove(path.c_str());
+    }
+
+    //********** WriteAheadLog **********//
+
+    /// @brief Test that replaying the write-ahead log restores the logged additions and deletions.
+    TEST_F(InMemoryDbTest, WriteAheadLogReplaySuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(0);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        std::string path = testing::TempDir() + "InMemoryDbWriteAheadLogReplay.wal";
+        std::remove(path.c_str());
+        ASSERT_EQ(m_inMemoryDb->enableWriteAheadLog(path, DbWalSyncPolicy::GroupCommit, 8), true);
+        EXPECT_EQ(m_inMemoryDb->hasWriteAheadLog(), true);
+        for (uint64_t id = 1; id <= 100; ++id)
+        {
+            m_inMemoryDb->addRecord({ id, "name" + std::to_string(id), static_cast<int32_t>(id), "address" });
+        }
+        m_inMemoryDb->deleteRecordByID(10);
+        m_inMemoryDb->deleteRecordsByIds({ 20, 30, 1000 });
+        m_inMemoryDb->addRecords(DbTestRecordCollection{ { 101, "name101", 101, "address" } });
+        ASSERT_EQ(m_inMemoryDb->syncWriteAheadLog(), true);
+
+        InMemoryDb recoveredDb{ DbTestRecordCollection{} };
+        ASSERT_EQ(recoveredDb.replayWriteAheadLog(path), true);
+        EXPECT_EQ(recoveredDb.getNumberOfRecords(), 98);
+        EXPECT_EQ(recoveredDb.getNumberOfDeletedRecords(), m_inMemoryDb->getNumberOfDeletedRecords());
+        EXPECT_EQ(recoveredDb.findById(10), nullptr);
+        EXPECT_EQ(recoveredDb.findById(30), nullptr);
+        ASSERT_NE(recoveredDb.findById(101), nullptr);
+        EXPECT_EQ(recoveredDb.findById(55)->name, "name55");
+
+        // Replaying the same log again changes nothing
+        ASSERT_EQ(recoveredDb.replayWriteAheadLog(path), true);
+        EXPECT_EQ(recoveredDb.getNumberOfRecords(), 98);
+        m_inMemoryDb.reset();
+        std::remove(path.c_str());
+    }
+
+    /// @brief Test that the recovery loads the checkpoint snapshot and replays only the mutations logged after it.
+    TEST_F(InMemoryDbTest, WriteAheadLogCheckpointSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(1000, DbStorageLayout::Column);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        std::string logPath = testing::TempDir() + "InMemoryDbWriteAheadLogCheckpoint.wal";
+        std::string snapshotPath = testing::TempDir() + "InMemoryDbWriteAheadLogCheckpoint.xqdb";
+        std::remove(logPath.c_str());
+        ASSERT_EQ(m_inMemoryDb->enableWriteAheadLog(logPath, DbWalSyncPolicy::EveryCommit), true);
+        m_inMemoryDb->deleteRecordByID(1);
+        ASSERT_EQ(m_inMemoryDb->checkpoint(snapshotPath), true);
+        m_inMemoryDb->deleteRecordByID(2);
+        m_inMemoryDb->addRecord({ 1001, "newdata1001", 1001, "1001newdata" });
+
+        DbWalEntriesCollection entries{};
+        ASSERT_EQ(DbWriteAheadLog::readEntries(logPath, entries), true);
+        EXPECT_EQ(entries.size(), 2);
+
+        InMemoryDb recoveredDb{ DbTestRecordCollection{}, DbStorageLayout::Column };
+        ASSERT_EQ(recoveredDb.loadSnapshot(snapshotPath), true);
+        ASSERT_EQ(recoveredDb.replayWriteAheadLog(logPath), true);
+        EXPECT_EQ(recoveredDb.getNumberOfRecords(), 999);
+        EXPECT_EQ(recoveredDb.findById(1), nullptr);
+        EXPECT_EQ(recoveredDb.findById(2), nullptr);
+
+        DbTestRecordPointersCollection f_output{};
+        recoveredDb.findMatchingRecords("column1", "newdata", f_output);
+        ASSERT_EQ(f_output.size(), 1);
+        EXPECT_EQ(f_output.at(0)->id, 1001);
+        m_inMemoryDb.reset();
+        std::remove(logPath.c_str());
+        std::remove(snapshotPath.c_str());
+    }
+
+    /// @brief Test that the log is kept when the snapshot of a checkpoint cannot be written or renamed.
+    TEST_F(InMemoryDbTest, WriteAheadLogCheckpointFailureKeepsLog)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        std::string logPath = testing::TempDir() + "InMemoryDbWriteAheadLogCheckpointFailure.wal";
+        std::string directoryPath = testing::TempDir() + "InMemoryDbWriteAheadLogCheckpointFailure";
+        std::remove(logPath.c_str());
+        std::filesystem::remove_all(directoryPath);
+        ASSERT_EQ(m_inMemoryDb->enableWriteAheadLog(logPath, DbWalSyncPolicy::EveryCommit), true);
+        m_inMemoryDb->deleteRecordByID(1);
+
+        // The temporary file cannot be created in a directory, which doesn't exist
+        EXPECT_EQ(m_inMemoryDb->checkpoint(directoryPath + "/missing/snapshot.xqdb"), false);
+        DbWalEntriesCollection entries{};
+        ASSERT_EQ(DbWriteAheadLog::readEntries(logPath, entries), true);
+        EXPECT_EQ(entries.size(), 1);
+
+        // A file cannot be renamed over a directory, which is not empty
+        ASSERT_EQ(std::filesystem::create_directories(directoryPath + "/snapshot.xqdb/content"), true);
+        EXPECT_EQ(m_inMemoryDb->checkpoint(directoryPath + "/snapshot.xqdb"), false);
+        EXPECT_EQ(std::filesystem::exists(directoryPath + "/snapshot.xqdb.tmp"), false);
+        ASSERT_EQ(DbWriteAheadLog::readEntries(logPath, entries), true);
+        EXPECT_EQ(entries.size(), 1);
+
+        m_inMemoryDb.reset();
+        std::remove(logPath.c_str());
+        std::filesystem::remove_all(directoryPath);
+    }
+
+    /// @brief Test that the mutations, which cannot be written to the log, are not applied.
+    TEST_F(InMemoryDbTest, WriteAheadLogWriteFailureKeepsRecords)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100, DbStorageLayout::Column);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        // Every write to this device fails, as if the disk was full
+        if (!std::filesystem::exists("/dev/full"))
+        {
+            GTEST_SKIP();
+        }
+        ASSERT_EQ(m_inMemoryDb->enableWriteAheadLog("/dev/full", DbWalSyncPolicy::EveryCommit), true);
+
+        EXPECT_EQ(m_inMemoryDb->deleteRecordByID(1), false);
+        EXPECT_EQ(m_inMemoryDb->deleteRecordsByIds({ 2, 3 }), false);
+        EXPECT_EQ(m_inMemoryDb->addRecord(DbTableTest{ 1000, "newdata", 1000, "newaddress" }), false);
+        EXPECT_EQ(m_inMemoryDb->addRecords(DbTestRecordCollection{ DbTableTest{ 1001, "newdata", 1001, "newaddress" } }), false);
+        EXPECT_EQ(m_inMemoryDb->getNumberOfRecords(), 100);
+
+        EXPECT_NE(m_inMemoryDb->findById(1), nullptr);
+        EXPECT_EQ(m_inMemoryDb->findById(1000), nullptr);
+        DbTestRecordPointersCollection foundRecords{};
+        m_inMemoryDb->findMatchingRecords("column2", "3", foundRecords);
+        EXPECT_EQ(foundRecords.size(), 1);
+    }
+
+    //********** Cursor **********//
+
+    /// @brief Test that a cursor returns the same records as the search, batch by batch.
+    TEST_F(InMemoryDbTest, CursorFetchAllSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(1000, DbStorageLayout::Column);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        m_inMemoryDb->deleteRecordByID(15);
+        DbTestRecordPointersCollection expectedRecords{};
+        m_inMemoryDb->findMatchingRecords("column1", "testdata1", expectedRecords);
+
+        auto cursor = m_inMemoryDb->openCursor("column1", "testdata1");
+        DbTestRecordPointersCollection foundRecords{};
+        DbTestRecordPointersCollection batch{};
+        while (cursor.fetch(batch, 64) > 0)
+        {
+            foundRecords.insert(foundRecords.end(), batch.begin(), batch.end());
+        }
+        EXPECT_EQ(foundRecords, expectedRecords);
+        EXPECT_EQ(cursor.isExhausted(), true);
+    }
+
+    /// @brief Test that a limited cursor stops after the first records and uses the indexes of the query.
+    TEST_F(InMemoryDbTest, CursorLimitSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(1000);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        auto cursor = m_inMemoryDb->openCursor("column3", "testdata", 3);
+        DbTestRecordPointersCollection batch{};
+        ASSERT_EQ(cursor.fetch(batch, 10), 3);
+        EXPECT_EQ(batch[0]->id, 1);
+        EXPECT_EQ(batch[2]->id, 3);
+        EXPECT_EQ(cursor.next(), nullptr);
+
+        m_inMemoryDb->enableBalanceIndex();
+        DbQuery query{};
+        query.addPredicate("column2", "500").addPredicate("column1", "data5");
+        auto queryCursor = m_inMemoryDb->openCursor(query);
+        const DbTableTest* record = queryCursor.next();
+        ASSERT_NE(record, nullptr);
+        EXPECT_EQ(record->id, 500);
+        EXPECT_EQ(queryCursor.next(), nullptr);
+    }
+
+    //********** TopRecords **********//
+
+    /// @brief Test that the first records of a query are found in the order of each column.
+    TEST_F(InMemoryDbTest, FindTopRecordsSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(1000);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        // The balances are equal to the ids, the largest ones are first
+        DbQuery query{};
+        query.addPredicate("column3", "5testdata");
+        DbTestRecordPointersCollection f_output{};
+        m_inMemoryDb->findTopRecords(query, "column2", DbSortOrder::Descending, 3, f_output);
+        ASSERT_EQ(f_output.size(), 3);
+        EXPECT_EQ(f_output.at(0)->id, 995);
+        EXPECT_EQ(f_output.at(1)->id, 985);
+        EXPECT_EQ(f_output.at(2)->id, 975);
+
+        // The names are ordered as strings
+        f_output.clear();
+        m_inMemoryDb->findTopRecords(DbQuery{}, "column1", DbSortOrder::Ascending, 3, f_output);
+        ASSERT_EQ(f_output.size(), 3);
+        EXPECT_EQ(f_output.at(0)->name, "testdata1");
+        EXPECT_EQ(f_output.at(1)->name, "testdata10");
+        EXPECT_EQ(f_output.at(2)->name, "testdata100");
+
+        // Fewer matching records than the limit
+        f_output.clear();
+        query.addPredicate("column0", "15");
+        m_inMemoryDb->findTopRecords(query, "column0", DbSortOrder::Ascending, 10, f_output);
+        ASSERT_EQ(f_output.size(), 1);
+        EXPECT_EQ(f_output.at(0)->id, 15);
+    }
+
+    /// @brief Test that walking the balance index gives the same records as the heap.
+    TEST_F(InMemoryDbTest, FindTopRecordsBalanceIndexSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(1000);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        m_inMemoryDb->addRecord({ 1001, "duplicate", 500, "duplicate" });
+        m_inMemoryDb->deleteRecordByID(999);
+        DbQuery query{};
+        query.addPredicate("column1", "testdata");
+
+        DbTestRecordPointersCollection heapOutput{};
+        m_inMemoryDb->findTopRecords(query, "column2", DbSortOrder::Descending, 5, heapOutput);
+        DbTestRecordPointersCollection heapAscendingOutput{};
+        m_inMemoryDb->findTopRecords(DbQuery{}, "column2", DbSortOrder::Ascending, 600, heapAscendingOutput);
+
+        m_inMemoryDb->enableBalanceIndex();
+        DbTestRecordPointersCollection indexOutput{};
+        m_inMemoryDb->findTopRecords(query, "column2", DbSortOrder::Descending, 5, indexOutput);
+        DbTestRecordPointersCollection indexAscendingOutput{};
+        m_inMemoryDb->findTopRecords(DbQuery{}, "column2", DbSortOrder::Ascending, 600, indexAscendingOutput);
+
+        ASSERT_EQ(indexOutput.size(), 5);
+        EXPECT_EQ(indexOutput.at(0)->id, 1000);
+        EXPECT_EQ(indexOutput.at(1)->id, 998);
+        EXPECT_EQ(indexOutput, heapOutput);
+        EXPECT_EQ(indexAscendingOutput, heapAscendingOutput);
+        EXPECT_EQ(indexAscendingOutput.at(499)->id, 500);
+        EXPECT_EQ(indexAscendingOutput.at(500)->id, 1001);
+    }
+
+    //********** Aggregation **********//
+
+    /// @brief Test that the aggregates of the records matching a query are computed.
+    TEST_F(InMemoryDbTest, AggregateSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        // The balances are equal to the ids, the deleted records are not aggregated
+        m_inMemoryDb->deleteRecordByID(1);
+        m_inMemoryDb->deleteRecordByID(100);
+        DbAggregate allRecords{};
+        ASSERT_EQ(m_inMemoryDb->aggregate(DbQuery{}, "column2", allRecords), true);
+        EXPECT_EQ(allRecords.count, 98);
+        EXPECT_EQ(allRecords.sum, 4949);
+        EXPECT_EQ(allRecords.minimum, 2);
+        EXPECT_EQ(allRecords.maximum, 99);
+        EXPECT_DOUBLE_EQ(allRecords.getAverage(), 50.5);
+
+        DbQuery query{};
+        query.addPredicate("column1", "testdata1");
+        DbAggregate matchingRecords{};
+        ASSERT_EQ(m_inMemoryDb->aggregate(query, "column0", matchingRecords), true);
+        EXPECT_EQ(matchingRecords.count, 10);
+        EXPECT_EQ(matchingRecords.sum, 145);
+        EXPECT_EQ(matchingRecords.minimum, 10);
+        EXPECT_EQ(matchingRecords.maximum, 19);
+
+        // Only the integer columns can be aggregated
+        DbAggregate names{};
+        EXPECT_EQ(m_inMemoryDb->aggregate(DbQuery{}, "column1", names), false);
+        EXPECT_EQ(names.count, 0);
+        EXPECT_EQ(names.getAverage(), 0.0);
+    }
+
+    /// @brief Test that the balances are aggregated by the scan kernels with the column layout.
+    TEST_F(InMemoryDbTest, AggregateColumnLayoutSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100, DbStorageLayout::Column);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        m_inMemoryDb->deleteRecordByID(1);
+        m_inMemoryDb->deleteRecordByID(100);
+        DbAggregate allRecords{};
+        ASSERT_EQ(m_inMemoryDb->aggregate(DbQuery{}, "column2", allRecords), true);
+        EXPECT_EQ(allRecords.count, 98);
+        EXPECT_EQ(allRecords.sum, 4949);
+        EXPECT_EQ(allRecords.minimum, 2);
+        EXPECT_EQ(allRecords.maximum, 99);
+
+        // The compressed balances are aggregated record by record
+        m_inMemoryDb->enableIntegerCompression("column2");
+        DbAggregate compressedRecords{};
+        ASSERT_EQ(m_inMemoryDb->aggregate(DbQuery{}, "column2", compressedRecords), true);
+        EXPECT_EQ(compressedRecords.count, 98);
+        EXPECT_EQ(compressedRecords.sum, 4949);
+    }
+
+    /// @brief Test that the records are aggregated per group of a string and an integer column.
+    TEST_F(InMemoryDbTest, AggregateByGroupSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        m_inMemoryDb->addRecord({ 101, "testdata1", 7, "address" });
+        m_inMemoryDb->addRecord({ 102, "testdata1", 9, "address" });
+        DbAggregateGroupsCollection names{};
+        ASSERT_EQ(m_inMemoryDb->aggregateByGroup(DbQuery{}, "column1", "column2", names), true);
+        ASSERT_EQ(names.size(), 100);
+        EXPECT_EQ(names.at("testdata1").count, 3);
+        EXPECT_EQ(names.at("testdata1").sum, 17);
+        EXPECT_EQ(names.at("testdata1").minimum, 1);
+        EXPECT_EQ(names.at("testdata1").maximum, 9);
+        EXPECT_EQ(names.at("testdata50").count, 1);
+
+        // Only the records matching the query, grouped by the integer column
+        DbQuery query{};
+        query.addPredicate("column3", "address");
+        DbAggregateGroupsCollection balances{};
+        ASSERT_EQ(m_inMemoryDb->aggregateByGroup(query, "column2", "column0", balances), true);
+        ASSERT_EQ(balances.size(), 2);
+        EXPECT_EQ(balances.at("7").sum, 101);
+        EXPECT_EQ(balances.at("9").sum, 102);
+
+        EXPECT_EQ(m_inMemoryDb->aggregateByGroup(DbQuery{}, "column1", "column3", names), false);
+    }
+
+    //********** QueryCache **********//
+
+    /// @brief Test that repeated searches are answered by the query cache until the records are modified.
+    TEST_F(InMemoryDbTest, QueryCacheSuccess)
+    {
+        // Initial setup of the test. Verify that the In-memory
+        // database object is constructed successfully.
+        setupTest(100);
+        ASSERT_NE(m_inMemoryDb, nullptr);
+
+        m_inMemoryDb->enableQueryCache();
+        ASSERT_EQ(m_inMemoryDb->hasQueryCache(), true);
+        DbTestRecordPointersCollection f_output{};
+        m_inMemoryDb->findMatchingRecords("column1", "testdata1", f_output);
+        EXPECT_EQ(f_output.size(), 12);
+        f_output.clear();
+        m_inMemoryDb->findMatchingRecords("column1", "testdata1", f_output);
+        ASSERT_EQ(f_output.size(), 12);
+        EXPECT_EQ(f_output.at(0)->id, 1);
+        EXPECT_EQ(m_inMemoryDb->getNumberOfQueryCacheHits(), 1);
+        EXPECT_EQ(m_inMemoryDb->getNumberOfQueryCacheMisses(), 1);
+
+        // The same value of an integer column written differently is the same search
+        f_output.clear();
+        m_inMemoryDb->findMatchingRecords("column2", "7", f_output);
+        m_inMemoryDb->findMatchingRecords("column2", "007", f_output);
+        ASSERT_EQ(f_output.size(), 2);
+        EXPECT_EQ(f_output.at(1)->id, 7);
+        EXPECT_EQ(m_inMemoryDb->getNumberOfQueryCacheHits(), 2);
+
+        // Every modification invalidates the cached results
+        m_inMemoryDb->addRecord({ 101, "testdata1", 7, "address" });
+        f_output.clear();
+        m_inMemoryDb->findMatchingRecords("column1", "testdata1", f_output);
+        EXPECT_EQ(f_output.size(), 13);
+        m_inMemoryDb->deleteRecordByID(1);
+        f_output.clear();
+        m_inMemoryDb->findMatchingRecords("column1", "testdata1", f_output);
+        EXPECT_EQ(f_output.size(), 12);
+        m_inMemoryDb->compact();
+        f_output.clear();
+        m_inMemoryDb->findMatchingRecords("column1", "testdata1", f_output);
+        ASSERT_EQ(f_output.size(), 12);
+        for (auto rec : f_output)
+        {
+            EXPECT_NE(rec->id, 1);
+        }
+        EXPECT_EQ(m_inMemoryDb->getNumberOfQueryCacheHits(), 2);
+        EXPECT_EQ(m_inMemoryDb->getNumberOfQueryCacheMisses(), 5);
+    }
+}
@@ -0,0 +1,75 @@
+/// @file TestShardedInMemoryDb.cpp
+///
+/// @brief Unit tests for the ShardedInMemoryDb class.
+/// @author Ahmed Karaibrahimov
+/// @version 1.0
+/// @date 10/18/2026
+/// @copyright Copyright 2021 Ahmed Karaibrahimov. All rights reserved.
+/// @license No license required at all. Use it as you wish.
+
+#include "gtest/gtest.h"
+#include "ShardedInMemoryDb.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+/// @brief Test that the records are found in their shards after adding and deleting
+TEST(ShardedInMemoryDb, ReadAndWriteSuccess)
+{
+	xq::DbTestRecordCollection records{};
+	for (uint64_t id = 1; id <= 100; ++id)
+	{
+		records.push_back({ id, "name" + std::to_string(id), static_cast<int32_t>(id % 10), "address" });
+	}
+	xq::ShardedInMemoryDb database{ records, 4 };
+	ASSERT_EQ(database.getNumberOfShards(), 4);
+	EXPECT_EQ(database.getNumberOfRecords(), 100);
+
+	database.addRecord({ 101, "name101", 1, "address" });
+	database.addRecords({ { 102, "name102", 1, "address" }, { 103, "name103", 1, "address" } });
+	database.deleteRecordByID(1);
+	database.deleteRecordsByIds({ 2, 3, 1000 });
+	EXPECT_EQ(database.getNumberOfRecords(), 100);
+
+	xq::DbTableTest record{};
+	EXPECT_EQ(database.findById(2, record), false);
+	ASSERT_EQ(database.findById(102, record), true);
+	EXPECT_EQ(record.name, "name102");
+
+	// The records with balance 1 are spread among the shards
+	xq::DbTestRecordCollection foundRecords{};
+	database.findMatchingRecords("column2", "1", foundRecords);
+	EXPECT_EQ(foundRecords.size(), 12);
+
+	database.writeAllShards([](xq::InMemoryDb& f_database) { f_database.enableTrigramIndex("column1"); });
+	foundRecords.clear();
+	database.findMatchingRecords("column1", "name10", foundRecords);
+	EXPECT_EQ(foundRecords.size(), 5);
+}
+
+/// @brief Test that several writers and a parallel search over large shards find all the records
+TEST(ShardedInMemoryDb, ConcurrentWritersSuccess)
+{
+	xq::ShardedInMemoryDb database{ xq::DbTestRecordCollection{}, 8 };
+	constexpr uint64_t cRecordsPerWriter{ 20000 };
+	std::vector<std::thread> writers{};
+	for (uint64_t writerIndex = 0; writerIndex < 4; ++writerIndex)
+	{
+		writers.emplace_back([&database, writerIndex]() {
+			for (uint64_t id = writerIndex * cRecordsPerWriter + 1; id <= (writerIndex + 1) * cRecordsPerWriter; ++id)
+			{
+				database.addRecord({ id, "name", static_cast<int32_t>(id % 2), "address" });
+			}
+		});
+	}
+	for (auto& writer : writers)
+	{
+		writer.join();
+	}
+	ASSERT_EQ(database.getNumberOfRecords(), 4 * cRecordsPerWriter);
+
+	xq::DbTestRecordCollection foundRecords{};
+	database.findMatchingRecords("column2", "1", foundRecords);
+	EXPECT_EQ(foundRecords.size(), 2 * cRecordsPerWriter);
+}